@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/select_demo: select from a hypersparse matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A is hypersparse with many non-empty vectors, each with about one entry, so
+// that GrB_select leaves many empty vectors to be pruned from the hyperlist
+// of C.  The select is timed with 1 to nthreads_max threads.
+
+#include "GraphBLAS.h"
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define M 1000
+#define N 4000000
+#define NZ 2000000
+
+int main (void)
+{
+
+    // start GraphBLAS
+    GrB_init (GrB_NONBLOCKING) ;
+    int nthreads_max ;
+    GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max) ;
+    printf ("demo: select from a hypersparse matrix, nthreads: %d\n",
+        nthreads_max) ;
+
+    // create a random M-by-N hypersparse matrix with NZ entries
+    GrB_Index *I = (GrB_Index *) malloc (NZ * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc (NZ * sizeof (GrB_Index)) ;
+    double    *X = (double    *) malloc (NZ * sizeof (double)) ;
+    uint64_t seed = 1 ;
+    for (int64_t k = 0 ; k < NZ ; k++)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+        I [k] = (seed >> 33) % M ;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+        J [k] = (seed >> 33) % N ;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL ;
+        X [k] = ((double) (seed >> 11)) / ((double) (1ULL << 53)) ;
+    }
+
+    GrB_Matrix A, C ;
+    GrB_Matrix_new (&A, GrB_FP64, M, N) ;
+    GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE) ;
+    GrB_Matrix_build_FP64 (A, I, J, X, NZ, GrB_PLUS_FP64) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    GrB_Index anvals ;
+    GrB_Matrix_nvals (&anvals, A) ;
+    printf ("A: %d-by-%d with %" PRIu64 " entries\n", M, N, anvals) ;
+    GrB_Matrix_new (&C, GrB_FP64, M, N) ;
+
+    // warmup
+    GrB_Matrix_select_FP64 (C, NULL, NULL, GrB_VALUEGT_FP64, A, 0.5, NULL) ;
+
+    // C = A (A > y), for a range of y
+    for (int trial = 1 ; trial <= 3 ; trial++)
+    {
+        double y = (trial == 1) ? 0.1 : ((trial == 2) ? 0.5 : 0.9) ;
+        printf ("\nvaluegt %g:\n", y) ;
+        double t1 = 0 ;
+        GrB_Index cnvals1 = 0 ;
+        for (int nthreads = 1 ; nthreads <= nthreads_max ; nthreads++)
+        {
+            GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads) ;
+            #if defined ( _OPENMP )
+            double t = omp_get_wtime ( ) ;
+            #endif
+            GrB_Matrix_select_FP64 (C, NULL, NULL, GrB_VALUEGT_FP64, A, y,
+                NULL) ;
+            GrB_Index cnvals ;
+            GrB_Matrix_nvals (&cnvals, C) ;
+            #if defined ( _OPENMP )
+            t = omp_get_wtime ( ) - t ;
+            if (nthreads == 1) t1 = t ;
+            printf ("nthreads %3d time: %12.6f speedup %8.2f\n",
+                nthreads, t, t1/t) ;
+            #endif
+            if (nthreads == 1) cnvals1 = cnvals ;
+            if (cnvals != cnvals1)
+            {
+                printf ("error: wrong result\n") ;
+                return (1) ;
+            }
+        }
+        printf ("nnz (C): %" PRIu64 "\n", cnvals1) ;
+    }
+
+    // free everything
+    GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads_max) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Matrix_free (&C) ;
+    GrB_finalize ( ) ;
+}
+
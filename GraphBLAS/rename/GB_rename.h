@@ -37,6 +37,8 @@
 #define GB_AxB_iso GM_AxB_iso
 #define GB_AxB_meta_adotb_control GM_AxB_meta_adotb_control
 #define GB_AxB_meta GM_AxB_meta
+#define GB_AxB_outer GM_AxB_outer
+#define GB_AxB_outer_jit GM_AxB_outer_jit
 #define GB_AxB_saxbit_generic_first GM_AxB_saxbit_generic_first
 #define GB_AxB_saxbit_generic_firsti32 GM_AxB_saxbit_generic_firsti32
 #define GB_AxB_saxbit_generic_firsti64 GM_AxB_saxbit_generic_firsti64
@@ -63,6 +65,9 @@
 #define GB_AxB_saxpy3_generic_unflipped GM_AxB_saxpy3_generic_unflipped
 #define GB_AxB_saxpy3 GM_AxB_saxpy3
 #define GB_AxB_saxpy3_jit GM_AxB_saxpy3_jit
+#define GB_AxB_saxpy3_schedule_free GM_AxB_saxpy3_schedule_free
+#define GB_AxB_saxpy3_schedule_get GM_AxB_saxpy3_schedule_get
+#define GB_AxB_saxpy3_schedule_put GM_AxB_saxpy3_schedule_put
 #define GB_AxB_saxpy3_slice_balanced GM_AxB_saxpy3_slice_balanced
 #define GB_AxB_saxpy3_slice_quick GM_AxB_saxpy3_slice_quick
 #define GB_AxB_saxpy3_sym_bh GM_AxB_saxpy3_sym_bh
@@ -252,6 +257,11 @@
 #define GB_Context_nthreads_max_get GM_Context_nthreads_max_get
 #define GB_Context_nthreads_max GM_Context_nthreads_max
 #define GB_Context_nthreads_max_set GM_Context_nthreads_max_set
+#define GB_Context_werk_free GM_Context_werk_free
+#define GB_Context_werk_pop GM_Context_werk_pop
+#define GB_Context_werk_push GM_Context_werk_push
+#define GB_Context_werk_size_get GM_Context_werk_size_get
+#define GB_Context_werk_size_set GM_Context_werk_size_set
 #define GB_CONTEXT_THREAD GM_CONTEXT_THREAD
 #define GB_convert_any_to_bitmap GM_convert_any_to_bitmap
 #define GB_convert_any_to_full GM_convert_any_to_full
@@ -283,11 +293,19 @@
 #define GB_demacrofy_name GM_demacrofy_name
 #define GB_Descriptor_check GM_Descriptor_check
 #define GB_Descriptor_get GM_Descriptor_get
+#define GB_deserialize_blob_range GM_deserialize_blob_range
 #define GB_deserialize_from_blob GM_deserialize_from_blob
+#define GB_deserialize_from_stream GM_deserialize_from_stream
 #define GB_deserialize GM_deserialize
+#define GB_deserialize_range GM_deserialize_range
+#define GB_deserialize_stream_read GM_deserialize_stream_read
+#define GB_deserialize_unfilter GM_deserialize_unfilter
 #define GB_dup GM_dup
 #define GB_dup_worker GM_dup_worker
 #define GB_ek_slice GM_ek_slice
+#define GB_ek_slice_cache_free GM_ek_slice_cache_free
+#define GB_ek_slice_cache_get GM_ek_slice_cache_get
+#define GB_ek_slice_cache_put GM_ek_slice_cache_put
 #define GB_ek_slice_merge1 GM_ek_slice_merge1
 #define GB_ek_slice_merge2 GM_ek_slice_merge2
 #define GB_emult_02 GM_emult_02
@@ -438,6 +456,7 @@
 #define GB_Global_mode_set GM_Global_mode_set
 #define GB_Global_nmalloc_clear GM_Global_nmalloc_clear
 #define GB_Global_nmalloc_get GM_Global_nmalloc_get
+#define GB_Global_pattern_version_next GM_Global_pattern_version_next
 #define GB_Global_persistent_free GM_Global_persistent_free
 #define GB_Global_persistent_malloc GM_Global_persistent_malloc
 #define GB_Global_persistent_set GM_Global_persistent_set
@@ -450,6 +469,8 @@
 #define GB_Global_realloc_function_get GM_Global_realloc_function_get
 #define GB_Global_realloc_function GM_Global_realloc_function
 #define GB_Global_realloc_function_set GM_Global_realloc_function_set
+#define GB_Global_sort_get GM_Global_sort_get
+#define GB_Global_sort_set GM_Global_sort_set
 #define GB_Global_timing_add GM_Global_timing_add
 #define GB_Global_timing_clear_all GM_Global_timing_clear_all
 #define GB_Global_timing_clear GM_Global_timing_clear
@@ -521,12 +542,17 @@
 #define GB_is_shallow GM_is_shallow
 #define GB_ix_realloc GM_ix_realloc
 #define GB_jitifyer_alloc_space GM_jitifyer_alloc_space
+#define GB_jitifyer_archive GM_jitifyer_archive
+#define GB_jitifyer_async_drain GM_jitifyer_async_drain
 #define GB_jitifyer_cmake_compile GM_jitifyer_cmake_compile
+#define GB_jitifyer_compile GM_jitifyer_compile
 #define GB_jitifyer_direct_compile GM_jitifyer_direct_compile
+#define GB_jitifyer_direct_command GM_jitifyer_direct_command
 #define GB_jitifyer_entry_free GM_jitifyer_entry_free
 #define GB_jitifyer_establish_paths GM_jitifyer_establish_paths
 #define GB_jitifyer_extract_JITpackage GM_jitifyer_extract_JITpackage
 #define GB_jitifyer_finalize GM_jitifyer_finalize
+#define GB_jitifyer_get_async GM_jitifyer_get_async
 #define GB_jitifyer_get_cache_path GM_jitifyer_get_cache_path
 #define GB_jitifyer_get_C_cmake_libs GM_jitifyer_get_C_cmake_libs
 #define GB_jitifyer_get_C_compiler GM_jitifyer_get_C_compiler
@@ -534,6 +560,7 @@
 #define GB_jitifyer_get_C_libraries GM_jitifyer_get_C_libraries
 #define GB_jitifyer_get_C_link_flags GM_jitifyer_get_C_link_flags
 #define GB_jitifyer_get_control GM_jitifyer_get_control
+#define GB_jitifyer_get_record GM_jitifyer_get_record
 #define GB_jitifyer_get_C_preface GM_jitifyer_get_C_preface
 #define GB_jitifyer_get_error_log GM_jitifyer_get_error_log
 #define GB_jitifyer_get_use_cmake GM_jitifyer_get_use_cmake
@@ -541,11 +568,13 @@
 #define GB_jitifyer_hash GM_jitifyer_hash
 #define GB_jitifyer_init GM_jitifyer_init
 #define GB_jitifyer_insert GM_jitifyer_insert
+#define GB_jitifyer_kcode GM_jitifyer_kcode
 #define GB_jitifyer_load GM_jitifyer_load
 #define GB_jitifyer_load_worker GM_jitifyer_load_worker
 #define GB_jitifyer_lookup GM_jitifyer_lookup
 #define GB_jitifyer_path_256 GM_jitifyer_path_256
 #define GB_jitifyer_query GM_jitifyer_query
+#define GB_jitifyer_set_async GM_jitifyer_set_async
 #define GB_jitifyer_set_cache_path GM_jitifyer_set_cache_path
 #define GB_jitifyer_set_cache_path_worker GM_jitifyer_set_cache_path_worker
 #define GB_jitifyer_set_C_cmake_libs GM_jitifyer_set_C_cmake_libs
@@ -563,6 +592,8 @@
 #define GB_jitifyer_set_C_preface_worker GM_jitifyer_set_C_preface_worker
 #define GB_jitifyer_set_error_log GM_jitifyer_set_error_log
 #define GB_jitifyer_set_error_log_worker GM_jitifyer_set_error_log_worker
+#define GB_jitifyer_set_record GM_jitifyer_set_record
+#define GB_jitifyer_set_record_worker GM_jitifyer_set_record_worker
 #define GB_jitifyer_set_use_cmake GM_jitifyer_set_use_cmake
 #define GB_jitifyer_table_free GM_jitifyer_table_free
 #define GB_jitifyer_worker GM_jitifyer_worker
@@ -786,6 +817,7 @@
 #define GB_JITpackage_index GM_JITpackage_index
 #define GB_JITpackage_nfiles GM_JITpackage_nfiles
 #define GB_kroner GM_kroner
+#define GB_kroner_jit GM_kroner_jit
 #define GB_kron GM_kron
 #define GB_LZ4_attach_dictionary GM_LZ4_attach_dictionary
 #define GB_LZ4_attach_HC_dictionary GM_LZ4_attach_HC_dictionary
@@ -923,7 +955,15 @@
 #define GB_matvec_type_name GM_matvec_type_name
 #define GB_memcpy GM_memcpy
 #define GB_memoryUsage GM_memoryUsage
+#define GB_memory_pool_finalize GM_memory_pool_finalize
+#define GB_memory_pool_get GM_memory_pool_get
+#define GB_memory_pool_limit_get GM_memory_pool_limit_get
+#define GB_memory_pool_limit_set GM_memory_pool_limit_set
+#define GB_memory_pool_put GM_memory_pool_put
+#define GB_memory_pool_stats GM_memory_pool_stats
 #define GB_memset GM_memset
+#define GB_mm_read GM_mm_read
+#define GB_mm_write GM_mm_write
 #define GB_Monoid_check GM_Monoid_check
 #define GB_monoid_get GM_monoid_get
 #define GB_monoid_name_get GM_monoid_name_get
@@ -996,6 +1036,8 @@
 #define GB_qsort_1 GM_qsort_1
 #define GB_qsort_2 GM_qsort_2
 #define GB_qsort_3 GM_qsort_3
+#define GB_radix_sort GM_radix_sort
+#define GB_radix_sort_select GM_radix_sort_select
 #define GB_realloc_memory GM_realloc_memory
 #define GB_reduce_to_scalar GM_reduce_to_scalar
 #define GB_reduce_to_scalar_iso GM_reduce_to_scalar_iso
@@ -1013,15 +1055,19 @@
 #define GB_select_bitmap_jit GM_select_bitmap_jit
 #define GB_select_column GM_select_column
 #define GB_select_generic_bitmap GM_select_generic_bitmap
+#define GB_select_generic_masked GM_select_generic_masked
 #define GB_select_generic_phase1 GM_select_generic_phase1
 #define GB_select_generic_phase2 GM_select_generic_phase2
 #define GB_select GM_select
+#define GB_select_masked GM_select_masked
+#define GB_select_masked_jit GM_select_masked_jit
 #define GB_SelectOp_check GM_SelectOp_check
 #define GB_selectop_to_idxunop GM_selectop_to_idxunop
 #define GB_selector GM_selector
 #define GB_select_phase1_jit GM_select_phase1_jit
 #define GB_select_phase2_jit GM_select_phase2_jit
 #define GB_select_positional_bitmap GM_select_positional_bitmap
+#define GB_select_positional_masked GM_select_positional_masked
 #define GB_select_positional_phase1 GM_select_positional_phase1
 #define GB_select_positional_phase2 GM_select_positional_phase2
 #define GB_select_sparse GM_select_sparse
@@ -1030,9 +1076,11 @@
 #define GB_semiring_name_get GM_semiring_name_get
 #define GB_Semiring_new GM_Semiring_new
 #define GB_serialize_array GM_serialize_array
+#define GB_serialize_filter GM_serialize_filter
 #define GB_serialize_free_blocks GM_serialize_free_blocks
 #define GB_serialize GM_serialize
 #define GB_serialize_method GM_serialize_method
+#define GB_serialize_stream_array GM_serialize_stream_array
 #define GB_serialize_to_blob GM_serialize_to_blob
 #define GB_setElement GM_setElement
 #define GB_shallow_copy GM_shallow_copy
@@ -1115,6 +1163,7 @@
 #define GB_unop_iso GM_unop_iso
 #define GB_unop_new GM_unop_new
 #define GB_unop_one GM_unop_one
+#define GB_unshallow GM_unshallow
 #define GB_user_name_set GM_user_name_set
 #define GB_user_op_jit GM_user_op_jit
 #define GB_user_type_jit GM_user_type_jit
@@ -1122,6 +1171,7 @@
 #define GB_Vector_diag GM_Vector_diag
 #define GB_Vector_removeElement GM_Vector_removeElement
 #define GB_wait GM_wait
+#define GB_wait_merge GM_wait_merge
 #define GB_werk_pop GM_werk_pop
 #define GB_werk_push GM_werk_push
 #define GB_xalloc_memory GM_xalloc_memory
@@ -3251,6 +3301,8 @@
 #define GxB_ISNE_UINT32 GxM_ISNE_UINT32
 #define GxB_ISNE_UINT64 GxM_ISNE_UINT64
 #define GxB_ISNE_UINT8 GxM_ISNE_UINT8
+#define GxB_JIT_archive GxM_JIT_archive
+#define GxB_JIT_compile GxM_JIT_compile
 #define GxB_kron GxM_kron
 #define GxB_LAND_BOOL GxM_LAND_BOOL
 #define GxB_LAND_BOOL_MONOID GxM_LAND_BOOL_MONOID
@@ -3552,6 +3604,8 @@
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
+#define GxB_Matrix_deserialize_range GxM_Matrix_deserialize_range
+#define GxB_Matrix_deserialize_stream GxM_Matrix_deserialize_stream
 #define GxB_Matrix_diag GxM_Matrix_diag
 #define GxB_Matrix_eWiseUnion GxM_Matrix_eWiseUnion
 #define GxB_Matrix_export_BitmapC GxM_Matrix_export_BitmapC
@@ -3596,6 +3650,7 @@
 #define GxB_Matrix_pack_FullR GxM_Matrix_pack_FullR
 #define GxB_Matrix_pack_HyperCSC GxM_Matrix_pack_HyperCSC
 #define GxB_Matrix_pack_HyperCSR GxM_Matrix_pack_HyperCSR
+#define GxB_Matrix_read_MM GxM_Matrix_read_MM
 #define GxB_Matrix_reduce_FC32 GxM_Matrix_reduce_FC32
 #define GxB_Matrix_reduce_FC64 GxM_Matrix_reduce_FC64
 #define GxB_Matrix_reshapeDup GxM_Matrix_reshapeDup
@@ -3605,6 +3660,7 @@
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_select GxM_Matrix_select
 #define GxB_Matrix_serialize GxM_Matrix_serialize
+#define GxB_Matrix_serialize_stream GxM_Matrix_serialize_stream
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
 #define GxB_Matrix_sort GxM_Matrix_sort
@@ -3635,6 +3691,7 @@
 #define GxB_Matrix_unpack_FullR GxM_Matrix_unpack_FullR
 #define GxB_Matrix_unpack_HyperCSC GxM_Matrix_unpack_HyperCSC
 #define GxB_Matrix_unpack_HyperCSR GxM_Matrix_unpack_HyperCSR
+#define GxB_Matrix_write_MM GxM_Matrix_write_MM
 #define GxB_MAX_DIV_FP32 GxM_MAX_DIV_FP32
 #define GxB_MAX_DIV_FP64 GxM_MAX_DIV_FP64
 #define GxB_MAX_DIV_INT16 GxM_MAX_DIV_INT16
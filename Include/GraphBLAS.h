@@ -1,4 +1,4 @@
-// SuiteSparse:GraphBLAS 9.0.0
+// SuiteSparse:GraphBLAS 9.1.1
 //------------------------------------------------------------------------------
 // GraphBLAS.h: definitions for the GraphBLAS package
 //------------------------------------------------------------------------------
@@ -232,10 +232,10 @@
 
 // The version of this implementation, and the GraphBLAS API version:
 #define GxB_IMPLEMENTATION_NAME "SuiteSparse:GraphBLAS"
-#define GxB_IMPLEMENTATION_DATE "Sept 26, 2023"
+#define GxB_IMPLEMENTATION_DATE "Oct 18, 2026"
 #define GxB_IMPLEMENTATION_MAJOR 9
-#define GxB_IMPLEMENTATION_MINOR 0
-#define GxB_IMPLEMENTATION_SUB   0
+#define GxB_IMPLEMENTATION_MINOR 1
+#define GxB_IMPLEMENTATION_SUB   1
 #define GxB_SPEC_DATE "Sept 26, 2023"
 #define GxB_SPEC_MAJOR 2
 #define GxB_SPEC_MINOR 1
@@ -484,6 +484,11 @@ GrB_Info GrB_getVersion         // runtime access to C API version number
 // GxB_IMPORT:  GxB_FAST_IMPORT (faster, for trusted input data) or
 //      GxB_SECURE_IMPORT (slower, for untrusted input data), for the
 //      GxB*_pack* methods.
+//
+// GxB_SHALLOW_DESERIALIZE: if nonzero, GxB_Matrix_deserialize and
+//      GxB_Vector_deserialize may construct the matrix with components that
+//      point directly into the blob, with no copy.  See GxB_Matrix_deserialize
+//      for details.  The default (GrB_DEFAULT) is to copy the blob.
 
 // The following are enumerated values in both the GrB_Desc_Field and the
 // GxB_Option_Field for global options.  They are defined with the same integer
@@ -504,6 +509,7 @@ typedef enum
     GxB_SORT = 7091,          // control sort in GrB_mxm
     GxB_COMPRESSION = 7092,   // select compression for serialize
     GxB_IMPORT = 7093,        // secure vs fast import
+    GxB_SHALLOW_DESERIALIZE = 7094, // deserialize without copying the blob
 }
 GrB_Desc_Field ;
 
@@ -3757,6 +3763,10 @@ typedef enum            // for global options or matrix options
     GxB_PRINTF = 7020,               // printf function diagnostic output
     GxB_FLUSH = 7021,                // flush function diagnostic output
     GxB_MEMORY_POOL = 7022,          // no longer used
+    GxB_MEMORY_POOL_LIMIT = 7051,    // max # of bytes in memory pool (int64)
+    GxB_MEMORY_POOL_BYTES = 7052,    // # of bytes held in memory pool (int64)
+    GxB_MEMORY_POOL_HITS = 7053,     // # of mallocs satisfied by the pool
+    GxB_MEMORY_POOL_MISSES = 7054,   // # of mallocs not satisfied by the pool
     GxB_PRINT_1BASED = 7023,         // print matrices as 0-based or 1-based
 
     GxB_JIT_C_COMPILER_NAME = 7024,  // CPU JIT C compiler name
@@ -3769,6 +3779,8 @@ typedef enum            // for global options or matrix options
     GxB_JIT_C_CMAKE_LIBS = 7031,     // CPU JIT C libraries when using cmake
     GxB_JIT_USE_CMAKE = 7032,        // CPU JIT: use cmake or direct compile
     GxB_JIT_ERROR_LOG = 7033,        // CPU JIT: error log file
+    GxB_JIT_ASYNC = 7049,            // CPU JIT: compile in the background
+    GxB_JIT_RECORD = 7050,           // CPU JIT: file to record kernels used
 
     //------------------------------------------------------------
     // GrB_get for GrB_Matrix:
@@ -3796,6 +3808,22 @@ typedef enum
 }
 GxB_JIT_Control ;
 
+// GxB_JIT_compile compiles, in parallel, each kernel listed in a manifest
+// whose compiled library is not in the JIT cache, and then loads them.
+GrB_Info GxB_JIT_compile            // compile and load JIT kernels
+(
+    const char *manifest,           // file with the list of kernels
+    int32_t ncompilers              // # of compilers to run at the same time
+) ;
+
+// GxB_JIT_archive links the kernels listed in a manifest into a single
+// library in the JIT cache, which is loaded by GrB_init.
+GrB_Info GxB_JIT_archive            // build a JIT archive
+(
+    const char *manifest,           // file with the list of kernels
+    int32_t ncompilers              // # of compilers to run at the same time
+) ;
+
 // GxB_FORMAT is historical, but it can be by row or by column:
 typedef enum
 {
@@ -3906,6 +3934,9 @@ typedef enum
 
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
+
+    GxB_CONTEXT_WERK_SIZE   = 7055,  // max size of the Werk arena, in bytes.
+                    // If zero, the Werk arena is not used.
 }
 GxB_Context_Field ;
 
@@ -10802,6 +10833,8 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 #define GxB_COMPRESSION_LZ4   1000  // LZ4
 #define GxB_COMPRESSION_LZ4HC 2000  // LZ4HC, with default level 9
 #define GxB_COMPRESSION_ZSTD  3000  // ZSTD, with default level 1
+#define GxB_COMPRESSION_FILTER 10000    // delta/shuffle filter, added to
+                                        // any method except NONE
 
 // Most of the above methods have a level parameter that controls the tradeoff
 // between run time and the amount of compression obtained.  Higher levels
@@ -10820,6 +10853,20 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 // positive but unrecognized, the default is used (GxB_COMPRESSION_ZSTD,
 // level 1).
 
+// GxB_COMPRESSION_FILTER can be added to any method except
+// GxB_COMPRESSION_NONE, to filter each block of each array before it is
+// compressed.  The row/column pointers and indices (Ap, Ah, and Ai) are delta
+// encoded and byte shuffled, which typically leads to a much smaller blob.
+// The values (Ax) are byte shuffled only if this makes them smaller, which is
+// typical for floating-point values but not for values taken from a small
+// set; to decide, a sample of the values at the start of Ax is compressed with
+// and without the shuffle.  For example, use method =
+// GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER + 3 for ZSTD at level 3,
+// with the filter.  The filter is undone by the deserialize methods, which
+// take a little more time and workspace for a filtered blob.  A filtered
+// blob cannot be read by versions of GraphBLAS that do not have this
+// option.
+
 GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
 (
     // output:
@@ -10866,6 +10913,20 @@ GrB_Info GrB_Matrix_serializeSize   // estimate the size of a blob
 // deserialize methods simply add the descriptor, which allows for optional
 // control of the # of threads used to deserialize the blob.
 
+// If the GxB_SHALLOW_DESERIALIZE descriptor setting is nonzero, then each
+// array in the blob that was serialized with GxB_COMPRESSION_NONE, and that is
+// suitably aligned in memory, is not copied.  Instead, the matrix C is
+// constructed with a pointer directly into the blob.  If the blob is a
+// memory-mapped file, this allows a very large matrix to be deserialized in
+// O(1) time and memory, with its pages shared by all processes that map the
+// file.  Arrays that are compressed or not aligned are copied as usual.
+// GraphBLAS never modifies the blob, and never frees it.  Any method that
+// would modify C in place first makes its own copy of the parts of C held in
+// the blob.  The user application must not modify or free the blob until C
+// has been freed.  To ensure the arrays are aligned, the blob itself should
+// be aligned to at least 16 bytes, as is the case for malloc'd memory and
+// memory-mapped files.
+
 GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
 (
     // output:
@@ -10907,9 +10968,174 @@ GrB_Info GxB_Vector_deserialize     // deserialize blob into a GrB_Vector
     const GrB_Descriptor desc       // to control # of threads used
 ) ;
 
+// GxB_Matrix_deserialize_range deserializes just the vectors kfirst:klast of
+// the matrix A held in the blob:  C = A (:,kfirst:klast) if A was held by
+// column when it was serialized, or C = A (kfirst:klast,:) if A was held by
+// row.  C has the same type, format, and sparsity structure as A.  Each array
+// in the blob is held as a set of independently compressed blocks, of at most
+// 1MB each before compression, and only the blocks that hold these vectors are
+// decompressed, in parallel.  If A is hypersparse, the list of its non-empty
+// vectors is also decompressed in its entirety.  Extracting a few vectors
+// from a large blob thus takes much less time and memory than deserializing
+// all of it.  The descriptor is used as in GxB_Matrix_deserialize.
+
+GrB_Info GxB_Matrix_deserialize_range   // deserialize part of a blob
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the blob
+    GrB_Index blob_size,    // size of the blob
+    GrB_Index kfirst,       // first vector to deserialize
+    GrB_Index klast,        // last vector to deserialize
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+// GxB_Matrix_serialize_stream and GxB_Matrix_deserialize_stream serialize a
+// matrix to, and deserialize it from, a stream of bytes, without holding the
+// entire blob in memory.  The bytes are passed in order, and in pieces, to
+// (or from) a user-provided writer (or reader) function, which must return
+// true if all of the requested bytes were written (or read), and false
+// otherwise.  The stream is an arbitrary pointer that GraphBLAS passes to the
+// writer and reader, such as a FILE pointer or a pointer to a POSIX file
+// descriptor.  The arrays of the matrix are compressed (or uncompressed)
+// block by block, and only a few blocks are held in memory at any one time.
+// Because the blob header holds the size of each compressed block,
+// GxB_Matrix_serialize_stream compresses each array twice: once to find the
+// block sizes, and again to write the blocks after the header.  The bytes
+// written have the same format as the blob constructed by
+// GxB_Matrix_serialize (with smaller compressed blocks), so the two methods
+// can be mixed.  With GxB_COMPRESSION_NONE, the bytes are identical, and a
+// file written this way can be memory-mapped and deserialized with
+// GxB_Matrix_deserialize and GxB_SHALLOW_DESERIALIZE.  Example usage, with a
+// POSIX file descriptor:
+
+/*
+    bool my_write (void *stream, const void *data, size_t size)
+    {
+        int fd = *((int *) stream) ;
+        const char *p = data ;
+        while (size > 0)
+        {
+            ssize_t n = write (fd, p, size) ;
+            if (n <= 0) return (false) ;
+            p += n ; size -= n ;
+        }
+        return (true) ;
+    }
+    bool my_read (void *stream, void *data, size_t size)
+    {
+        int fd = *((int *) stream) ;
+        char *p = data ;
+        while (size > 0)
+        {
+            ssize_t n = read (fd, p, size) ;
+            if (n <= 0) return (false) ;
+            p += n ; size -= n ;
+        }
+        return (true) ;
+    }
+
+    int fd = open ("myblob", O_WRONLY | O_CREAT | O_TRUNC, 0644) ;
+    GxB_Matrix_serialize_stream (my_write, &fd, A, NULL) ;
+    close (fd) ;
+    fd = open ("myblob", O_RDONLY) ;
+    GxB_Matrix_deserialize_stream (&B, MyQtype, my_read, &fd, NULL) ;
+    close (fd) ;
+*/
+
+// If the writer returns false, GxB_Matrix_serialize_stream returns
+// GrB_INVALID_VALUE.  The matrix is unchanged, but the stream may hold a
+// partial blob that cannot be deserialized.
+// If the reader returns false, GxB_Matrix_deserialize_stream returns
+// GrB_INVALID_OBJECT.  The GxB_SHALLOW_DESERIALIZE descriptor setting is
+// ignored by GxB_Matrix_deserialize_stream.
+
+typedef bool (*GxB_stream_write_function)
+(
+    void *stream,               // stream to write to
+    const void *data,           // bytes to write
+    size_t size                 // # of bytes to write
+) ;
+
+typedef bool (*GxB_stream_read_function)
+(
+    void *stream,               // stream to read from
+    void *data,                 // bytes to read
+    size_t size                 // # of bytes to read
+) ;
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    GxB_stream_write_function writer,   // function to write to the stream
+    void *stream,                   // stream passed to the writer
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_stream_read_function reader,    // function to read from the stream
+    void *stream,                   // stream passed to the reader
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
 // historical; use GrB_get with GxB_JIT_C_NAME instead.
 GrB_Info GxB_deserialize_type_name (char *, const void *, GrB_Index) ;
 
+//==============================================================================
+// GxB_Matrix_read_MM and GxB_Matrix_write_MM: Matrix Market files
+//==============================================================================
+
+// GxB_Matrix_read_MM reads a matrix in the Matrix Market coordinate format
+// (https://math.nist.gov/MatrixMarket/formats.html) from a file already
+// opened for reading.  The file is read sequentially, in large chunks, so it
+// can be a pipe.  Each chunk is parsed in parallel, and the entries are built
+// into the matrix C with no extra copy.  The pattern, integer, real, and
+// complex fields are supported, with general, symmetric, skew-symmetric, or
+// Hermitian symmetry.  If the type is NULL, C has the type GrB_BOOL, GrB_INT64,
+// GrB_FP64, or GxB_FC64, for each of these fields.  Otherwise, type must be a
+// built-in type, and the entries are typecast into it.  If an entry appears
+// more than once in the file, the last one is kept.  The dense array format
+// is not supported.
+
+// GxB_Matrix_write_MM writes a matrix with a built-in type to a file already
+// opened for writing, in the Matrix Market coordinate general format.  The
+// entries are formatted in parallel.
+
+// For a faster binary file format, use GxB_Matrix_serialize_stream and
+// GxB_Matrix_deserialize_stream (or GxB_Matrix_deserialize on a memory-mapped
+// file).
+
+GrB_Info GxB_Matrix_read_MM     // read a matrix from a Matrix Market file
+(
+    // output:
+    GrB_Matrix *C,              // output matrix read from the file
+    // input:
+    GrB_Type type,              // type of C, or NULL to use the file's type
+    FILE *f,                    // file to read from, already open
+    const GrB_Descriptor desc   // to control # of threads used
+) ;
+
+GrB_Info GxB_Matrix_write_MM    // write a matrix to a Matrix Market file
+(
+    GrB_Matrix A,               // matrix to write
+    FILE *f,                    // file to write to, already open
+    const GrB_Descriptor desc   // to control # of threads used
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
@@ -118,6 +118,17 @@
             GB_MULT (zwork, aki, bkj, i, k, j) ;                        \
             fadd (&cij, &cij, &zwork)
 
+        // cij = Wx [t] and cij += Wx [t], for the ultra-fine tasks of dot3
+        #undef  GB_DOT3_ULTRA_GET
+        #define GB_DOT3_ULTRA_GET(cij,Wx,t) cij = Wx [t]
+        #undef  GB_DOT3_ULTRA_UPDATE
+        #define GB_DOT3_ULTRA_UPDATE(cij,Wx,t) fadd (&cij, &cij, &(Wx [t]))
+
+        // Cx [pC] += cij, for C+=A'*B computed in-place by dot2
+        #undef  GB_DOT2_CIJ_UPDATE
+        #define GB_DOT2_CIJ_UPDATE(Cx,pC,cij)                           \
+            fadd (&(Cx [pC]), &(Cx [pC]), &cij)
+
         int64_t offset = GB_positional_offset (opcode, NULL, NULL) ;
 
         if (mult->ztype == GrB_INT64)
@@ -276,6 +287,23 @@
             GB_MULT (zwork, aki, bkj, i, k, j) ;                        \
             fadd (cij, cij, zwork)
 
+        // cij = Wx [t] and cij += Wx [t], for the ultra-fine tasks of dot3
+        #undef  GB_DOT3_ULTRA_GET
+        #define GB_DOT3_ULTRA_GET(cij,Wx,t)                             \
+            memcpy (cij, Wx +((t)*csize), csize)
+        #undef  GB_DOT3_ULTRA_UPDATE
+        #define GB_DOT3_ULTRA_UPDATE(cij,Wx,t)                          \
+            fadd (cij, cij, Wx +((t)*csize))
+
+        // Cx [pC] += cij, for C+=A'*B computed in-place by dot2
+        #undef  GB_DOT2_CIJ_UPDATE
+        #define GB_DOT2_CIJ_UPDATE(Cx,pC,cij)                           \
+            fadd (Cx +((pC)*csize), Cx +((pC)*csize), cij)
+
+        // size of the entries of C and Z
+        #undef  GB_C_SIZE
+        #define GB_C_SIZE csize
+
         // generic types for C and Z
         #undef  GB_C_TYPE
         #define GB_C_TYPE GB_void
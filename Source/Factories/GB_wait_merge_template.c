@@ -0,0 +1,138 @@
+//------------------------------------------------------------------------------
+// GB_wait_merge_template.c: S = A+T, dropping the zombies of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each task merges the entries A [pA:pA_end-1] with T [pT:pT_end-1], in
+// (j,i) order.  Zombies in A are skipped, and T(i,j) replaces A(i,j) if both
+// are present.  In phase 1, the entries and vectors of S for each task are
+// counted.  In phase 2, the entries and vectors of S are computed.  A vector
+// of S that starts in an earlier task continues in this task if its index is
+// Task_jcont [tid].
+
+{
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task description
+        //----------------------------------------------------------------------
+
+        int64_t pA = A_slice [tid] ;
+        int64_t pT = T_slice [tid] ;
+        const int64_t pA_end = A_slice [tid+1] ;
+        const int64_t pT_end = T_slice [tid+1] ;
+        int64_t kA = (pA < pA_end) ? GB_wait_merge_find (pA, Ap, anvec) : 0 ;
+        int64_t kT = (pT < pT_end) ? GB_wait_merge_find (pT, Tp, tnvec) : 0 ;
+
+        #if defined ( GB_PHASE_1_OF_2 )
+        int64_t snz = 0, snvec = 0, jfirst = -1, jlast = -1 ;
+        #define GB_WAIT_MERGE_EMIT(j,i,Xx,pX)                               \
+        {                                                                   \
+            if (j != jlast)                                                 \
+            {                                                               \
+                if (snvec++ == 0) jfirst = j ;                              \
+                jlast = j ;                                                 \
+            }                                                               \
+            snz++ ;                                                         \
+        }
+        #else
+        int64_t pS = Task_pS [tid] ;
+        int64_t kS = Task_kS [tid] ;
+        int64_t jlast = Task_jcont [tid] ;
+        #define GB_WAIT_MERGE_EMIT(j,i,Xx,pX)                               \
+        {                                                                   \
+            if (j != jlast)                                                 \
+            {                                                               \
+                Sh [kS] = j ;                                               \
+                Sp [kS] = pS ;                                              \
+                kS++ ;                                                      \
+                jlast = j ;                                                 \
+            }                                                               \
+            Si [pS] = i ;                                                   \
+            GB_COPY (pS, Xx, pX) ;                                          \
+            pS++ ;                                                          \
+        }
+        #endif
+
+        //----------------------------------------------------------------------
+        // merge A [pA:pA_end-1] and T [pT:pT_end-1] into S
+        //----------------------------------------------------------------------
+
+        while (pA < pA_end && pT < pT_end)
+        {
+            // get A(iA,jA), which may be a zombie, and T(iT,jT)
+            while (Ap [kA+1] <= pA) kA++ ;
+            while (Tp [kT+1] <= pT) kT++ ;
+            const int64_t jA = GBH (Ah, kA) ;
+            const int64_t jT = Th [kT] ;
+            const int64_t i = Ai [pA] ;
+            const int64_t iA = GB_UNFLIP (i) ;
+            const int64_t iT = Ti [pT] ;
+            if (jA < jT || (jA == jT && iA < iT))
+            {
+                // A(iA,jA) comes first; keep it if it is not a zombie
+                if (!GB_IS_ZOMBIE (i)) GB_WAIT_MERGE_EMIT (jA, iA, Ax, pA) ;
+                pA++ ;
+            }
+            else if (jA == jT && iA == iT)
+            {
+                // T(iT,jT) replaces A(iA,jA), even if A(iA,jA) is a zombie
+                GB_WAIT_MERGE_EMIT (jT, iT, Tx, pT) ;
+                pA++ ;
+                pT++ ;
+            }
+            else
+            {
+                // T(iT,jT) comes first
+                GB_WAIT_MERGE_EMIT (jT, iT, Tx, pT) ;
+                pT++ ;
+            }
+        }
+
+        for ( ; pA < pA_end ; pA++)
+        {
+            // A(iA,jA) is not in T; keep it if it is not a zombie
+            const int64_t i = Ai [pA] ;
+            if (!GB_IS_ZOMBIE (i))
+            {
+                while (Ap [kA+1] <= pA) kA++ ;
+                const int64_t jA = GBH (Ah, kA) ;
+                GB_WAIT_MERGE_EMIT (jA, i, Ax, pA) ;
+            }
+        }
+
+        for ( ; pT < pT_end ; pT++)
+        {
+            // T(iT,jT) is not in A
+            while (Tp [kT+1] <= pT) kT++ ;
+            const int64_t jT = Th [kT] ;
+            GB_WAIT_MERGE_EMIT (jT, Ti [pT], Tx, pT) ;
+        }
+
+        //----------------------------------------------------------------------
+        // save the results of phase 1
+        //----------------------------------------------------------------------
+
+        #if defined ( GB_PHASE_1_OF_2 )
+        Task_nz     [tid] = snz ;
+        Task_nvec   [tid] = snvec ;
+        Task_jfirst [tid] = jfirst ;
+        Task_jlast  [tid] = jlast ;
+        #else
+        ASSERT (pS == Task_pS [tid+1]) ;
+        ASSERT (kS == Task_kS [tid+1]) ;
+        #endif
+    }
+}
+
+#undef GB_WAIT_MERGE_EMIT
+#undef GB_COPY
+#undef GB_PHASE_1_OF_2
+
@@ -154,7 +154,12 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     { 
         // no work to do; C is an empty matrix, normally hypersparse
         GBURBLE ("(empty dot) ") ;
-        if (C_in != NULL) return (GrB_SUCCESS) ;
+        if (C_in != NULL)
+        { 
+            // C_in += A'*B does not modify C_in
+            (*done_in_place) = true ;
+            return (GrB_SUCCESS) ;
+        }
         return (GB_new (&C, // auto sparsity, existing header
             ztype, A->vdim, B->vdim, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
             GB_Global_hyper_switch_get ( ), 1)) ;
@@ -204,13 +209,21 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     }
 
     //--------------------------------------------------------------------------
-    // general case: C<M>=A'*B, C<!M>=A'*B, or C=A'*B, not in-place
+    // general case: C<M>=A'*B, C<!M>=A'*B, or C=A'*B
     //--------------------------------------------------------------------------
 
+    // C_in+=A'*B is computed in-place if C_in is bitmap (or full, if dot4 did
+    // not handle it), no mask is present, and A and B are not hypersparse.
+
+    bool in_place = (M == NULL)
+        && GB_AxB_bitmap_in_place_control (C_iso, C_in, accum, semiring)
+        && !GB_IS_HYPERSPARSE (A) && !GB_IS_HYPERSPARSE (B) ;
+
     GBURBLE ("(%sdot2) ", iso_kind) ;
     (*mask_applied) = (M != NULL) ; // mask applied if present
-    (*done_in_place) = false ;      // TODO: allow dot2 to work in-place
-    return (GB_AxB_dot2 (C, C_iso, cscalar, M, Mask_comp, Mask_struct,
-        false, A, B, semiring, flipxy, Werk)) ;
+    info = GB_AxB_dot2 (C, in_place ? C_in : NULL, C_iso, cscalar, M,
+        Mask_comp, Mask_struct, false, A, B, semiring, flipxy, Werk) ;
+    (*done_in_place) = in_place && (info == GrB_SUCCESS) ;
+    return (info) ;
 }
 
@@ -16,11 +16,20 @@
 // is bitmap or full, and the dot product method accesses A with a different
 // stride than when computing C<#M>=A'*B.
 
-// TODO:  this is slower than it could be if A and B are both bitmap/full, when
-// A->vlen is large.  This is because the inner loop is a simple full/bitmap
-// dot product, across the entire input vectors.  No tiling is used, so cache
-// performance is not as good as it could be.  For large problems, C=(A')*B is
-// faster with the saxpy3 method, as compared to this method with C=A'*B.
+// If A and B are both full and no mask is present, C=A'*B is computed with a
+// cache-tiled method (see Template/GB_AxB_dot2_tiled_template.c), by the
+// factory and JIT kernels for most semirings.  Otherwise, if A and B are both
+// bitmap/full, this method is slower than it could be when A->vlen is large,
+// since the inner loop is a simple full/bitmap dot product across the entire
+// input vectors.  For large problems, C=(A')*B is faster with the saxpy3
+// method, as compared to this method with C=A'*B.
+
+// If C_in is present, C_in+=A'*B or C_in+=A*B is computed in-place instead,
+// and the output C is not used.  C_in is bitmap or full (and converted to
+// bitmap), no mask is present, A and B are not hypersparse, and the accum
+// operator matches the monoid (see GB_AxB_bitmap_in_place_control).  Entries
+// present in C_in on input are combined with the results of the dot products
+// via the monoid, and the new entries are added to the bitmap of C_in.
 
 // JIT: done.
 
@@ -53,6 +62,7 @@
 GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // if present, compute C_in+=A'*B in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M_in,          // mask matrix for C<#M>=A'*B, may be NULL
@@ -89,6 +99,9 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
     ASSERT (!GB_PENDING (B_in)) ;
 
     ASSERT_SEMIRING_OK (semiring, "semiring for numeric A'*B", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (C_in, "C_in for dot2 A'*B", GB0) ;
+    ASSERT (GB_IMPLIES (C_in != NULL, M_in == NULL && !C_iso &&
+        !GB_IS_HYPERSPARSE (A_in) && !GB_IS_HYPERSPARSE (B_in))) ;
 
     struct GB_Matrix_opaque Awork_header, Bwork_header, Mwork_header ;
     GrB_Matrix M = NULL, Mwork = NULL ;
@@ -309,10 +322,10 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
         (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
     GrB_Type ctype = add->op->ztype ;
 
-    // determine the sparsity of C.  If M is present, C is always bitmap.
-    // otherwise, C can be bitmap or full
+    // determine the sparsity of C.  If M is present, or if C is computed
+    // in-place, C is always bitmap.  Otherwise, C can be bitmap or full
     int C_sparsity = GxB_BITMAP ;
-    if (M == NULL)
+    if (M == NULL && C_in == NULL)
     {
         // no mask is present so C can be bitmap or full
         if (A_is_full && B_is_full)
@@ -366,10 +379,29 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
             GB_sparsity_char_matrix (B_in)) ;
     }
 
-    // set C->iso = C_iso
-    GB_OK (GB_new_bix (&C, // bitmap/full, existing header
-        ctype, cvlen, cvdim, GB_Ap_malloc, true, C_sparsity,
-        M_is_sparse_or_hyper, B->hyper_switch, cnvec, cnz, true, C_iso)) ;
+    if (C_in != NULL)
+    { 
+        // C_in+=A'*B is computed in-place; C_in must be bitmap and not iso
+        ASSERT (C_in->vlen == cvlen && C_in->vdim == cvdim) ;
+        C = C_in ;
+        if (C->iso)
+        { 
+            GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        }
+        if (GB_IS_FULL (C))
+        { 
+            GB_OK (GB_convert_full_to_bitmap (C)) ;
+        }
+    }
+    else
+    { 
+        // C->b is calloc'ed unless M is bitmap or full, in which case the
+        // template clears it.  set C->iso = C_iso
+        GB_OK (GB_new_bix (&C, // bitmap/full, existing header
+            ctype, cvlen, cvdim, GB_Ap_malloc, true, C_sparsity,
+            (M == NULL) || M_is_sparse_or_hyper, B->hyper_switch, cnvec, cnz,
+            true, C_iso)) ;
+    }
 
     //--------------------------------------------------------------------------
     // if M is sparse/hyper, scatter it into the C bitmap
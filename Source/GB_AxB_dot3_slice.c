@@ -19,9 +19,15 @@
 // is costly to compute, it is possible that it is placed by itself in a
 // single coarse task.
 
-// FUTURE:: Ultra-fine tasks could also be constructed, so that the computation
-// of a single entry C(i,j) can be broken into multiple tasks.  The slice of
-// A(:,i) and B(:,j) would use GB_slice_vector, where no mask would be used.
+// If A and B are both sparse or hypersparse, a costly entry C(i,j) at the
+// start or end of a coarse task is split off from it, and its computation is
+// broken into a team of ultra-fine tasks.  Each ultra-fine task computes the
+// dot product of A(i1:i2,i) and B(i1:i2,j) for a slice i1:i2 found by
+// GB_slice_vector.  An ultra-fine task has klast = -1, and pC_end = pC+1,
+// where pC is the position of C(i,j).  The slices of A(:,i) and B(:,j) are
+// in pA:pA_end-1 and pB:pB_end-1.  The tasks of each team are contiguous, and
+// the first task in the team (the leader) has len equal to the team size.
+// The len of the other tasks in the team is zero.
 
 #define GB_FREE_WORKSPACE                       \
 {                                               \
@@ -37,6 +43,105 @@
 #include "GB_mxm.h"
 #include "GB_search_for_vector_template.c"
 
+// GB_DOT3_COSTLY (p): true if C(i,j) at position p should be split into a
+// team of ultra-fine tasks
+#define GB_DOT3_COSTLY(p) \
+    ((double) (Cwork [(p)+1] - Cwork [p]) > 2 * target_task_size)
+
+// GB_DOT3_TEAM_SIZE (p): # of ultra-fine tasks for C(i,j) at position p
+#define GB_DOT3_TEAM_SIZE(p) \
+    ((int) GB_IMIN (ceil ((Cwork [(p)+1] - Cwork [p]) / target_task_size), \
+        nthreads))
+
+//------------------------------------------------------------------------------
+// GB_create_ultra_tasks: create a team of ultra-fine tasks for one C(i,j)
+//------------------------------------------------------------------------------
+
+static void GB_create_ultra_tasks
+(
+    GB_task_struct *restrict Team,  // the team of tasks to construct
+    const int nteam,                // # of tasks in the team
+    const int64_t pC,               // C(i,j) is the entry at Ci,Cx [pC]
+    const GrB_Matrix C,
+    const int64_t *restrict Mi,
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // find C(i,j), A(:,i), and B(:,j)
+    //--------------------------------------------------------------------------
+
+    const int64_t kC = GB_search_for_vector (pC, C->p, 0, C->nvec, C->vlen) ;
+    const int64_t i = Mi [pC] ;
+    const int64_t j = GBH (C->h, kC) ;
+
+    int64_t pA_start, pA_end, pB_start, pB_end ;
+    if (GB_IS_HYPERSPARSE (A))
+    { 
+        // A is hypersparse: find A(:,i) in the A->Y hyper_hash
+        const GrB_Matrix Y = A->Y ;
+        GB_hyper_hash_lookup (A->h, A->nvec, A->p,
+            (Y == NULL) ? NULL : Y->p, (Y == NULL) ? NULL : Y->i,
+            (Y == NULL) ? NULL : Y->x, (Y == NULL) ? 0 : (Y->vdim - 1),
+            i, &pA_start, &pA_end) ;
+    }
+    else
+    { 
+        // A is sparse
+        pA_start = A->p [i] ;
+        pA_end   = A->p [i+1] ;
+    }
+    if (GB_IS_HYPERSPARSE (B))
+    { 
+        // B is hypersparse: find B(:,j) in the B->Y hyper_hash
+        const GrB_Matrix Y = B->Y ;
+        GB_hyper_hash_lookup (B->h, B->nvec, B->p,
+            (Y == NULL) ? NULL : Y->p, (Y == NULL) ? NULL : Y->i,
+            (Y == NULL) ? NULL : Y->x, (Y == NULL) ? 0 : (Y->vdim - 1),
+            j, &pB_start, &pB_end) ;
+    }
+    else
+    { 
+        // B is sparse
+        pB_start = B->p [j] ;
+        pB_end   = B->p [j+1] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // slice A(:,i) and B(:,j) into nteam parts of about the same work
+    //--------------------------------------------------------------------------
+
+    const double work = (double) ((pA_end - pA_start) + (pB_end - pB_start)) ;
+    int64_t pA = pA_start ;
+    int64_t pB = pB_start ;
+    for (int t = 0 ; t < nteam ; t++)
+    {
+        int64_t pA_next = pA_end ;
+        int64_t pB_next = pB_end ;
+        if (t < nteam - 1 && pA < pA_end && pB < pB_end)
+        { 
+            // find the slice of A(:,i) and B(:,j) for the next task
+            double target_work = ((nteam - t - 1) * work) / nteam ;
+            GB_slice_vector (NULL, NULL, &pA_next, &pB_next,
+                0, 0, NULL, pA, pA_end, A->i, pB, pB_end, B->i, A->vlen,
+                target_work) ;
+        }
+        Team [t].kfirst = kC ;
+        Team [t].klast  = -1 ;
+        Team [t].pC     = pC ;
+        Team [t].pC_end = pC + 1 ;
+        Team [t].pA     = pA ;
+        Team [t].pA_end = pA_next ;
+        Team [t].pB     = pB ;
+        Team [t].pB_end = pB_next ;
+        Team [t].len    = (t == 0) ? nteam : 0 ;
+        pA = pA_next ;
+        pB = pB_next ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_dot3_slice
 //------------------------------------------------------------------------------
@@ -50,6 +155,9 @@ GrB_Info GB_AxB_dot3_slice
     int *p_nthreads,                // # of threads to use
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix, C has the same pattern
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
     GB_Werk Werk
 )
 {
@@ -91,6 +199,7 @@ GrB_Info GB_AxB_dot3_slice
     const int64_t cnvec = C->nvec ;
     const int64_t cvlen = C->vlen ;
     const int64_t cnz = GB_nnz_held (C) ;
+    const int64_t *restrict Mi = M->i ;
 
     //--------------------------------------------------------------------------
     // compute the cumulative sum of the work
@@ -143,6 +252,11 @@ GrB_Info GB_AxB_dot3_slice
     ntasks1 = GB_IMIN (ntasks1, cnz) ;
     ntasks1 = GB_IMAX (ntasks1, 1) ;
 
+    // ultra-fine tasks are used only if A and B are both sparse/hypersparse
+    const bool ultra = (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) &&
+                       (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
+    int64_t nultra = 0 ;
+
     //--------------------------------------------------------------------------
     // slice the work into coarse tasks
     //--------------------------------------------------------------------------
@@ -170,6 +284,33 @@ GrB_Info GB_AxB_dot3_slice
         int64_t pfirst = Coarse [t] ;
         int64_t plast  = Coarse [t+1] - 1 ;
 
+        if (pfirst > plast)
+        { 
+            // This task is empty, which means the coarse task that computes
+            // C(i,j) is doing too much work.  If possible, the entry C(i,j)
+            // has been (or will be) split into ultra-fine tasks.
+            continue ;
+        }
+
+        // split off C(i,j) at the start of the coarse task, if costly
+        if (ultra && GB_DOT3_COSTLY (pfirst))
+        { 
+            int nteam = GB_DOT3_TEAM_SIZE (pfirst) ;
+            GB_REALLOC_TASK_WORK (TaskList, ntasks + nteam, max_ntasks) ;
+            GB_create_ultra_tasks (TaskList + ntasks, nteam, pfirst, C, Mi,
+                A, B) ;
+            ntasks += nteam ;
+            nultra++ ;
+            pfirst++ ;
+        }
+
+        // split off C(i,j) at the end of the coarse task, if costly
+        bool ultra_last = ultra && pfirst <= plast && GB_DOT3_COSTLY (plast) ;
+        if (ultra_last)
+        { 
+            plast-- ;
+        }
+
         if (pfirst <= plast)
         { 
             // find the first vector of the slice for task taskid: the
@@ -196,20 +337,26 @@ GrB_Info GB_AxB_dot3_slice
             ASSERT (kfirst <= klast) ;
             TaskList [ntasks].pC     = pfirst ;
             TaskList [ntasks].pC_end = plast + 1 ;
+            TaskList [ntasks].len    = 0 ;
             ntasks++ ;
-
         }
-        else
+
+        if (ultra_last)
         { 
-            // This task is empty, which means the coarse task that computes
-            // C(i,j) is doing too much work.
-            // FUTURE:: Use ultra-fine tasks here instead, and split the work
-            // for computing the single dot product C(i,j) amongst several
-            // ultra-fine tasks.
-            ;
+            int nteam = GB_DOT3_TEAM_SIZE (plast + 1) ;
+            GB_REALLOC_TASK_WORK (TaskList, ntasks + nteam, max_ntasks) ;
+            GB_create_ultra_tasks (TaskList + ntasks, nteam, plast + 1, C, Mi,
+                A, B) ;
+            ntasks += nteam ;
+            nultra++ ;
         }
     }
 
+    if (nultra > 0)
+    { 
+        GBURBLE ("(%" PRId64 " ultra-fine) ", nultra) ;
+    }
+
     ASSERT (ntasks <= max_ntasks) ;
 
     //--------------------------------------------------------------------------
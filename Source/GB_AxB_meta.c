@@ -18,9 +18,11 @@
 // matrix C passed in from the user (C_in).
 
 // The method is chosen automatically:  a gather/scatter saxpy method
-// (Gustavson), or a dot product method.
+// (Gustavson), a dot product method, or (for C+=A*B' where C is full and A
+// and B are sparse or hypersparse) an outer-product method that does not
+// transpose B.
 
-// FUTURE:: an outer-product method for C=A*B'
+// FUTURE:: an outer-product method for C=A*B' where C is sparse
 
 #define GB_FREE_WORKSPACE       \
 {                               \
@@ -150,12 +152,14 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // If C is bitmap:
     //
     //      C can be computed in-place if its type is the same as the semiring
-    //      monoid.  The accum must not be present, or if present it must match
-    //      the semiring monoid.  C_replace can be true or false.
+    //      monoid, and the accum operator is present and matches the monoid.
+    //      C_replace must be false, or effectively false.  GB_AxB_dot2 (with
+    //      no mask) and GB_AxB_saxbit accumulate their results into C, adding
+    //      new entries to its bitmap.  The other methods ignore a bitmap C_in
+    //      and compute their result in T.
     //
-    //      todo: modify GB_AxB_dot2 so it can compute C in-place,
-    //      or add a bitmap dot product method.  Also modify GB_AxB_saxpy
-    //      so it can compute a C bitmap in-place.
+    //      todo: if the accum is not present, C could be cleared and then
+    //      computed in-place.
     //
     // In both cases, C must not be transposed, nor can it be aliased with any
     // input matrix.
@@ -164,23 +168,10 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 
     if (C_in != NULL)
     {
-        #if 0
-        // disabled: this will work for most methods in the future is too
-        // aggressive for dot4
-        if (GB_IS_BITMAP (C_in))
-        {
-            // C is bitmap
-            ASSERT (!GB_PENDING (C_in)) ; // no pending tuples in bitmap
-            ASSERT (!GB_ZOMBIES (C_in)) ; // bitmap never has zombies
-            can_do_in_place = (C_in->type == semiring_in->add->op->ztype)
-                && ((accum == NULL) || (accum == semiring_in->add->op)) ;
-        }
-        else
-        #endif
         if (accum != NULL)
         { 
-            // accum is present; check if C_in is full.
-            bool C_is_full = GB_IS_FULL (C_in) ;
+            // accum is present; check if C_in is full or bitmap.
+            bool C_is_full_or_bitmap = GB_IS_FULL (C_in) || GB_IS_BITMAP (C_in);
 
             // accum must be present, and must match the monoid of the
             // semiring, and the ztype of the monoid must match the type of C
@@ -190,7 +181,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // C += A*B with C_replace ignored (effectively false)
             // C<M> += A*B with C_replace false
             // C<!M> += A*B with C_replace false
-            can_do_in_place = C_is_full && accum_is_monoid
+            can_do_in_place = C_is_full_or_bitmap && accum_is_monoid
                 && ((M_in == NULL) || (M_in != NULL && !C_replace)) ;
         }
 
@@ -500,10 +491,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     if (can_do_in_place)
     {
         // C cannot be done in-place if it is aliased with any input matrix.
-        // Also cannot compute C in-place if it is to be transposed.
+        // Also cannot compute C in-place if it is to be transposed, or if it
+        // has any shallow components.
         bool C_aliased = GB_any_aliased (C_in, M) || GB_any_aliased (C_in, A) ||
             GB_any_aliased (C_in, B) ;
-        if (C_transpose || C_aliased)
+        if (C_transpose || C_aliased || GB_is_shallow (C_in))
         { 
             can_do_in_place = false ;
         }
@@ -675,12 +667,46 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // only use the dot product method if explicitly requested
             axb_method = GB_USE_DOT ;
         }
+        else if (AxB_method == GxB_DEFAULT && can_do_in_place)
+        {
+            // check if C will be iso on output
+            bool C_out_iso = GB_AxB_iso (NULL, A, B, A->vdim, semiring,
+                flipxy, false) ;
+            if (GB_AxB_outer_control (C_out_iso, C_in, M, accum, A, B,
+                semiring))
+            { 
+                // C+=A*B' via outer products, with no transpose of B
+                axb_method = GB_USE_OUTER ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // C+=A*B' via outer products
+        //----------------------------------------------------------------------
+
+        if (axb_method == GB_USE_OUTER)
+        {
+            GBURBLE ("C%s+=A*B', outer_product ", M_str) ;
+            (*mask_applied) = false ;    // no mask to apply
+            info = GB_AxB_outer (C_in, A, B, semiring, flipxy, done_in_place,
+                Werk) ;
+            if (info == GrB_NO_VALUE)
+            { 
+                // the outer-product kernel is not available; use saxpy
+                axb_method = GB_USE_SAXPY ;
+            }
+            else
+            { 
+                // C+=A*B' has been computed, or an error occurred
+                GB_OK (info) ;
+            }
+        }
 
         //----------------------------------------------------------------------
         // BT = B'
         //----------------------------------------------------------------------
 
-        if (axb_method != GB_USE_COLSCALE)
+        if (axb_method != GB_USE_COLSCALE && axb_method != GB_USE_OUTER)
         {
             // BT = B', or BT=one(B') if only the pattern of B is needed
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
@@ -699,6 +725,10 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 
         switch (axb_method)
         {
+            case GB_USE_OUTER : 
+                // C+=A*B' has already been computed in-place, above
+                break ;
+
             case GB_USE_COLSCALE : 
                 // C = A*D
                 GBURBLE ("C%s=A*B', colscale ", M_str) ;
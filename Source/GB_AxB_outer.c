@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+// GB_AxB_outer: compute C+=A*B' in-place, via outer products
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_outer computes C+=A*B' in a single phase, computing its result in
+// the input matrix C, which is full.  A and B are sparse or hypersparse, and
+// are used in their stored orientation, so B' is never formed.  The mask M is
+// not handled by this function.  C is not iso on output, but might be iso on
+// input (if so, C is converted from iso on input to non-iso on output).
+
+// The accum operator is the same as monoid operator semiring->add->op, and the
+// type of C (C->type) matches the accum->ztype so no typecasting is needed
+// from the monoid ztype to C.
+
+// The ANY monoid is not handled.
+
+// JIT: done.  There are no factory kernels and no generic method; if the JIT
+// is disabled or the kernel cannot be compiled, GrB_NO_VALUE is returned and
+// GB_AxB_meta uses the saxpy method with an explicit transpose of B instead.
+
+//------------------------------------------------------------------------------
+
+#include "GB_mxm.h"
+#include "GB_binop.h"
+#include "GB_stringify.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_phybix_free (C) ;                \
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_outer: compute C+=A*B' in-place
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_outer               // C+=A*B', outer-product method
+(
+    GrB_Matrix C,                   // input/output matrix, must be full
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C+=A*B' and accum
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    bool *done_in_place,            // if true, C has been computed
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (C, "C for outer in-place += A*B'", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for outer in-place += A*B'", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for outer in-place += A*B'", GB0) ;
+    ASSERT (GB_IS_FULL (C)) ;
+    ASSERT (!GB_ZOMBIES (C)) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (!GB_PENDING (C)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (GB_JUMBLED_OK (B)) ;
+    ASSERT (!GB_PENDING (B)) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for in-place += A*B'", GB0) ;
+    ASSERT (A->vdim == B->vdim) ;
+    ASSERT (C->vlen == A->vlen) ;
+    ASSERT (C->vdim == B->vlen) ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_Monoid add = semiring->add ;
+    ASSERT (semiring->multiply->ztype == add->op->ztype) ;
+    ASSERT (C->type     == add->op->ztype) ;
+
+    if (add->op->opcode == GB_ANY_binop_code)
+    {
+        // the ANY monoid is not handled
+        return (GrB_NO_VALUE) ;
+    }
+
+    GBURBLE ("(outer: %s += %s*%s') ",
+        GB_sparsity_char_matrix (C),
+        GB_sparsity_char_matrix (A),
+        GB_sparsity_char_matrix (B)) ;
+
+    //--------------------------------------------------------------------------
+    // finish B and construct the hyper_hash of A
+    //--------------------------------------------------------------------------
+
+    // B must not be jumbled, since each task does a binary search of B(:,k)
+    GB_MATRIX_WAIT (B) ;
+    GB_OK (GB_hyper_hash_build (A, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    // Each task owns a set of columns of C.  Every task visits all vectors of
+    // B, so the total work is O(flops + ntasks*bnvec*log(bnz/bnvec)).
+
+    int64_t anz = GB_nnz (A) ;
+    int64_t bnz = GB_nnz (B) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (anz + bnz, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, C->vdim) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // convert C to non-iso
+    //--------------------------------------------------------------------------
+
+    if (C->iso)
+    {
+        // C is expanded and initialized with its iso value, so C is valid
+        // even if the outer-product kernel is not available
+        GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // via the JIT or PreJIT kernel
+    //--------------------------------------------------------------------------
+
+    info = GB_AxB_outer_jit (C, A, B, semiring, flipxy, ntasks, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_NO_VALUE)
+    {
+        // the outer-product method doesn't handle this case; punt to saxpy
+        GBURBLE ("(punt) ") ;
+    }
+    else if (info == GrB_SUCCESS)
+    {
+        ASSERT_MATRIX_OK (C, "outer: output", GB0) ;
+        (*done_in_place) = true ;
+    }
+    else
+    {
+        // out of memory, or other error
+        GB_FREE_ALL ;
+    }
+    return (info) ;
+}
+
@@ -40,12 +40,16 @@
 // GB_AxB_saxbit: compute C=A*B, C<M>=A*B, or C<!M>=A*B
 //------------------------------------------------------------------------------
 
-// TODO: also pass in the user's C and the accum operator, and done_in_place,
-// like GB_AxB_dot4.
+// If C_in is present, C_in<#M>+=A*B is computed in-place instead, and the
+// output C is not used.  C_in is bitmap or full (and converted to bitmap), and
+// the accum operator matches the monoid (see GB_AxB_bitmap_in_place_control).
+// The saxbit kernels combine their results with any entries already present in
+// C_in via the monoid, and add new entries to its bitmap.
 
 GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // if present, compute C_in+=A*B in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M,             // optional mask matrix
@@ -84,6 +88,8 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 
     ASSERT_SEMIRING_OK (semiring, "semiring for bitmap saxpy A*B", GB0) ;
     ASSERT (A->vdim == B->vlen) ;
+    ASSERT_MATRIX_OK_OR_NULL (C_in, "C_in for bitmap saxpy A*B", GB0) ;
+    ASSERT (GB_IMPLIES (C_in != NULL, !C_iso)) ;
 
     //--------------------------------------------------------------------------
     // declare workspace
@@ -111,20 +117,39 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
     // construct C
     //--------------------------------------------------------------------------
 
-    // TODO: If C is the right type on input, and accum is the same as the
-    // monoid, then do not create C, but compute in-place instead.
+    GrB_Type ctype = semiring->add->op->ztype ;
 
-    // Cb is set to all zero.  C->x is malloc'd unless C is iso, in which case
-    // it is calloc'ed.
+    if (C_in != NULL)
+    { 
 
-    GrB_Type ctype = semiring->add->op->ztype ;
-    int64_t cnzmax = 1 ;
-    (void) GB_int64_multiply ((GrB_Index *) (&cnzmax), A->vlen, B->vdim) ;
-    // set C->iso = C_iso   OK
-    GB_OK (GB_new_bix (&C, // existing header
-        ctype, A->vlen, B->vdim, GB_Ap_null, true, GxB_BITMAP, true,
-        GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, C_iso)) ;
-    C->magic = GB_MAGIC ;
+        // C_in<#M>+=A*B is computed in-place; C_in must be bitmap and not iso
+        ASSERT (C_in->type == ctype) ;
+        ASSERT (C_in->vlen == A->vlen && C_in->vdim == B->vdim) ;
+        C = C_in ;
+        if (C->iso)
+        { 
+            GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        }
+        if (GB_IS_FULL (C))
+        { 
+            GB_OK (GB_convert_full_to_bitmap (C)) ;
+        }
+
+    }
+    else
+    { 
+
+        // Cb is set to all zero.  C->x is malloc'd unless C is iso, in which
+        // case it is calloc'ed.
+
+        int64_t cnzmax = 1 ;
+        (void) GB_int64_multiply ((GrB_Index *) (&cnzmax), A->vlen, B->vdim) ;
+        // set C->iso = C_iso   OK
+        GB_OK (GB_new_bix (&C, // existing header
+            ctype, A->vlen, B->vdim, GB_Ap_null, true, GxB_BITMAP, true,
+            GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, C_iso)) ;
+        C->magic = GB_MAGIC ;
+    }
 
     //--------------------------------------------------------------------------
     // get the semiring operators
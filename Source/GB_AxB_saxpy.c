@@ -11,8 +11,6 @@
 #include "GB_AxB_saxpy.h"
 #include "GB_stringify.h"
 
-// TODO: allow bitmap multiply to work in-place as well
-
 GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 (
     GrB_Matrix C,                   // output, static header
@@ -234,25 +232,32 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 
         ASSERT (C_sparsity == GxB_BITMAP) ;
 
+        // C_in<#M>+=A*B can be computed in-place if C_in is bitmap or full
+        bool in_place = (C_in != NULL)
+            && GB_AxB_bitmap_in_place_control (C_iso, C_in, accum, semiring) ;
+
         if ((GB_IS_BITMAP (A) || GB_IS_FULL (A)) &&
             (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
         { 
             // C<#M> = A*B via dot products, where A is bitmap or full and B is
             // sparse or hypersparse, using the dot2 method with A not
-            // explicitly transposed.
-            info = GB_AxB_dot2 (C, C_iso, cscalar, M, Mask_comp, Mask_struct,
-                true, A, B, semiring, flipxy, Werk) ;
+            // explicitly transposed.  C_in+=A*B is computed in-place only if
+            // no mask is present and B is sparse.
+            in_place = in_place && (M == NULL) && GB_IS_SPARSE (B) ;
+            info = GB_AxB_dot2 (C, in_place ? C_in : NULL, C_iso, cscalar,
+                M, Mask_comp, Mask_struct, true, A, B, semiring, flipxy, Werk) ;
         }
         else
         { 
 
             // C<#M> = A*B via bitmap saxpy method
-            info = GB_AxB_saxbit (C, C_iso, cscalar, M,
-                Mask_comp, Mask_struct, A, B, semiring, flipxy, Werk) ;
+            info = GB_AxB_saxbit (C, in_place ? C_in : NULL, C_iso, cscalar,
+                M, Mask_comp, Mask_struct, A, B, semiring, flipxy, Werk) ;
         }
 
         // the mask is always applied if present
         (*mask_applied) = (M != NULL && info == GrB_SUCCESS) ;
+        (*done_in_place) = in_place && (info == GrB_SUCCESS) ;
     }
 
     return (info) ;
@@ -103,6 +103,7 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
 GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // if present, compute C_in+=A*B in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M,             // optional mask matrix
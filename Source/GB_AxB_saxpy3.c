@@ -289,14 +289,32 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             Werk) ;
     }
     else
-    { 
-        // Do the flopcount analysis and create a set of well-balanced tasks in
-        // the general case.  This may select a single task for a single thread
-        // anyway, but this decision would be based on the analysis.
-        info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B, AxB_method,
-            builtin_semiring,
+    {
+        // Reuse the tasks from a prior C=A*B with the same patterns of A, B,
+        // and M, if available.
+        bool found ;
+        info = GB_AxB_saxpy3_schedule_get (&found,
             &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
-            &ntasks, &nfine, &nthreads, Werk) ;
+            &ntasks, &nfine, &nthreads,
+            M, Mask_comp, A, B, AxB_method, builtin_semiring) ;
+        if (info == GrB_SUCCESS && !found)
+        {
+            // Do the flopcount analysis and create a set of well-balanced
+            // tasks in the general case.  This may select a single task for a
+            // single thread anyway, but this decision would be based on the
+            // analysis.
+            info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B,
+                AxB_method, builtin_semiring,
+                &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
+                &ntasks, &nfine, &nthreads, Werk) ;
+            if (info == GrB_SUCCESS)
+            {
+                // keep the tasks in B for the next C=A*B
+                GB_AxB_saxpy3_schedule_put (SaxpyTasks, apply_mask,
+                    M_in_place, ntasks, nfine, nthreads,
+                    M, Mask_comp, A, B, AxB_method, builtin_semiring) ;
+            }
+        }
     }
 
     if (info == GrB_NO_VALUE)
@@ -584,10 +602,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // phase1: symbolic analysis
     //==========================================================================
 
-    // TODO constructing the tasks (the work above) can take a lot of time.
-    // See the web graph, where it takes a total of 3.03 sec for 64 trials, vs
-    // a total of 5.9 second for phase 7 (the numerical work below).
-    // Figure out a faster method.
+    // Constructing the tasks (the work above) can take a lot of time; see
+    // the web graph, where it takes a total of 3.03 sec for 64 trials, vs a
+    // total of 5.9 second for phase 7 (the numerical work below).  The tasks
+    // are cached in B->saxpy3_schedule and reused when the patterns of A, B,
+    // and M do not change (see GB_AxB_saxpy3_schedule.c).
 
     GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
         A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
@@ -50,6 +50,15 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // sums its computations in a hash table shared by all fine tasks that compute
 // C(:,j), via atomics.  The vector index j is GBH (Bh, kk).
 
+// An ultra-fine task is a fine task that computes A(i1:i2,k)*B(k,j) for a
+// single entry B(k,j), where SaxpyTasks [taskid].start and .end are both the
+// position of B(k,j), and the entries A(i1:i2,k) are in positions
+// SaxpyTasks [taskid].pA to SaxpyTasks [taskid].pA_end-1 of A.  It is used
+// when A(:,k)*B(k,j) is too costly for a single task, which occurs if A(:,k)
+// has many entries (a hub vertex in a power-law graph, for example).  The
+// team of fine tasks for C(:,j) can be a mix of fine and ultra-fine tasks, all
+// sharing the same hash table.  For all other tasks, pA and pA_end are -1.
+
 // Both tasks use a hash table allocated uniquely for the task, in Hi, Hf, and
 // Hx.  The size of the hash table is determined by the maximum # of flops
 // needed to compute any vector in C(:,j1:j2) for a coarse task, or the entire
@@ -107,6 +116,92 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_saxpy3_schedule_struct: cached tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+// Constructing the tasks in GB_AxB_saxpy3_slice_balanced can take a large
+// fraction of the total time for C=A*B, since it requires the flop count of
+// each vector of C.  The tasks depend only on the patterns of A, B, and M
+// (not their values), and on a few control parameters.  The last set of tasks
+// constructed for B is kept in B->saxpy3_schedule, along with a key that
+// describes the inputs, and is reused for the next C=A*B with the same key.
+
+// The pattern of each of A, B, and M is described by its pattern_version,
+// nvals, nvec, vlen, and vdim, and the addresses of its p, h, and i arrays.
+// The pattern_version alone suffices; the rest of the description is a
+// safeguard.
+
+typedef struct
+{
+    int64_t pattern [3][8] ;    // patterns of A, B, and M
+    int64_t Mask_comp ;         // if true, M is complemented
+    int64_t AxB_method ;        // Default, Gustavson, or Hash
+    int64_t builtin_semiring ;  // if true, the semiring is builtin
+    int64_t nthreads_max ;      // max # of threads from the Context
+    double  chunk ;             // chunk size from the Context
+    int64_t very_costly ;       // GB_Global_hack_get (0)
+}
+GB_saxpy3_key ;
+
+struct GB_saxpy3_schedule_struct    // content of B->saxpy3_schedule
+{
+    size_t header_size ;        // size of the malloc'd block for this struct
+    GB_saxpy3_key key ;         // the inputs that defined the tasks
+    GB_saxpy3task_struct *SaxpyTasks ;  // tasks, without their hash tables
+    size_t SaxpyTasks_size ;
+    int ntasks ;                // # of tasks (coarse and fine)
+    int nfine ;                 // # of fine tasks
+    int nthreads ;              // # of threads to use
+    bool apply_mask ;           // if true, apply M during saxpy3
+    bool M_in_place ;           // if true, use M in-place
+} ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_schedule_get: find cached tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_schedule_get
+(
+    // outputs
+    bool *found,                    // true if the cached tasks can be used
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks (coarse and fine)
+    int *nfine,                     // # of fine tasks
+    int *nthreads,                  // # of threads to use
+    // inputs
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    bool builtin_semiring           // if true, semiring is builtin
+) ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_schedule_put: cache the tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_schedule_put
+(
+    // inputs
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const bool apply_mask,          // if true, apply M during sapxy3
+    const bool M_in_place,          // if true, use M in-place
+    const int ntasks,               // # of tasks (coarse and fine)
+    const int nfine,                // # of fine tasks
+    const int nthreads,             // # of threads to use
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, schedule kept here
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    bool builtin_semiring           // if true, semiring is builtin
+) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_slice_quick: create a single sequential task for saxpy3
 //------------------------------------------------------------------------------
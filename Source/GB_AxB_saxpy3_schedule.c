@@ -0,0 +1,338 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_schedule: cache and reuse the tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The tasks constructed by GB_AxB_saxpy3_slice_balanced for C=A*B, C<M>=A*B,
+// or C<!M>=A*B are kept in B->saxpy3_schedule, and reused if the same product
+// is computed again and none of the patterns of A, B, or M have changed.  This
+// is common in iterative algorithms, where the matrices keep their pattern
+// but not their values from one iteration to the next.
+
+// Only the tasks are cached.  The symbolic analysis (the pattern of C) is
+// computed by the saxpy3 kernels at the same time as the numerical values, and
+// it may depend on the values of M, so it is always recomputed.
+
+// Only sparse and hypersparse matrices are considered, since the pattern of a
+// bitmap matrix can change in place without changing its pattern_version.
+// B must own its pattern, since a matrix with shallow content might not be
+// freed with GB_phybix_free, which is required to free B->saxpy3_schedule.
+
+// B is an input matrix, so it may be used by many user threads at the same
+// time, and each of them can look up or replace B->saxpy3_schedule.  A user
+// thread takes the schedule out of B before using it, and puts it back when
+// done, so only one user thread at a time can hold it; any other user thread
+// finds no cached tasks and constructs its own.  The pointer itself is only
+// read or written inside the GB_saxpy3_schedule critical section.
+
+#include "GB_AxB_saxpy3.h"
+
+//------------------------------------------------------------------------------
+// GB_saxpy3_schedule_swap: replace B->saxpy3_schedule, and return the old one
+//------------------------------------------------------------------------------
+
+static inline GB_saxpy3_schedule GB_saxpy3_schedule_swap
+(
+    const GrB_Matrix B,
+    GB_saxpy3_schedule S            // new schedule for B, may be NULL
+)
+{
+    GB_saxpy3_schedule S_old ;
+    #pragma omp critical (GB_saxpy3_schedule)
+    { 
+        S_old = B->saxpy3_schedule ;
+        B->saxpy3_schedule = S ;
+    }
+    return (S_old) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_saxpy3_schedule_free_worker: free a schedule held by no matrix
+//------------------------------------------------------------------------------
+
+static void GB_saxpy3_schedule_free_worker (GB_saxpy3_schedule *S_handle)
+{
+    GB_saxpy3_schedule S = (*S_handle) ;
+    if (S != NULL)
+    { 
+        GB_FREE (&(S->SaxpyTasks), S->SaxpyTasks_size) ;
+        GB_FREE (S_handle, S->header_size) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_saxpy3_schedule_return: give a schedule back to B
+//------------------------------------------------------------------------------
+
+static inline void GB_saxpy3_schedule_return
+(
+    const GrB_Matrix B,
+    GB_saxpy3_schedule S
+)
+{
+    // if another user thread has cached a schedule in B in the meantime, it
+    // is replaced with S
+    GB_saxpy3_schedule S_other = GB_saxpy3_schedule_swap (B, S) ;
+    GB_saxpy3_schedule_free_worker (&S_other) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_saxpy3_schedule_ok: determine if the tasks can be cached
+//------------------------------------------------------------------------------
+
+static inline bool GB_saxpy3_schedule_ok
+(
+    const GrB_Matrix M,
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+    return ((GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) &&
+            (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) &&
+            (M == NULL || GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) &&
+            A->pattern_version != 0 && B->pattern_version != 0 &&
+            (M == NULL || M->pattern_version != 0) &&
+            !B->p_shallow && !B->h_shallow && !B->i_shallow) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_saxpy3_pattern: describe the pattern of a matrix
+//------------------------------------------------------------------------------
+
+static inline void GB_saxpy3_pattern
+(
+    int64_t *pattern,           // size 8
+    const GrB_Matrix A          // matrix to describe, or NULL
+)
+{
+    if (A != NULL)
+    { 
+        pattern [0] = A->pattern_version ;
+        pattern [1] = GB_nnz (A) ;
+        pattern [2] = A->nvec ;
+        pattern [3] = A->vlen ;
+        pattern [4] = A->vdim ;
+        pattern [5] = (int64_t) ((uintptr_t) A->p) ;
+        pattern [6] = (int64_t) ((uintptr_t) A->h) ;
+        pattern [7] = (int64_t) ((uintptr_t) A->i) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_saxpy3_key_construct: construct the key for C=A*B
+//------------------------------------------------------------------------------
+
+static void GB_saxpy3_key_construct
+(
+    GB_saxpy3_key *key,
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GrB_Desc_Value AxB_method,
+    bool builtin_semiring
+)
+{
+    // clear the whole key so that it can be compared with memcmp
+    memset (key, 0, sizeof (GB_saxpy3_key)) ;
+    GB_saxpy3_pattern (key->pattern [0], A) ;
+    GB_saxpy3_pattern (key->pattern [1], B) ;
+    GB_saxpy3_pattern (key->pattern [2], M) ;
+    key->Mask_comp = (M != NULL) && Mask_comp ;
+    key->AxB_method = (int64_t) AxB_method ;
+    key->builtin_semiring = builtin_semiring ;
+    key->nthreads_max = GB_Context_nthreads_max ( ) ;
+    key->chunk = GB_Context_chunk ( ) ;
+    key->very_costly = GB_Global_hack_get (0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_schedule_get: find cached tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+// If the tasks are found, a copy is returned in SaxpyTasks, which is freed by
+// the caller with GB_FREE_WORK.  The hash tables of each task must then be
+// assigned by the caller, as they are for the tasks constructed by
+// GB_AxB_saxpy3_slice_balanced.
+
+GrB_Info GB_AxB_saxpy3_schedule_get
+(
+    // outputs
+    bool *found,                    // true if the cached tasks can be used
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks (coarse and fine)
+    int *nfine,                     // # of fine tasks
+    int *nthreads,                  // # of threads to use
+    // inputs
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    bool builtin_semiring           // if true, semiring is builtin
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    (*found) = false ;
+    if (!GB_saxpy3_schedule_ok (M, A, B))
+    { 
+        // the tasks cannot be cached
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // take the cached tasks from B
+    //--------------------------------------------------------------------------
+
+    GB_saxpy3_schedule S = GB_saxpy3_schedule_swap (B, NULL) ;
+    if (S == NULL)
+    { 
+        // no tasks are cached for B, or another user thread is using them
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compare the key with the key of the cached tasks
+    //--------------------------------------------------------------------------
+
+    GB_saxpy3_key key ;
+    GB_saxpy3_key_construct (&key, M, Mask_comp, A, B, AxB_method,
+        builtin_semiring) ;
+    if (memcmp (&key, &(S->key), sizeof (GB_saxpy3_key)) != 0)
+    { 
+        // the cached tasks are for a different problem
+        GB_saxpy3_schedule_return (B, S) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return a copy of the cached tasks
+    //--------------------------------------------------------------------------
+
+    size_t SaxpyTasks_size = 0 ;
+    GB_saxpy3task_struct *SaxpyTasks = GB_MALLOC_WORK (S->ntasks,
+        GB_saxpy3task_struct, &SaxpyTasks_size) ;
+    if (SaxpyTasks == NULL)
+    { 
+        // out of memory
+        GB_saxpy3_schedule_return (B, S) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    memcpy (SaxpyTasks, S->SaxpyTasks,
+        S->ntasks * sizeof (GB_saxpy3task_struct)) ;
+
+    GBURBLE ("(cached schedule) ") ;
+    (*found) = true ;
+    (*SaxpyTasks_handle) = SaxpyTasks ;
+    (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
+    (*apply_mask) = S->apply_mask ;
+    (*M_in_place) = S->M_in_place ;
+    (*ntasks) = S->ntasks ;
+    (*nfine) = S->nfine ;
+    (*nthreads) = S->nthreads ;
+    GB_saxpy3_schedule_return (B, S) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_schedule_put: cache the tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+// The tasks must not yet have their hash tables assigned.  Any prior tasks
+// cached in B are replaced.  The cache is optional, so if out of memory, no
+// tasks are cached and no error is returned.
+
+void GB_AxB_saxpy3_schedule_put
+(
+    // inputs
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const bool apply_mask,          // if true, apply M during sapxy3
+    const bool M_in_place,          // if true, use M in-place
+    const int ntasks,               // # of tasks (coarse and fine)
+    const int nfine,                // # of fine tasks
+    const int nthreads,             // # of threads to use
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, schedule kept here
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    bool builtin_semiring           // if true, semiring is builtin
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (!GB_saxpy3_schedule_ok (M, A, B) || ntasks <= 0)
+    { 
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the schedule
+    //--------------------------------------------------------------------------
+
+    size_t header_size = 0, SaxpyTasks_size = 0 ;
+    GB_saxpy3_schedule S = GB_MALLOC (1, struct GB_saxpy3_schedule_struct,
+        &header_size) ;
+    if (S == NULL)
+    { 
+        // out of memory; do not cache the tasks
+        return ;
+    }
+    S->header_size = header_size ;
+    S->SaxpyTasks = GB_MALLOC (ntasks, GB_saxpy3task_struct, &SaxpyTasks_size) ;
+    S->SaxpyTasks_size = SaxpyTasks_size ;
+    if (S->SaxpyTasks == NULL)
+    { 
+        // out of memory; do not cache the tasks
+        GB_FREE (&S, header_size) ;
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // save the tasks and their key in B
+    //--------------------------------------------------------------------------
+
+    GB_saxpy3_key_construct (&(S->key), M, Mask_comp, A, B, AxB_method,
+        builtin_semiring) ;
+    memcpy (S->SaxpyTasks, SaxpyTasks, ntasks * sizeof (GB_saxpy3task_struct));
+    S->ntasks = ntasks ;
+    S->nfine = nfine ;
+    S->nthreads = nthreads ;
+    S->apply_mask = apply_mask ;
+    S->M_in_place = M_in_place ;
+    GB_saxpy3_schedule_return (B, S) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_schedule_free: free A->saxpy3_schedule of a matrix
+//------------------------------------------------------------------------------
+
+// A is being modified or freed, so no other user thread can be using it.
+
+void GB_AxB_saxpy3_schedule_free    // free A->saxpy3_schedule of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+)
+{
+
+    if (A != NULL)
+    { 
+        GB_saxpy3_schedule_free_worker (&(A->saxpy3_schedule)) ;
+    }
+}
@@ -27,6 +27,9 @@
     GB_WERK_POP (Fine_fl, int64_t) ;        \
     GB_WERK_POP (Fine_slice, int64_t) ;     \
     GB_WERK_POP (Coarse_Work, int64_t) ;    \
+    GB_WERK_POP (Initial_bjnz, int64_t) ;   \
+    GB_WERK_POP (Initial_nfine, int64_t) ;  \
+    GB_WERK_POP (Initial_ncoarse, int64_t) ;\
     GB_WERK_POP (Coarse_initial, int64_t) ; \
 }
 
@@ -134,28 +137,41 @@ static inline void GB_create_coarse_task
 
     int64_t nk = klast - kfirst + 1 ;
     int nth = GB_nthreads (nk, chunk, nthreads_max) ;
+    int64_t flmax = 1 ;
 
-    // each thread finds the max flop count for a subset of the vectors
-    int tid ;
-    #pragma omp parallel for num_threads(nth) schedule(static)
-    for (tid = 0 ; tid < nth ; tid++)
+    if (nth == 1)
     {
-        int64_t my_flmax = 1, istart, iend ;
-        GB_PARTITION (istart, iend, nk, tid, nth) ;
-        for (int64_t i = istart ; i < iend ; i++)
+        // a single thread finds the max flop count, without Coarse_Work, so
+        // that many coarse tasks can be created in parallel
+        for (int64_t kk = kfirst ; kk <= klast ; kk++)
         { 
-            int64_t kk = kfirst + i ;
             int64_t fl = Bflops [kk+1] - Bflops [kk] ;
-            my_flmax = GB_IMAX (my_flmax, fl) ;
+            flmax = GB_IMAX (flmax, fl) ;
         }
-        Coarse_Work [tid] = my_flmax ;
     }
+    else
+    {
+        // each thread finds the max flop count for a subset of the vectors
+        int tid ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (tid = 0 ; tid < nth ; tid++)
+        {
+            int64_t my_flmax = 1, istart, iend ;
+            GB_PARTITION (istart, iend, nk, tid, nth) ;
+            for (int64_t i = istart ; i < iend ; i++)
+            { 
+                int64_t kk = kfirst + i ;
+                int64_t fl = Bflops [kk+1] - Bflops [kk] ;
+                my_flmax = GB_IMAX (my_flmax, fl) ;
+            }
+            Coarse_Work [tid] = my_flmax ;
+        }
 
-    // combine results from each thread
-    int64_t flmax = 1 ;
-    for (tid = 0 ; tid < nth ; tid++)
-    { 
-        flmax = GB_IMAX (flmax, Coarse_Work [tid]) ;
+        // combine results from each thread
+        for (tid = 0 ; tid < nth ; tid++)
+        { 
+            flmax = GB_IMAX (flmax, Coarse_Work [tid]) ;
+        }
     }
 
     // check the parallel computation
@@ -176,6 +192,8 @@ static inline void GB_create_coarse_task
     SaxpyTasks [taskid].start  = kfirst ;
     SaxpyTasks [taskid].end    = klast ;
     SaxpyTasks [taskid].vector = -1 ;
+    SaxpyTasks [taskid].pA     = -1 ;
+    SaxpyTasks [taskid].pA_end = -1 ;
     SaxpyTasks [taskid].hsize  = GB_hash_table_size (flmax, cvlen, AxB_method) ;
     SaxpyTasks [taskid].Hi     = NULL ;      // assigned later
     SaxpyTasks [taskid].Hf     = NULL ;      // assigned later
@@ -259,6 +277,9 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     size_t SaxpyTasks_size = 0 ;
 
     GB_WERK_DECLARE (Coarse_initial, int64_t) ; // initial coarse tasks
+    GB_WERK_DECLARE (Initial_ncoarse, int64_t) ;    // # coarse tasks in each
+    GB_WERK_DECLARE (Initial_nfine, int64_t) ;      // # fine tasks in each
+    GB_WERK_DECLARE (Initial_bjnz, int64_t) ;       // max_bjnz of each
     GB_WERK_DECLARE (Coarse_Work, int64_t) ;    // workspace for flop counts
     GB_WERK_DECLARE (Fine_slice, int64_t) ;
     GB_WERK_DECLARE (Fine_fl, int64_t) ;        // size max(nnz(B(:,j)))
@@ -468,8 +489,6 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     int ncoarse = 0 ;       // # of coarse tasks
     int max_bjnz = 0 ;      // max (nnz (B (:,j))) of fine tasks
 
-    // FUTURE: also use ultra-fine tasks that compute A(i1:i2,k)*B(k,j)
-
     if (ntasks_initial > 1)
     {
 
@@ -478,7 +497,11 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         //----------------------------------------------------------------------
 
         GB_WERK_PUSH (Coarse_initial, ntasks_initial + 1, int64_t) ;
-        if (Coarse_initial == NULL)
+        GB_WERK_PUSH (Initial_ncoarse, ntasks_initial + 1, int64_t) ;
+        GB_WERK_PUSH (Initial_nfine, ntasks_initial + 1, int64_t) ;
+        GB_WERK_PUSH (Initial_bjnz, ntasks_initial, int64_t) ;
+        if (Coarse_initial == NULL || Initial_ncoarse == NULL ||
+            Initial_nfine == NULL || Initial_bjnz == NULL)
         { 
             // out of memory
             GB_FREE_ALL ;
@@ -490,13 +513,23 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         // split the work into coarse and fine tasks
         //----------------------------------------------------------------------
 
-        for (int taskid = 0 ; taskid < ntasks_initial ; taskid++)
+        // Each initial coarse task is split independently of the others, so
+        // they are all examined in parallel.  The tasks they create are
+        // counted, and the counts are summed below to find where each initial
+        // coarse task places its coarse and fine tasks.
+
+        int nth_initial = GB_nthreads (bnvec, chunk, nthreads_max) ;
+        nth_initial = GB_IMIN (nth_initial, ntasks_initial) ;
+        int taskid ;
+        #pragma omp parallel for num_threads(nth_initial) schedule(dynamic,1)
+        for (taskid = 0 ; taskid < ntasks_initial ; taskid++)
         {
             // get the initial coarse task
             int64_t kfirst = Coarse_initial [taskid] ;
             int64_t klast  = Coarse_initial [taskid+1] ;
             int64_t task_ncols = klast - kfirst ;
             double task_flops = (double) (Bflops [klast] - Bflops [kfirst]) ;
+            int64_t my_ncoarse = 0, my_nfine = 0, my_max_bjnz = 0 ;
 
             if (task_ncols == 0)
             { 
@@ -519,7 +552,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = (Bp == NULL) ? bvlen : (Bp [kk+1] - Bp [kk]);
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
@@ -527,16 +560,16 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                         { 
                             // vectors kcoarse_start to kk-1 form a single
                             // coarse task
-                            ncoarse++ ;
+                            my_ncoarse++ ;
                         }
 
                         // next coarse task (if any) starts at kk+1
                         kcoarse_start = kk+1 ;
 
                         // vectors kk will be split into multiple fine tasks
-                        max_bjnz = GB_IMAX (max_bjnz, bjnz) ;
+                        my_max_bjnz = GB_IMAX (my_max_bjnz, bjnz) ;
                         int team_size = ceil (jflops / target_fine_size) ;
-                        (*nfine) += team_size ;
+                        my_nfine += team_size ;
                     }
                 }
 
@@ -545,16 +578,39 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                 { 
                     // vectors kcoarse_start to klast-1 form a single
                     // coarse task
-                    ncoarse++ ;
+                    my_ncoarse++ ;
                 }
 
             }
             else
             { 
                 // This coarse task is OK as-is.
-                ncoarse++ ;
+                my_ncoarse++ ;
             }
+
+            Initial_ncoarse [taskid] = my_ncoarse ;
+            Initial_nfine [taskid] = my_nfine ;
+            Initial_bjnz [taskid] = my_max_bjnz ;
+        }
+
+        // cumulative sum of the counts: the coarse tasks of the initial task
+        // taskid start at Initial_ncoarse [taskid] (offset by nfine, below),
+        // and its fine tasks start at Initial_nfine [taskid].
+        int64_t nc = 0, nf = 0 ;
+        for (taskid = 0 ; taskid < ntasks_initial ; taskid++)
+        { 
+            int64_t c = Initial_ncoarse [taskid] ;
+            int64_t f = Initial_nfine [taskid] ;
+            Initial_ncoarse [taskid] = nc ;
+            Initial_nfine [taskid] = nf ;
+            nc += c ;
+            nf += f ;
+            max_bjnz = GB_IMAX (max_bjnz, Initial_bjnz [taskid]) ;
         }
+        Initial_ncoarse [ntasks_initial] = nc ;
+        Initial_nfine [ntasks_initial] = nf ;
+        ncoarse = (int) nc ;
+        (*nfine) = (int) nf ;
     }
     else
     { 
@@ -610,16 +666,44 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         // create the coarse and fine tasks
         //----------------------------------------------------------------------
 
-        int nf = 0 ;            // fine tasks have task id 0:nfine-1
-        int nc = (*nfine) ;     // coarse task ids are nfine:ntasks-1
+        // Fine tasks have task id 0:nfine-1, and coarse task ids are
+        // nfine:ntasks-1.  First, create the initial coarse tasks that do not
+        // need to be split, all in parallel, with one thread for each task.
+
+        const int nfine_total = (*nfine) ;
+        int nth_initial = GB_nthreads (bnvec, chunk, nthreads_max) ;
+        nth_initial = GB_IMIN (nth_initial, ntasks_initial) ;
+        int taskid ;
+        #pragma omp parallel for num_threads(nth_initial) schedule(dynamic,1)
+        for (taskid = 0 ; taskid < ntasks_initial ; taskid++)
+        {
+            int64_t kfirst = Coarse_initial [taskid] ;
+            int64_t klast  = Coarse_initial [taskid+1] ;
+            double task_flops = (double) (Bflops [klast] - Bflops [kfirst]) ;
+            if (klast > kfirst &&
+                !(task_flops > very_costly * GB_COSTLY * target_task_size))
+            { 
+                // This coarse task is OK as-is.
+                int nc = nfine_total + Initial_ncoarse [taskid] ;
+                GB_create_coarse_task (kfirst, klast-1, SaxpyTasks, nc,
+                    Bflops, cvlen, chunk, 1, Coarse_Work, AxB_method) ;
+            }
+        }
+
+        // Next, split each costly initial coarse task into a mixture of coarse
+        // and fine tasks.  These are handled one at a time, since each of them
+        // uses all the threads.
 
-        for (int taskid = 0 ; taskid < ntasks_initial ; taskid++)
+        int64_t nultra_total = 0 ;
+        for (taskid = 0 ; taskid < ntasks_initial ; taskid++)
         {
             // get the initial coarse task
             int64_t kfirst = Coarse_initial [taskid] ;
             int64_t klast  = Coarse_initial [taskid+1] ;
             int64_t task_ncols = klast - kfirst ;
             double task_flops = (double) (Bflops [klast] - Bflops [kfirst]) ;
+            int nf = Initial_nfine [taskid] ;
+            int nc = nfine_total + Initial_ncoarse [taskid] ;
 
             if (task_ncols == 0)
             { 
@@ -641,7 +725,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = (Bp == NULL) ? bvlen : (Bp [kk+1] - Bp [kk]);
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
@@ -696,10 +780,22 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                         // cumulative sum of flops to compute A*B(:,j)
                         GB_cumsum (Fine_fl, bjnz, NULL, nth, Werk) ;
 
-                        // slice B(:,j) into fine tasks
+                        // slice B(:,j) into fine tasks.  Fine task fid owns
+                        // the entries B(k,j) whose work starts in the range
+                        // fid*fl/team_size to (fid+1)*fl/team_size-1.
                         int team_size = ceil (jflops / target_fine_size) ;
                         ASSERT (Fine_slice != NULL) ;
-                        GB_pslice (Fine_slice, Fine_fl, bjnz, team_size, false);
+                        double fl = (double) Fine_fl [bjnz] ;
+                        Fine_slice [0] = 0 ;
+                        for (int fid = 1 ; fid < team_size ; fid++)
+                        { 
+                            double target = (fid * fl) / team_size ;
+                            int64_t pleft = 0, pright = bjnz ;
+                            GB_TRIM_BINARY_SEARCH (target, Fine_fl, pleft,
+                                pright) ;
+                            Fine_slice [fid] = pleft ;
+                        }
+                        Fine_slice [team_size] = bjnz ;
 
                         // shared hash table for all fine tasks for A*B(:,j)
                         int64_t hsize = 
@@ -707,23 +803,121 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
                         // construct the fine tasks for C(:,j)=A*B(:,j)
                         int leader = nf ;
-                        for (int fid = 0 ; fid < team_size ; fid++)
-                        { 
+                        for (int fid = 0 ; fid < team_size ; )
+                        {
                             int64_t pstart = Fine_slice [fid] ;
                             int64_t pend   = Fine_slice [fid+1] ;
-                            int64_t fl = Fine_fl [pend] - Fine_fl [pstart] ;
-                            SaxpyTasks [nf].start  = pB_start + pstart ;
-                            SaxpyTasks [nf].end    = pB_start + pend - 1 ;
-                            SaxpyTasks [nf].vector = kk ;
-                            SaxpyTasks [nf].hsize  = hsize ;
-                            SaxpyTasks [nf].Hi = NULL ;   // assigned later
-                            SaxpyTasks [nf].Hf = NULL ;   // assigned later
-                            SaxpyTasks [nf].Hx = NULL ;   // assigned later
-                            SaxpyTasks [nf].my_cjnz = 0 ;
-                            SaxpyTasks [nf].leader = leader ;
-                            SaxpyTasks [nf].team_size = team_size ;
-                            nf++ ;
+
+                            // count the empty fine tasks that follow this one
+                            int nempty = 0 ;
+                            if (pstart < pend)
+                            {
+                                while (fid + nempty + 1 < team_size &&
+                                    Fine_slice [fid + nempty + 1] ==
+                                    Fine_slice [fid + nempty + 2])
+                                { 
+                                    nempty++ ;
+                                }
+                            }
+
+                            // If any fine tasks are empty, the work for the
+                            // last entry B(k,j) of this task spans all of
+                            // them, since no entry starts in their range.
+                            // A(:,k)*B(k,j) is then split into ultra-fine
+                            // tasks that compute A(i1:i2,k)*B(k,j).
+                            int64_t pA = -1, pA_end = -1, aknz = 0 ;
+                            if (nempty > 0)
+                            {
+                                int64_t pB = pB_start + pend - 1 ;
+                                if (GBB (Bb, pB))
+                                {
+                                    int64_t k = GBI (Bi, pB, bvlen) ;
+                                    if (A_is_hyper)
+                                    { 
+                                        GB_hyper_hash_lookup (Ah, anvec, Ap,
+                                            A_Yp, A_Yi, A_Yx, A_hash_bits, k,
+                                            &pA, &pA_end) ;
+                                    }
+                                    else
+                                    { 
+                                        pA     = GBP (Ap, k  , avlen) ;
+                                        pA_end = GBP (Ap, k+1, avlen) ;
+                                    }
+                                    aknz = pA_end - pA ;
+                                }
+                            }
+
+                            if (aknz <= 1)
+                            { 
+
+                                //----------------------------------------------
+                                // fine task for B(pstart:pend-1,j)
+                                //----------------------------------------------
+
+                                // the following nempty tasks remain empty
+                                for (int t = 0 ; t <= nempty ; t++)
+                                {
+                                    int64_t p1 = (t == 0) ? pstart : pend ;
+                                    SaxpyTasks [nf].start  = pB_start + p1 ;
+                                    SaxpyTasks [nf].end    = pB_start + pend-1;
+                                    SaxpyTasks [nf].pA     = -1 ;
+                                    SaxpyTasks [nf].pA_end = -1 ;
+                                    nf++ ;
+                                }
+
+                            }
+                            else
+                            {
+
+                                //----------------------------------------------
+                                // fine task, then ultra-fine tasks for B(k,j)
+                                //----------------------------------------------
+
+                                int nultra = nempty ;
+                                if (pstart < pend - 1)
+                                { 
+                                    // fine task for B(pstart:pend-2,j)
+                                    SaxpyTasks [nf].start  = pB_start + pstart ;
+                                    SaxpyTasks [nf].end    = pB_start + pend-2;
+                                    SaxpyTasks [nf].pA     = -1 ;
+                                    SaxpyTasks [nf].pA_end = -1 ;
+                                    nf++ ;
+                                }
+                                else
+                                { 
+                                    // B(k,j) is the only entry in this task
+                                    nultra++ ;
+                                }
+
+                                nultra_total += nultra ;
+                                for (int t = 0 ; t < nultra ; t++)
+                                { 
+                                    // ultra-fine task for A(i1:i2,k)*B(k,j)
+                                    int64_t a1, a2 ;
+                                    GB_PARTITION (a1, a2, aknz, t, nultra) ;
+                                    SaxpyTasks [nf].start  = pB_start + pend-1;
+                                    SaxpyTasks [nf].end    = pB_start + pend-1;
+                                    SaxpyTasks [nf].pA     = pA + a1 ;
+                                    SaxpyTasks [nf].pA_end = pA + a2 ;
+                                    nf++ ;
+                                }
+                            }
+                            fid += nempty + 1 ;
+                        }
+
+                        // finalize the team of fine tasks for C(:,j)
+                        for (int fid = leader ; fid < nf ; fid++)
+                        { 
+                            SaxpyTasks [fid].vector = kk ;
+                            SaxpyTasks [fid].hsize  = hsize ;
+                            SaxpyTasks [fid].Hi = NULL ;  // assigned later
+                            SaxpyTasks [fid].Hf = NULL ;  // assigned later
+                            SaxpyTasks [fid].Hx = NULL ;  // assigned later
+                            SaxpyTasks [fid].my_cjnz = 0 ;
+                            SaxpyTasks [fid].leader = leader ;
+                            SaxpyTasks [fid].team_size = team_size ;
                         }
+                        ASSERT (nf == leader + team_size) ;
                     }
                 }
 
@@ -736,16 +930,21 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                         Coarse_Work, AxB_method) ;
                 }
 
+                // all tasks for this initial coarse task have been created
+                ASSERT (nf == Initial_nfine [taskid+1]) ;
+                ASSERT (nc == nfine_total + Initial_ncoarse [taskid+1]) ;
             }
             else
             { 
-                // This coarse task is OK as-is.
-                GB_create_coarse_task (kfirst, klast-1, SaxpyTasks,
-                    nc++, Bflops, cvlen, chunk, nthreads_max,
-                    Coarse_Work, AxB_method) ;
+                // This coarse task is OK as-is, and has already been created.
             }
         }
 
+        if (nultra_total > 0)
+        { 
+            GBURBLE ("(%" PRId64 " ultra-fine) ", nultra_total) ;
+        }
+
     }
     else
     {
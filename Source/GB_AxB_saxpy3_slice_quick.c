@@ -61,6 +61,8 @@ GrB_Info GB_AxB_saxpy3_slice_quick
     SaxpyTasks [0].start   = 0 ;
     SaxpyTasks [0].end     = bnvec-1 ;
     SaxpyTasks [0].vector  = -1 ;
+    SaxpyTasks [0].pA      = -1 ;
+    SaxpyTasks [0].pA_end  = -1 ;
     SaxpyTasks [0].hsize   = cvlen ;
     SaxpyTasks [0].Hi      = NULL ;      // assigned later
     SaxpyTasks [0].Hf      = NULL ;      // assigned later
@@ -247,3 +247,227 @@ void GB_Context_gpu_id_set
     }
 }
 
+
+//------------------------------------------------------------------------------
+// Context->werk_arena: heap-backed arena for werkspace
+//------------------------------------------------------------------------------
+
+// Each Context has a Werk arena, used by GB_werk_push for werkspace that does
+// not fit in the Werk->Stack.  The arena is allocated on first use, and grows
+// geometrically up to Context->werk_arena_max bytes.  It is kept between calls
+// to GraphBLAS, so medium-sized werkspace is taken from the arena by bumping
+// a pointer instead of calling malloc and free in every call.
+
+// Only one user thread at a time can use the arena of a Context.  A user
+// thread acquires the arena when it pushes its first werkspace onto it, and
+// releases it when the last one is popped.  Any other user thread that uses
+// the same Context at the same time (typically GxB_CONTEXT_WORLD) uses malloc
+// instead.  If the arena is too small while it is in use, the werkspace is
+// also allocated by malloc, and the size needed is recorded so that the
+// arena can grow the next time it is acquired.
+
+// A Werk that returns to the user without popping all of its werkspace (on
+// an error path, for example) leaves the arena marked busy.  The Context
+// records the Werk that holds the arena.  Since a Werk is always a local
+// variable of a GraphBLAS method (see GB_WERK), a new Werk at the same
+// address as the owner means the owner no longer exists, and the arena is
+// reclaimed.  This occurs on the next call made from the same user thread at
+// the same stack depth, typically the next call to the method that failed.
+// Until then, other calls fall back to malloc.
+
+// The arena is not used when testing out-of-memory conditions with
+// malloc_debug, so those conditions are still tested.
+
+//  GB_Context_werk_size_get: get the max size of the Werk arena of a Context
+size_t GB_Context_werk_size_get (GxB_Context Context)
+{
+    size_t werk_arena_max ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        GB_ATOMIC_READ
+        werk_arena_max = GxB_CONTEXT_WORLD->werk_arena_max ;
+    }
+    else
+    { 
+        werk_arena_max = Context->werk_arena_max ;
+    }
+    return (werk_arena_max) ;
+}
+
+//  GB_Context_werk_size_set: set the max size of the Werk arena of a Context
+void GB_Context_werk_size_set
+(
+    GxB_Context Context,
+    int werk_arena_max
+)
+{
+    size_t s = (size_t) GB_IMAX (0, werk_arena_max) ;
+    if (Context == NULL || Context == GxB_CONTEXT_WORLD)
+    { 
+        Context = GxB_CONTEXT_WORLD ;
+        GB_ATOMIC_WRITE
+        Context->werk_arena_max = s ;
+    }
+    else
+    { 
+        Context->werk_arena_max = s ;
+    }
+    // shrink the arena now if it is not in use
+    int64_t busy ;
+    GB_ATOMIC_CAPTURE_INT64 (busy, Context->werk_arena_busy, 1) ;
+    if (!busy)
+    { 
+        if (Context->werk_arena_size > s)
+        { 
+            GB_Global_persistent_free ((void **) &(Context->werk_arena)) ;
+            Context->werk_arena_size = 0 ;
+        }
+        Context->werk_arena_want = GB_IMIN (Context->werk_arena_want, s) ;
+        GB_ATOMIC_WRITE
+        Context->werk_arena_busy = 0 ;
+    }
+}
+
+//  GB_Context_werk_free: free the Werk arena of a Context
+void GB_Context_werk_free (GxB_Context Context)
+{ 
+    GB_Global_persistent_free ((void **) &(Context->werk_arena)) ;
+    Context->werk_arena_size = 0 ;
+    Context->werk_arena_want = 0 ;
+}
+
+//  GB_Context_werk_release: release the Werk arena held by a Werk
+static inline void GB_Context_werk_release (GB_Werk Werk)
+{ 
+    GxB_Context Context = Werk->arena_Context ;
+    Werk->arena_Context = NULL ;
+    Werk->parena = 0 ;
+    GB_ATOMIC_WRITE
+    Context->werk_arena_owner = NULL ;
+    GB_ATOMIC_WRITE
+    Context->werk_arena_busy = 0 ;
+}
+
+//  GB_Context_werk_grow: reallocate the (empty) Werk arena of a Context
+static bool GB_Context_werk_grow (GxB_Context Context, size_t need)
+{
+    size_t newsize = GB_IMAX (need, 2 * Context->werk_arena_size) ;
+    newsize = GB_IMIN (newsize, Context->werk_arena_max) ;
+    GB_Global_persistent_free ((void **) &(Context->werk_arena)) ;
+    Context->werk_arena_size = 0 ;
+    Context->werk_arena = GB_Global_persistent_malloc (newsize) ;
+    if (Context->werk_arena == NULL)
+    { 
+        // out of memory; the werkspace is allocated by malloc instead
+        return (false) ;
+    }
+    Context->werk_arena_size = newsize ;
+    return (true) ;
+}
+
+//  GB_Context_werk_push: allocate werkspace from the Werk arena, or NULL
+void *GB_Context_werk_push
+(
+    GB_Werk Werk,
+    size_t size             // # of bytes to allocate, a multiple of 8
+)
+{
+
+    GxB_Context Context = Werk->arena_Context ;
+    if (Context == NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // acquire the arena of the Context of this user thread
+        //----------------------------------------------------------------------
+
+        Context = GB_CONTEXT_THREAD ;
+        if (Context == NULL) Context = GxB_CONTEXT_WORLD ;
+        if (size > GB_Context_werk_size_get (Context)
+            || GB_Global_malloc_debug_get ( ))
+        { 
+            // the arena is disabled or too small, or malloc is being tested
+            return (NULL) ;
+        }
+        int64_t busy ;
+        GB_ATOMIC_CAPTURE_INT64 (busy, Context->werk_arena_busy, 1) ;
+        if (busy)
+        {
+            void *owner ;
+            GB_ATOMIC_READ
+            owner = Context->werk_arena_owner ;
+            if (owner != (void *) Werk)
+            { 
+                // the arena is in use by another Werk
+                return (NULL) ;
+            }
+            // The arena is held by a prior Werk at the address of this one,
+            // which no longer exists since this Werk does.  Only this user
+            // thread can have written this address to werk_arena_owner, so
+            // the prior Werk returned without popping its werkspace.  The
+            // arena remains busy, and is taken over by this Werk.
+        }
+        Werk->arena_Context = Context ;
+        Werk->parena = 0 ;
+        GB_ATOMIC_WRITE
+        Context->werk_arena_owner = (void *) Werk ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make sure the arena has space for the werkspace
+    //--------------------------------------------------------------------------
+
+    size_t need = Werk->parena + size ;
+    if (need > Context->werk_arena_size)
+    {
+        size_t werk_arena_max = GB_Context_werk_size_get (Context) ;
+        if (need <= werk_arena_max)
+        { 
+            // remember the size needed, for the next time the arena is empty
+            Context->werk_arena_want = GB_IMAX (Context->werk_arena_want, need);
+        }
+        if (Werk->parena == 0)
+        {
+            // the arena is empty, so it can be reallocated
+            size_t want = GB_IMAX (Context->werk_arena_want, need) ;
+            if (need > werk_arena_max ||
+                !GB_Context_werk_grow (Context, GB_IMIN (want, werk_arena_max)))
+            { 
+                GB_Context_werk_release (Werk) ;
+                return (NULL) ;
+            }
+        }
+        else
+        { 
+            // the arena is in use and cannot grow
+            return (NULL) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the werkspace from the top of the arena
+    //--------------------------------------------------------------------------
+
+    GB_void *p = Context->werk_arena + Werk->parena ;
+    Werk->parena += size ;
+    return ((void *) p) ;
+}
+
+//  GB_Context_werk_pop: free werkspace from the top of the Werk arena
+void GB_Context_werk_pop
+(
+    GB_Werk Werk,
+    void *p                 // werkspace to free, at the top of the arena
+)
+{
+    GxB_Context Context = Werk->arena_Context ;
+    ASSERT (Context != NULL) ;
+    ASSERT (((GB_void *) p) >= Context->werk_arena) ;
+    ASSERT (((GB_void *) p) < Context->werk_arena + Werk->parena) ;
+    Werk->parena = ((GB_void *) p) - Context->werk_arena ;
+    if (Werk->parena == 0)
+    { 
+        // the arena is empty; let other user threads use it
+        GB_Context_werk_release (Werk) ;
+    }
+}
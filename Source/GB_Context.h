@@ -25,4 +25,10 @@ int    GB_Context_gpu_id (void) ;
 int    GB_Context_gpu_id_get (GxB_Context Context) ;
 void   GB_Context_gpu_id_set (GxB_Context Context, int gpu_id) ;
 
+size_t GB_Context_werk_size_get (GxB_Context Context) ;
+void   GB_Context_werk_size_set (GxB_Context Context, int werk_arena_max) ;
+void   GB_Context_werk_free (GxB_Context Context) ;
+void  *GB_Context_werk_push (GB_Werk Werk, size_t size) ;
+void   GB_Context_werk_pop (GB_Werk Werk, void *p) ;
+
 #endif
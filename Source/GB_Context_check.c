@@ -47,6 +47,9 @@ GrB_Info GB_Context_check       // check a GraphBLAS Context
     int gpu_id = GB_Context_gpu_id_get (Context) ;
     if (gpu_id >= 0) GBPR0 ("    Context.gpu_id:   %d\n", gpu_id) ;
 
+    size_t werk_size = GB_Context_werk_size_get (Context) ;
+    GBPR0 ("    Context.werk_size: %zu\n", werk_size) ;
+
     return (GrB_SUCCESS) ;
 }
 
@@ -147,6 +147,11 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
         GBPR0 ("    d.import   = secure\n") ;
     }
 
+    if (D->shallow_deserialize)
+    { 
+        GBPR0 ("    d.shallow_deserialize = true\n") ;
+    }
+
     if (D->compression != GxB_DEFAULT)
     { 
         GBPR0 ("    d.compression = %d\n", D->compression) ;
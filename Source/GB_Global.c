@@ -31,6 +31,14 @@ typedef struct
                                 // GxB_NONBLOCKING_GPU, or GxB_BLOCKING_GPU
     bool init_called ;          // true if GrB_init already called
 
+    //--------------------------------------------------------------------------
+    // sorting method for GB_builder: for testing and benchmarking only
+    //--------------------------------------------------------------------------
+
+    int sort ;                  // 0: select automatically (default),
+                                // 1: always use the merge sort,
+                                // 2: use the radix sort if the keys fit
+
     //--------------------------------------------------------------------------
     // hypersparsity and CSR/CSC format control
     //--------------------------------------------------------------------------
@@ -98,6 +106,12 @@ typedef struct
 
     int64_t hack [4] ;              // settings for testing/development only
 
+    //--------------------------------------------------------------------------
+    // pattern versions
+    //--------------------------------------------------------------------------
+
+    int64_t pattern_version ;       // last value of A->pattern_version used
+
     //--------------------------------------------------------------------------
     // diagnostic output
     //--------------------------------------------------------------------------
@@ -152,6 +166,9 @@ static GB_Global_struct GB_Global =
     // initialization flag
     .init_called = false,       // GrB_init has not yet been called
 
+    // sorting method for GB_builder
+    .sort = 0,                  // select the method automatically
+
     // min dimension                density
     #define GB_BITSWITCH_1          ((float) 0.04)
     #define GB_BITSWITCH_2          ((float) 0.05)
@@ -199,6 +216,9 @@ static GB_Global_struct GB_Global =
     // for testing and development only
     .hack = {0, 0, 0, 0},
 
+    // pattern versions
+    .pattern_version = 0,       // no pattern version assigned yet
+
     // diagnostics
     .burble = false,
     .printf_func = NULL,
@@ -239,6 +259,20 @@ GrB_Mode GB_Global_mode_get (void)
     return (GB_Global.mode) ;
 }
 
+//------------------------------------------------------------------------------
+// sort
+//------------------------------------------------------------------------------
+
+void GB_Global_sort_set (int sort)
+{ 
+    GB_Global.sort = sort ;
+}
+
+int GB_Global_sort_get (void)
+{ 
+    return (GB_Global.sort) ;
+}
+
 //------------------------------------------------------------------------------
 // init_called
 //------------------------------------------------------------------------------
@@ -864,6 +898,20 @@ int64_t GB_Global_hack_get (int k)
     return (GB_Global.hack [k]) ;
 }
 
+//------------------------------------------------------------------------------
+// pattern_version: unique identifier for the pattern of a matrix
+//------------------------------------------------------------------------------
+
+// Each call returns a new value, never zero, that is unique over the whole
+// process.
+
+int64_t GB_Global_pattern_version_next (void)
+{
+    int64_t version ;
+    GB_ATOMIC_CAPTURE_INC64 (version, GB_Global.pattern_version) ;
+    return (version + 1) ;
+}
+
 //------------------------------------------------------------------------------
 // burble: for controlling the burble output
 //------------------------------------------------------------------------------
@@ -81,6 +81,8 @@ void     GB_Global_persistent_free (void **p) ;
 void     GB_Global_hack_set (int k, int64_t hack) ;
 int64_t  GB_Global_hack_get (int k) ;
 
+int64_t  GB_Global_pattern_version_next (void) ;
+
 void     GB_Global_burble_set (bool burble) ;
 bool     GB_Global_burble_get (void) ;
 
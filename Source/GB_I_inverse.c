@@ -11,14 +11,28 @@
 // contiguous.  Scatter I into the I inverse buckets (Mark and Inext) for quick
 // lookup.
 
-// FUTURE:: this code is sequential.  Constructing the I inverse buckets in
-// parallel would require synchronization (a critical section for each bucket,
-// or atomics).  A more parallel approach might use qsort first, to find
-// duplicates in I, and then construct the buckets in parallel after the qsort.
-// But the time complexity would be higher.
+// If I is small, or only one thread is used, the buckets are constructed
+// sequentially, in O(nI) time, and each bucket lists its entries in
+// increasing order of their position in I.  Otherwise, the buckets are
+// constructed in parallel, also in O(nI) time:
+
+// If I is sorted, all duplicates of an index i are contiguous in I, so each
+// bucket is a run I [inew1:inew2] of identical indices.  The buckets are
+// constructed in parallel with no synchronization, and they are identical to
+// the buckets from the sequential method.  This order is required by Case 11
+// of GB_subref_template, which assumes C(:,kC) is sorted on output.
+
+// If I is unsorted, the indices are scattered into their buckets with an
+// atomic exchange of Mark [i].  Each bucket holds the same entries as with the
+// sequential method, but in an arbitrary order.  This is safe since only Case
+// 10 (which sorts each vector of C afterwards) and Case 12 (no duplicates, so
+// each bucket has at most one entry) use the buckets when I is unsorted.
 
 #include "GB_subref.h"
 
+// use the parallel method if I has at least this many entries
+#define GB_I_INVERSE_PARALLEL (64 * 1024)
+
 GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
 (
     const GrB_Index *I,         // list of indices, duplicates OK
@@ -60,6 +74,18 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (nI, chunk, nthreads_max) ;
+    if (nI < GB_I_INVERSE_PARALLEL)
+    { 
+        nthreads = 1 ;
+    }
+
     //--------------------------------------------------------------------------
     // scatter the I indices into buckets
     //--------------------------------------------------------------------------
@@ -67,29 +93,108 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     // at this point, Mark is all zero, so Mark [i] < 1 for all i in
     // the range 0 to avlen-1.
 
-    // O(nI) time; not parallel
-    for (int64_t inew = nI-1 ; inew >= 0 ; inew--)
+    int64_t inew ;
+    bool I_sorted = false ;
+    if (nthreads > 1)
+    {
+        // check if I is sorted
+        I_sorted = true ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:I_sorted)
+        for (inew = 1 ; inew < nI ; inew++)
+        {
+            if (I [inew-1] > I [inew])
+            { 
+                I_sorted = false ;
+            }
+        }
+    }
+
+    if (nthreads == 1)
+    {
+
+        //----------------------------------------------------------------------
+        // sequential method
+        //----------------------------------------------------------------------
+
+        // O(nI) time; not parallel
+        for (inew = nI-1 ; inew >= 0 ; inew--)
+        {
+            int64_t i = I [inew] ;
+            ASSERT (i >= 0 && i < avlen) ;
+            int64_t ihead = (Mark [i] - 1) ;
+            if (ihead < 0)
+            { 
+                // first time i has been seen in the list I
+                ihead = -1 ;
+            }
+            else
+            { 
+                // i has already been seen in the list I
+                ndupl++ ;
+            }
+            Mark [i] = inew + 1 ;       // (Mark [i] - 1) = inew
+            Inext [inew] = ihead ;
+        }
+
+    }
+    else if (I_sorted)
     {
-        int64_t i = I [inew] ;
-        ASSERT (i >= 0 && i < avlen) ;
-        int64_t ihead = (Mark [i] - 1) ;
-        if (ihead < 0)
-        { 
-            // first time i has been seen in the list I
-            ihead = -1 ;
+
+        //----------------------------------------------------------------------
+        // parallel method for sorted I: each bucket is a run in I
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ndupl)
+        for (inew = 0 ; inew < nI ; inew++)
+        {
+            int64_t i = I [inew] ;
+            ASSERT (i >= 0 && i < avlen) ;
+            if (inew == 0 || I [inew-1] != i)
+            { 
+                // inew is the first position of i in the list I
+                Mark [i] = inew + 1 ;
+            }
+            else
+            { 
+                // i also appears just before inew in the list I
+                ndupl++ ;
+            }
+            Inext [inew] = (inew < nI-1 && I [inew+1] == i) ? (inew+1) : -1 ;
         }
-        else
-        { 
-            // i has already been seen in the list I
-            ndupl++ ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // parallel method for unsorted I: atomic scatter into the buckets
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ndupl)
+        for (inew = 0 ; inew < nI ; inew++)
+        {
+            int64_t i = I [inew] ;
+            ASSERT (i >= 0 && i < avlen) ;
+            // ihead = Mark [i] ; Mark [i] = inew + 1, atomically
+            int64_t ihead ;
+            GB_ATOMIC_CAPTURE_INT64 (ihead, Mark [i], inew + 1) ;
+            ihead-- ;
+            if (ihead >= 0)
+            { 
+                // i has already been seen in the list I
+                ndupl++ ;
+            }
+            Inext [inew] = ihead ;
         }
-        Mark [i] = inew + 1 ;       // (Mark [i] - 1) = inew
-        Inext [inew] = ihead ;
     }
 
     // indices in I are now in buckets.  An index i might appear more than once
-    // in the list I.  inew = (Mark [i] - 1) is the first position of i in I (i
-    // will be I [inew]), (Mark [i] - 1) is the head of a link list of all
+    // in the list I.  inew = (Mark [i] - 1) is a position of i in I (i will be
+    // I [inew]; it is the first position unless the parallel method was used
+    // for an unsorted I), and (Mark [i] - 1) is the head of a link list of all
     // places where i appears in I.  inew = Inext [inew] traverses this list,
     // until inew is -1.
 
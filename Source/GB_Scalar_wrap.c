@@ -57,6 +57,9 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
 
     s->Y = NULL ;
     s->Y_shallow = false ;
+    s->saxpy3_schedule = NULL ;
+    s->ek_slice_cache = NULL ;
+    s->pattern_version = 0 ;    // a full scalar is never used by saxpy3
 
     s->nvals = 0 ;
 
@@ -107,7 +107,8 @@ GrB_Info GB_Vector_diag     // extract a diagonal from a matrix, as a vector
     GrB_Scalar Thunk = GB_Scalar_wrap (&Thunk_header, GrB_INT64, &k) ;
 
     GB_CLEAR_STATIC_HEADER (T, &T_header) ;
-    GB_OK (GB_selector (T, GrB_DIAG, false, A, Thunk, Werk)) ;
+    GB_OK (GB_selector (T, GrB_DIAG, false, A, Thunk, NULL, false, false,
+        Werk)) ;
 
     GB_OK (GB_convert_any_to_hyper (T, Werk)) ;
     GB_MATRIX_WAIT (T) ;
@@ -28,11 +28,18 @@ bool GB_all_aliased         // determine if A and B are all aliased
     GrB_Matrix B            // input B matrix
 ) ;
 
-// matrices returned to the user are never shallow; internal matrices may be
+// matrices returned to the user are never shallow, except those from
+// GxB_*_deserialize with GxB_SHALLOW_DESERIALIZE; internal matrices may be
 bool GB_is_shallow              // true if any component of A is shallow
 (
     GrB_Matrix A                // matrix to query
 ) ;
 
+// GB_unshallow replaces any shallow components of A with deep copies
+GrB_Info GB_unshallow           // replace all shallow components of A
+(
+    GrB_Matrix A                // matrix to modify
+) ;
+
 #endif
 
@@ -273,7 +273,7 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         // using the T_is_csc format.  The ijflip is handled above.
     }
     else if (M == NULL && accum == NULL && (C == A) && C->type == T_type
-        && GB_nnz (C) > 0)
+        && GB_nnz (C) > 0 && !GB_is_shallow (C))
     {
         GBURBLE ("(in-place-op) ") ;
         // C = op (C), operating on the values in-place, with no typecasting
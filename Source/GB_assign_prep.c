@@ -111,7 +111,6 @@ GrB_Info GB_assign_prep
     GrB_Matrix A = A_in ;
 
     ASSERT_MATRIX_OK (C, "C input for GB_assign_prep", GB0) ;
-    ASSERT (!GB_is_shallow (C)) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_assign_prep", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_assign_prep", GB0) ;
     ASSERT (scode <= GB_UDT_code) ;
@@ -150,6 +149,13 @@ GrB_Info GB_assign_prep
     (*nJ_handle) = 0 ;
     (*Jkind_handle) = 0 ;
 
+    //--------------------------------------------------------------------------
+    // C is modified in place, so it cannot have any shallow components
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_unshallow (C)) ;
+    ASSERT (!GB_is_shallow (C)) ;
+
     //--------------------------------------------------------------------------
     // determine the type of A or the scalar
     //--------------------------------------------------------------------------
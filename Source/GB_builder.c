@@ -561,6 +561,15 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // sort all the tuples
         //----------------------------------------------------------------------
 
+        // The radix sort is used for large problems whose (j,i) indices can
+        // be packed into a single 64-bit key and sorted in a few passes;
+        // the merge sort is used otherwise.  Both give the same result.
+
+        int ibits, jbits ;
+        bool use_radix = GB_radix_sort_select (&ibits, &jbits, nvals, vlen,
+            vdim) ;
+        if (do_burble && use_radix) GBURBLE ("(radix sort) ") ;
+
         if (vdim > 1)
         {
 
@@ -568,7 +577,13 @@ GrB_Info GB_builder                 // build a matrix from tuples
             // sort a set of (j,i,k) tuples
             //------------------------------------------------------------------
 
-            if (S_iso)
+            if (use_radix)
+            { 
+                // K_work is NULL if S_iso; sort (j,i,k) or (j,i)
+                info = GB_radix_sort (I_work, J_work, K_work, nvals, ibits,
+                    jbits, nthreads) ;
+            }
+            else if (S_iso)
             { 
                 // K_work is NULL; only sort (j,i)
                 info = GB_msort_2 (J_work, I_work, nvals, nthreads) ;
@@ -602,7 +617,13 @@ GrB_Info GB_builder                 // build a matrix from tuples
             // sort a set of (i,k) tuples
             //------------------------------------------------------------------
 
-            if (S_iso)
+            if (use_radix)
+            { 
+                // K_work is NULL if S_iso; sort (i,k) or (i)
+                info = GB_radix_sort (I_work, NULL, K_work, nvals, ibits, 0,
+                    nthreads) ;
+            }
+            else if (S_iso)
             { 
                 // K_work is NULL; only sort (i)
                 info = GB_msort_1 (I_work, nvals, nthreads) ;
@@ -27,7 +27,12 @@ static inline void *GB_calloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
-    p = GB_Global_malloc_function (*size) ;
+    // get a block from the memory pool, if enabled; this may round up the size
+    p = GB_memory_pool_get (size) ;
+    if (p == NULL)
+    { 
+        p = GB_Global_malloc_function (*size) ;
+    }
 
     #ifdef GB_MEMDUMP
     printf ("hard calloc %p %ld\n", p, *size) ; // MEMDUMP
@@ -52,9 +52,9 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
     int nthreads_max = GB_Context_nthreads_max ( ) ;
     int sparsity_control = GB_sparsity_control (A->sparsity_control, A->vdim) ;
     if (((sparsity_control & (GxB_SPARSE + GxB_HYPERSPARSE)) == 0)
-        && GB_IS_BITMAP (A))
+        && GB_IS_BITMAP (A) && !A->b_shallow)
     { 
-        // A should remain bitmap
+        // A should remain bitmap, and A->b can be cleared in place
         GB_memset (A->b, 0, GB_nnz_held (A), nthreads_max) ;
         A->nvals = 0 ;
         A->magic = GB_MAGIC ;
@@ -84,6 +84,7 @@ GrB_Info GB_convert_hyper_to_sparse // convert hypersparse to sparse
         A->h_size = 0 ;
         A->h_shallow = false ;
         GB_hyper_hash_free (A) ;
+        GB_PATTERN_CHANGED (A) ;
 
     }
     else
@@ -169,6 +169,7 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
 
         ASSERT (GB_IS_HYPERSPARSE (A)) ;
         ASSERT (A->Y == NULL && A->Y_shallow == false) ;
+        GB_PATTERN_CHANGED (A) ;
     }
 
     //--------------------------------------------------------------------------
@@ -9,12 +9,35 @@
 
 // A parallel decompression of a serialized blob into a GrB_Matrix.
 
+// If shallow is true, any uncompressed and suitably aligned array in the blob
+// becomes a shallow component of C that points directly into the blob, with
+// no memory allocated and no data copied.  The blob must then remain valid and
+// unmodified until C is freed.  GraphBLAS never modifies the blob; any method
+// that modifies C in place first makes a deep copy of its shallow components,
+// via GB_unshallow.
+
+// If the reader function is not NULL (for GxB_Matrix_deserialize_stream), the
+// blob is read from the stream instead, and the blob and blob_size inputs are
+// ignored.  Only the blob header, type_name, and block sizes are held in
+// memory; each array is read and decompressed block by block directly into
+// C, by GB_deserialize_from_stream.  C is never shallow in this case.  The
+// sizes in the header are not trusted: each buffer grows only as the bytes it
+// holds are read from the stream, so a truncated or corrupted stream fails
+// before any large allocation is made.
+
 #include "GB.h"
 #include "GB_get_set.h"
 #include "GB_serialize.h"
 
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE (&head, head_size) ;            \
+    GB_FREE (&tail, tail_size) ;            \
+}
+
 #define GB_FREE_ALL                         \
 {                                           \
+    GB_FREE_WORKSPACE ;                     \
     GB_Matrix_free (&T) ;                   \
     GB_Matrix_free (&C) ;                   \
 }
@@ -26,7 +49,11 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    size_t blob_size,               // size of the blob
+    bool shallow,                   // if true, C may point into the blob
+    GxB_stream_read_function reader,    // if not NULL, read the blob from
+                                        // the stream instead
+    void *stream                    // stream passed to the reader
 )
 {
 
@@ -35,9 +62,17 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    ASSERT (blob != NULL && Chandle != NULL) ;
+    bool streaming = (reader != NULL) ;
+    ASSERT ((blob != NULL || streaming) && Chandle != NULL) ;
     (*Chandle) = NULL ;
     GrB_Matrix C = NULL, T = NULL ;
+    GB_void *head = NULL ; size_t head_size = 0 ;
+    GB_void *tail = NULL ; size_t tail_size = 0 ;
+    if (streaming)
+    { 
+        // C cannot point into a stream
+        shallow = false ;
+    }
 
     //--------------------------------------------------------------------------
     // read the content of the header (160 bytes)
@@ -45,9 +80,31 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
 
     size_t s = 0 ;
 
+    if (streaming)
+    {
+        // read the header from the stream, and get the blob_size from it
+        head = GB_MALLOC (GB_BLOB_HEADER_SIZE, GB_void, &head_size) ;
+        if (head == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (!reader (stream, head, GB_BLOB_HEADER_SIZE))
+        { 
+            // stream is truncated or cannot be read
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        uint64_t blob_size64 ;
+        memcpy (&blob_size64, head, sizeof (uint64_t)) ;
+        blob = head ;
+        blob_size = (size_t) blob_size64 ;
+    }
+
     if (blob_size < GB_BLOB_HEADER_SIZE)
     { 
         // blob is invalid
+        GB_FREE_ALL ;
         return (GrB_INVALID_OBJECT)  ;
     }
 
@@ -61,6 +118,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
             blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
     { 
         // blob is invalid
+        GB_FREE_ALL ;
         return (GrB_INVALID_OBJECT)  ;
     }
 
@@ -90,6 +148,41 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     bool iso = ((sparsity_iso_csc & 2) == 2) ;
     bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
 
+    //--------------------------------------------------------------------------
+    // read the type_name and compressed block sizes from the stream
+    //--------------------------------------------------------------------------
+
+    if (streaming)
+    {
+        // the type_name and block sizes follow the header in the blob
+        size_t head_len = s + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0)
+            + sizeof (int64_t) * (
+                (size_t) GB_IMAX (Cp_nblocks, 0) +
+                (size_t) GB_IMAX (Ch_nblocks, 0) +
+                (size_t) GB_IMAX (Cb_nblocks, 0) +
+                (size_t) GB_IMAX (Ci_nblocks, 0) +
+                (size_t) GB_IMAX (Cx_nblocks, 0)) ;
+        // a negative number of blocks is invalid
+        if (Cp_nblocks < 0 || Ch_nblocks < 0 || Cb_nblocks < 0 ||
+            Ci_nblocks < 0 || Cx_nblocks < 0 || head_len > blob_size)
+        { 
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        // head is reallocated as the block sizes are read, so that a
+        // corrupted stream cannot force a large allocation before it fails
+        info = GB_deserialize_stream_read (&head, &head_size, s, head_len - s,
+            reader, stream) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory, or the stream is truncated or cannot be read
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+        blob = head ;
+    }
+
     //--------------------------------------------------------------------------
     // determine the matrix type
     //--------------------------------------------------------------------------
@@ -101,6 +194,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     if (ctype == NULL || ctype->size != typesize)
     { 
         // blob is invalid; type is missing or the wrong size
+        GB_FREE_ALL ;
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
@@ -113,6 +207,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
             GxB_MAX_NAME_LEN) != 0)
         { 
             // blob is invalid
+            GB_FREE_ALL ;
             return (GrB_DOMAIN_MISMATCH) ;
         }
         s += GxB_MAX_NAME_LEN ;
@@ -121,6 +216,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     { 
         // built-in type must match type_expected
         // blob is invalid
+        GB_FREE_ALL ;
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
@@ -155,45 +251,67 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     ASSERT (C->nzombies == 0) ;
     ASSERT (!C->jumbled) ;
 
+    //--------------------------------------------------------------------------
+    // determine the alignment required for shallow components of C
+    //--------------------------------------------------------------------------
+
+    // Cp, Ch, and Ci must be aligned to 8 bytes to be used in place, and Cx
+    // must be aligned to the largest power of 2 that divides the type size,
+    // up to 16 bytes.  Cb has no alignment requirement.  An alignment of zero
+    // disables the use of shallow components.
+
+    size_t pi_align = 0, b_align = 0, x_align = 0 ;
+    if (shallow)
+    { 
+        pi_align = sizeof (int64_t) ;
+        b_align = 1 ;
+        x_align = 1 ;
+        while (x_align < 16 && (typesize % (2 * x_align)) == 0)
+        { 
+            x_align *= 2 ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // decompress each array (Cp, Ch, Cb, Ci, and Cx)
     //--------------------------------------------------------------------------
 
+    #define GB_DESERIALIZE(X,align)                                         \
+    {                                                                       \
+        if (streaming)                                                      \
+        {                                                                   \
+            GB_OK (GB_deserialize_from_stream ((GB_void **) &(C->X),        \
+                &(C->X ## _size), C ## X ## _len, reader, stream,           \
+                blob_size, C ## X ## _Sblocks, C ## X ## _nblocks,          \
+                C ## X ## _method, &s)) ;                                   \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->X),          \
+                &(C->X ## _size), &(C->X ## _shallow), C ## X ## _len,      \
+                blob, blob_size, C ## X ## _Sblocks, C ## X ## _nblocks,    \
+                C ## X ## _method, align, &s)) ;                            \
+        }                                                                   \
+    }
+
     switch (sparsity)
     {
         case GxB_HYPERSPARSE : 
             // decompress Cp, Ch, and Ci
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
-
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->h), &(C->h_size),
-                Ch_len, blob, blob_size, Ch_Sblocks, Ch_nblocks, Ch_method,
-                &s)) ;
-
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+            GB_DESERIALIZE (p, pi_align) ;
+            GB_DESERIALIZE (h, pi_align) ;
+            GB_DESERIALIZE (i, pi_align) ;
             break ;
 
         case GxB_SPARSE : 
-
             // decompress Cp and Ci
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
-                Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s)) ;
-
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
-                Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s)) ;
+            GB_DESERIALIZE (p, pi_align) ;
+            GB_DESERIALIZE (i, pi_align) ;
             break ;
 
         case GxB_BITMAP : 
-
             // decompress Cb
-            GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->b), &(C->b_size),
-                Cb_len, blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method,
-                &s)) ;
+            GB_DESERIALIZE (b, b_align) ;
             break ;
 
         case GxB_FULL : 
@@ -202,8 +320,12 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     }
 
     // decompress Cx
-    GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size), Cx_len,
-        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, &s)) ;
+    GB_DESERIALIZE (x, x_align) ;
+
+    if (GB_is_shallow (C))
+    { 
+        GBURBLE ("(shallow deserialize) ") ;
+    }
 
     if (C->p != NULL)
     { 
@@ -226,18 +348,38 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // v8.1.0 adds two nul-terminated uncompressed strings to the end of the
     // blob.  If the strings are empty, the nul terminators still appear.
 
-    if (version >= GxB_VERSION (8,1,0))
+    if (version >= GxB_VERSION (8,1,0) && s <= blob_size)
     { 
 
         //----------------------------------------------------------------------
-        // look for the two nul bytes in blob [s : blob_size-1]
+        // get the strings at the end of the blob
+        //----------------------------------------------------------------------
+
+        const GB_void *names = blob + s ;
+        size_t names_len = blob_size - s ;
+        if (streaming)
+        {
+            // read the rest of the blob from the stream, in bounded chunks
+            info = GB_deserialize_stream_read (&tail, &tail_size, 0,
+                names_len, reader, stream) ;
+            if (info != GrB_SUCCESS)
+            { 
+                // out of memory, or the stream is truncated or cannot be read
+                GB_FREE_ALL ;
+                return (info) ;
+            }
+            names = tail ;
+        }
+
+        //----------------------------------------------------------------------
+        // look for the two nul bytes in names [0 : names_len-1]
         //----------------------------------------------------------------------
 
         int nfound = 0 ;
         size_t ss [2] ;
-        for (size_t p = s ; p < blob_size && nfound < 2 ; p++)
+        for (size_t p = 0 ; p < names_len && nfound < 2 ; p++)
         {
-            if (blob [p] == 0)
+            if (names [p] == 0)
             { 
                 ss [nfound++] = p ;
             }
@@ -246,8 +388,8 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
         if (nfound == 2)
         { 
             // extract the GrB_NAME and GrB_ELTYPE_STRING from the blob
-            char *user_name = (char *) (blob + s) ;
-//          char *eltype_string = (char *) (blob + ss [0] + 1) ;
+            char *user_name = (char *) names ;
+//          char *eltype_string = (char *) (names + ss [0] + 1) ;
 //          printf ("deserialize user_name [%s] eltype [%s]\n", user_name,
 //              eltype_string) ;
             GB_OK (GB_matvec_name_set (C, user_name, GrB_NAME)) ;
@@ -258,6 +400,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // return result
     //--------------------------------------------------------------------------
 
+    GB_FREE_WORKSPACE ;
     (*Chandle) = C ;
     ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize", GB0) ;
     return (GrB_SUCCESS) ;
@@ -0,0 +1,254 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_blob_range: uncompress part of an array from the blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Decompress the bytes xstart:xend-1 of a single array of X_len bytes, held as
+// a set of compressed blocks in the blob.  Only the blocks that overlap this
+// range are decompressed, in parallel.  They are decompressed into a single
+// workspace that becomes the output X, and the bytes xstart:xend-1 are then
+// moved to the start of X.  X is thus larger than xend-xstart bytes, by at
+// most two blocks.  The same sanity checks as GB_deserialize_from_blob are
+// done on all of the blocks, to ensure no out-of-bounds indexing of arrays.
+
+// If shallow_align > 0, the array is uncompressed, and the position of byte
+// xstart in the blob is a multiple of shallow_align, then X is returned as a
+// pointer into the blob itself, and X_shallow is returned as true.
+
+// On output, s_handle is advanced past the entire array, as done by
+// GB_deserialize_from_blob.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_WORKSPACE           \
+{                                   \
+    GB_FREE_WORK (&W, W_size) ;     \
+}
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE_WORKSPACE ;             \
+    GB_FREE (&X, X_size) ;          \
+}
+
+GrB_Info GB_deserialize_blob_range
+(
+    // output:
+    GB_void **X_handle,         // uncompressed bytes xstart:xend-1 of array
+    size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow,            // if true, X is a shallow pointer into blob
+    // input:
+    int64_t xstart,             // first byte of the array to decompress
+    int64_t xend,               // one past the last byte to decompress
+    int64_t X_len,              // size of the entire array in bytes
+    const GB_void *blob,        // serialized blob of size blob_size
+    size_t blob_size,
+    int64_t *Sblocks,           // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    size_t shallow_align,       // required alignment of a shallow X, or 0 if
+                                // X must not be shallow
+    // input/output:
+    size_t *s_handle            // where to read from the blob
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (blob != NULL) ;
+    ASSERT (s_handle != NULL) ;
+    ASSERT (X_handle != NULL) ;
+    ASSERT (X_size_handle != NULL) ;
+    ASSERT (X_shallow != NULL) ;
+    (*X_handle) = NULL ;
+    (*X_size_handle) = 0 ;
+    (*X_shallow) = false ;
+    GB_void *X = NULL ; size_t X_size = 0 ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+
+    if (xstart < 0 || xstart > xend || xend > X_len)
+    {
+        // blob is invalid; the range is not inside the array
+        return (GrB_INVALID_OBJECT) ;
+    }
+    int64_t len = xend - xstart ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+    size_t s = (*s_handle) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+
+    if (algo == GxB_COMPRESSION_NONE)
+    {
+
+        //----------------------------------------------------------------------
+        // no compression; the array is held in a single block, or in no
+        // blocks at all if it is empty
+        //----------------------------------------------------------------------
+
+        if ((nblocks == 0) ? (X_len != 0) :
+            (nblocks != 1 || Sblocks [0] != X_len || s + X_len > blob_size))
+        {
+            // blob is invalid: guard against an unsafe memcpy
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        if (shallow_align > 0 && len > 0
+            && ((uintptr_t) (blob + s + xstart)) % shallow_align == 0)
+        {
+            // return X as a shallow pointer into the blob
+            X = (GB_void *) (blob + s + xstart) ;
+            X_size = (size_t) len ;
+            (*X_shallow) = true ;
+        }
+        else
+        {
+            // copy the range from the blob into X
+            X = GB_MALLOC (len, GB_void, &X_size) ;     // OK
+            if (X == NULL)
+            {
+                // out of memory
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_memcpy (X, blob + s + xstart, len, nthreads_max) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // LZ4, LZ4HC, or ZSTD compression
+        //----------------------------------------------------------------------
+
+        // check all the blocks, and find the blocks block1:block2 that hold
+        // the bytes xstart:xend-1, and the first byte wstart of block1
+        int32_t block1 = nblocks, block2 = -1 ;
+        int64_t wstart = 0, wend = 0 ;
+        for (int32_t blockid = 0 ; blockid < nblocks ; blockid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+            int64_t s_end   = Sblocks [blockid] ;
+            if (kstart < 0 || kstart >= kend || kend > X_len ||
+                kend - kstart > INT32_MAX || s_start < 0 || s_start >= s_end ||
+                s_end - s_start > INT32_MAX || s + s_end > blob_size)
+            {
+                // blob is invalid
+                return (GrB_INVALID_OBJECT) ;
+            }
+            if (kend > xstart && kstart < xend)
+            {
+                // this block overlaps the range xstart:xend-1
+                if (blockid < block1)
+                {
+                    block1 = blockid ;
+                    wstart = kstart ;
+                }
+                block2 = blockid ;
+                wend = kend ;
+            }
+        }
+
+        // allocate the workspace for blocks block1:block2, which becomes X.
+        // If the blocks were filtered, they are decompressed into W and then
+        // unfiltered into X.
+        int32_t filter = GB_FILTER (method) ;
+        if (filter > GB_FILTER_MAX)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        X = GB_MALLOC (wend - wstart, GB_void, &X_size) ;   // OK
+        if (filter > 0)
+        {
+            W = GB_MALLOC_WORK (wend - wstart, GB_void, &W_size) ;
+        }
+        if (X == NULL || (filter > 0 && W == NULL))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        // uncompress the blocks block1:block2 in parallel
+        bool ok = true ;
+        int nthreads = GB_IMAX (GB_IMIN (nthreads_max, block2 - block1 + 1), 1);
+        int32_t blockid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
+            reduction(&&:ok)
+        for (blockid = block1 ; blockid <= block2 ; blockid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+            int64_t s_end   = Sblocks [blockid] ;
+            size_t  s_size  = s_end - s_start ;
+            size_t  d_size  = kend - kstart ;
+            const char *src = (const char *) (blob + s + s_start) ;
+            char *dst = (char *) (((W == NULL) ? X : W) + kstart - wstart) ;
+            if (algo == GxB_COMPRESSION_ZSTD)
+            {
+                // ZSTD
+                size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+                ok = ok && (u == d_size) ;
+            }
+            else
+            {
+                // LZ4 or LZ4HC
+                int u = LZ4_decompress_safe (src, dst, (int) s_size,
+                    (int) d_size) ;
+                ok = ok && (u == (int) d_size) ;
+            }
+            if (ok && W != NULL)
+            {
+                // unfilter the block into X
+                GB_deserialize_unfilter (X + kstart - wstart,
+                    W + kstart - wstart, kstart, kend, filter) ;
+            }
+        }
+
+        if (!ok)
+        {
+            // decompression failure; blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        // move the bytes xstart:xend-1 to the start of X
+        if (len > 0 && xstart > wstart)
+        {
+            memmove (X, X + (xstart - wstart), len) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result: X, its size, and updated index into the blob
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    if (nblocks > 0)
+    {
+        s += Sblocks [nblocks-1] ;
+    }
+    (*s_handle) = s ;
+    return (GrB_SUCCESS) ;
+}
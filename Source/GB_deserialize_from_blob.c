@@ -15,14 +15,27 @@
 // However, the contents of output array are not fully checked.  This step is
 // done by GB_deserialize, if requested.
 
+// If shallow_align > 0, the array is uncompressed and held in a single block,
+// and its position in the blob is a multiple of shallow_align bytes, then X is
+// returned as a pointer into the blob itself, and X_shallow is returned as
+// true.  No memory is allocated and no data is copied.  The caller must not
+// free X in this case, and the blob must not be modified or freed while X is
+// in use.
+
 #include "GB.h"
 #include "GB_serialize.h"
 #include "GB_lz4.h"
 #include "GB_zstd.h"
 
-#define GB_FREE_ALL         \
-{                           \
-    GB_FREE (&X, X_size) ;  \
+#define GB_FREE_WORKSPACE           \
+{                                   \
+    GB_FREE_WORK (&W, W_size) ;     \
+}
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE_WORKSPACE ;             \
+    GB_FREE (&X, X_size) ;          \
 }
 
 GrB_Info GB_deserialize_from_blob
@@ -30,6 +43,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow,            // if true, X is a shallow pointer into blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -37,6 +51,8 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method,             // compression method used for each block
+    size_t shallow_align,       // required alignment of a shallow X, or 0 if
+                                // X must not be shallow
     // input/output:
     size_t *s_handle            // where to read from the blob
 )
@@ -51,8 +67,11 @@ GrB_Info GB_deserialize_from_blob
     ASSERT (s_handle != NULL) ;
     ASSERT (X_handle != NULL) ;
     ASSERT (X_size_handle != NULL) ;
+    ASSERT (X_shallow != NULL) ;
     (*X_handle) = NULL ;
     (*X_size_handle) = 0 ;
+    (*X_shallow) = false ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
 
     //--------------------------------------------------------------------------
     // parse the method
@@ -60,6 +79,23 @@ GrB_Info GB_deserialize_from_blob
 
     int32_t algo, level ;
     GB_serialize_method (&algo, &level, method) ;
+    size_t s = (*s_handle) ;
+
+    //--------------------------------------------------------------------------
+    // return X as a shallow pointer into the blob, if permitted
+    //--------------------------------------------------------------------------
+
+    if (shallow_align > 0 && algo == GxB_COMPRESSION_NONE && nblocks == 1
+        && X_len > 0 && Sblocks [0] == X_len && s + X_len <= blob_size
+        && ((uintptr_t) (blob + s)) % shallow_align == 0)
+    { 
+        // the array is held uncompressed in the blob, and is properly aligned
+        (*X_handle) = (GB_void *) (blob + s) ;
+        (*X_size_handle) = (size_t) X_len ;
+        (*X_shallow) = true ;
+        (*s_handle) = s + X_len ;
+        return (GrB_SUCCESS) ;
+    }
 
     //--------------------------------------------------------------------------
     // allocate the output array
@@ -73,6 +109,31 @@ GrB_Info GB_deserialize_from_blob
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    //--------------------------------------------------------------------------
+    // allocate workspace for the filtered array, if needed
+    //--------------------------------------------------------------------------
+
+    // If the blocks were filtered, each block is decompressed into W and then
+    // unfiltered into X.
+
+    int32_t filter = GB_FILTER (method) ;
+    if (filter > GB_FILTER_MAX)
+    { 
+        // blob is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+    if (filter > 0 && algo != GxB_COMPRESSION_NONE)
+    {
+        W = GB_MALLOC_WORK (X_len, GB_void, &W_size) ;
+        if (W == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -83,7 +144,6 @@ GrB_Info GB_deserialize_from_blob
     // decompress the blocks from the blob
     //--------------------------------------------------------------------------
 
-    size_t s = (*s_handle) ;
     bool ok = true ;
 
     if (algo == GxB_COMPRESSION_NONE)
@@ -144,7 +204,7 @@ GrB_Info GB_deserialize_from_blob
                 // not yet checked, however.  That step is done in
                 // GB_deserialize, if requested.
                 const char *src = (const char *) (blob + s + s_start) ;
-                char *dst = (char *) (X + kstart) ;
+                char *dst = (char *) (((W == NULL) ? X : W) + kstart) ;
                 if (algo == GxB_COMPRESSION_ZSTD)
                 { 
                     // ZSTD
@@ -167,6 +227,12 @@ GrB_Info GB_deserialize_from_blob
                         ok = false ;
                     }
                 }
+                if (ok && W != NULL)
+                { 
+                    // unfilter W [kstart:kend-1] into X [kstart:kend-1]
+                    GB_deserialize_unfilter (X + kstart, W + kstart, kstart,
+                        kend, filter) ;
+                }
             }
         }
     }
@@ -182,6 +248,7 @@ GrB_Info GB_deserialize_from_blob
     // return result: X, its size, and updated index into the blob
     //--------------------------------------------------------------------------
 
+    GB_FREE_WORKSPACE ;
     (*X_handle) = X ;
     (*X_size_handle) = X_size ;
     if (nblocks > 0)
@@ -0,0 +1,280 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_from_stream: uncompress a set of blocks from a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Streaming variant of GB_deserialize_from_blob.  The compressed blocks of a
+// single array are read from the stream, nthreads blocks at a time, into a
+// workspace buffer, and each batch is decompressed in parallel directly into
+// the output array X.  An uncompressed array is read directly into X, with no
+// copy.  The block sizes in Sblocks have already been read from the stream,
+// and are checked here against the remaining size of the blob (blob_size - s)
+// before any block is read.  X and the workspace are not allocated from the
+// sizes in the blob all at once, but grow as the blocks are read, so that a
+// truncated or corrupted stream fails before any large allocation is made.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Work, Work_size) ;       \
+    GB_FREE_WORK (&W, W_size) ;             \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_FREE (&X, X_size) ;                  \
+}
+
+GrB_Info GB_deserialize_from_stream
+(
+    // output:
+    GB_void **X_handle,         // uncompressed output array
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    int64_t X_len,              // size of X in bytes
+    GxB_stream_read_function reader,    // function to read from the stream
+    void *stream,               // stream passed to the reader
+    size_t blob_size,           // size of the serialized blob in the stream
+    int64_t *Sblocks,           // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    // input/output:
+    size_t *s_handle            // # of bytes read so far from the stream
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (reader != NULL) ;
+    ASSERT (s_handle != NULL) ;
+    ASSERT (X_handle != NULL) ;
+    ASSERT (X_size_handle != NULL) ;
+    (*X_handle) = NULL ;
+    (*X_size_handle) = 0 ;
+    GB_void *Work = NULL ; size_t Work_size = 0 ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    int32_t algo, level ;
+    GB_serialize_method (&algo, &level, method) ;
+    size_t s = (*s_handle) ;
+
+    //--------------------------------------------------------------------------
+    // check the compressed block sizes
+    //--------------------------------------------------------------------------
+
+    // The sizes are checked against each other and against the blob_size in
+    // the header, but none of them can be trusted until the bytes they
+    // describe have been read from the stream.  An uncompressed block cannot
+    // be larger than GB_LZ4_MAX_RATIO or GB_ZSTD_MAX_RATIO times its
+    // compressed size.
+
+    if (algo == GxB_COMPRESSION_NONE)
+    {
+        if ((X_len > 0 && (nblocks != 1 || Sblocks [0] != X_len))
+            || s + X_len > blob_size)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+    else
+    {
+        int64_t max_ratio = (algo == GxB_COMPRESSION_ZSTD) ?
+            GB_ZSTD_MAX_RATIO : GB_LZ4_MAX_RATIO ;
+        if (X_len > 0 && nblocks < 1)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        for (int32_t blockid = 0 ; blockid < nblocks ; blockid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+            int64_t s_end   = Sblocks [blockid] ;
+            if (kstart < 0 || kstart >= kend || kend > X_len ||
+                kend - kstart > INT32_MAX || s_start < 0 || s_start >= s_end ||
+                s_end - s_start > INT32_MAX || s + s_end > blob_size ||
+                kend - kstart > max_ratio * (s_end - s_start))
+            {
+                // blob is invalid
+                return (GrB_INVALID_OBJECT) ;
+            }
+        }
+    }
+
+    int32_t filter = GB_FILTER (method) ;
+    if (filter > GB_FILTER_MAX)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the first part of the output array
+    //--------------------------------------------------------------------------
+
+    // X, and the workspace, grow as the blocks are read from the stream
+    size_t X_size = 0 ;
+    GB_void *X = GB_MALLOC (GB_IMIN (X_len, GB_STREAM_CHUNK), GB_void,
+        &X_size) ;
+    if (X == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read and decompress the blocks from the stream
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool ok = true ;
+
+    if (algo == GxB_COMPRESSION_NONE)
+    {
+
+        //----------------------------------------------------------------------
+        // no compression; read the array directly into X
+        //----------------------------------------------------------------------
+
+        info = GB_deserialize_stream_read (&X, &X_size, 0, X_len, reader,
+            stream) ;
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory, or the stream is truncated or cannot be read
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // LZ4, LZ4HC, or ZSTD compression
+        //----------------------------------------------------------------------
+
+        // The blocks are read in batches of nthreads blocks each.  If the
+        // blocks were filtered, each block is decompressed into its own part
+        // of W, of size maxblock, and then unfiltered into X.
+
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        int nthreads = GB_IMAX (GB_IMIN (nthreads_max, nblocks), 1) ;
+        bool filtered = (filter > 0 && nblocks > 0) ;
+        int64_t maxblock = GB_ICEIL (X_len, GB_IMAX (nblocks, 1)) + 1 ;
+
+        for (int32_t block1 = 0 ; block1 < nblocks && ok ; block1 += nthreads)
+        {
+            // read the compressed blocks block1:block2-1 into Work
+            int32_t block2 = GB_IMIN (block1 + nthreads, nblocks) ;
+            int64_t b_start = (block1 == 0) ? 0 : Sblocks [block1-1] ;
+            int64_t b_end = Sblocks [block2-1] ;
+            info = GB_deserialize_stream_read (&Work, &Work_size, 0,
+                b_end - b_start, reader, stream) ;
+            if (info != GrB_SUCCESS)
+            {
+                // out of memory, or the stream is truncated or cannot be read
+                GB_FREE_ALL ;
+                return (info) ;
+            }
+
+            // grow X and W to hold the uncompressed batch, doubling the size
+            // of X each time
+            int64_t x_start, x_end ;
+            GB_PARTITION (x_start, x_end, X_len, block2-1, nblocks) ;
+            if (X_size < (size_t) x_end)
+            {
+                size_t newsize = GB_IMIN ((size_t) X_len,
+                    GB_IMAX ((size_t) x_end, 2 * X_size)) ;
+                GB_REALLOC (X, newsize, GB_void, &X_size, &ok) ;
+            }
+            size_t wlen = (block2 - block1) * maxblock ;
+            if (ok && filtered && W_size < wlen)
+            {
+                GB_REALLOC_WORK (W, wlen, GB_void, &W_size, &ok) ;
+            }
+            if (!ok)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+
+            // uncompress each block in parallel into X [kstart:kend-1]
+            int32_t blockid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+                reduction(&&:ok)
+            for (blockid = block1 ; blockid < block2 ; blockid++)
+            {
+                int64_t kstart, kend ;
+                GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+                int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
+                int64_t s_end   = Sblocks [blockid] ;
+                size_t  s_size  = s_end - s_start ;
+                size_t  d_size  = kend - kstart ;
+                const char *src = (const char *) (Work + s_start - b_start) ;
+                GB_void *Wblock = filtered ?
+                    (W + (blockid - block1) * maxblock) : NULL ;
+                char *dst = (char *) (filtered ? Wblock : (X + kstart)) ;
+                if (algo == GxB_COMPRESSION_ZSTD)
+                {
+                    // ZSTD
+                    size_t u = ZSTD_decompress (dst, d_size, src, s_size) ;
+                    ok = ok && (u == d_size) ;
+                }
+                else
+                {
+                    // LZ4 or LZ4HC
+                    int u = LZ4_decompress_safe (src, dst, (int) s_size,
+                        (int) d_size) ;
+                    ok = ok && (u == (int) d_size) ;
+                }
+                if (ok && filtered)
+                {
+                    // unfilter the block into X [kstart:kend-1]
+                    GB_deserialize_unfilter (X + kstart, Wblock, kstart, kend,
+                        filter) ;
+                }
+            }
+        }
+    }
+
+    if (!ok)
+    {
+        // decompression failure, or the stream is invalid
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result: X, its size, and updated position
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    if (nblocks > 0)
+    {
+        s += Sblocks [nblocks-1] ;
+    }
+    (*s_handle) = s ;
+    return (GrB_SUCCESS) ;
+}
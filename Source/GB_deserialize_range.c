@@ -0,0 +1,426 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_range: deserialize a range of vectors from a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates a matrix C from the vectors kfirst:klast of the matrix A held in a
+// serialized blob, without decompressing all of A.  If A is held by column,
+// C = A (:,kfirst:klast); if A is held by row, C = A (kfirst:klast,:).  C has
+// the same type, format, and sparsity structure as A.
+
+// Each array of A is held in the blob as a sequence of independently
+// compressed blocks.  The blocks of Ap (for a sparse or hypersparse A), or Ab
+// and Ax (for a bitmap or full A), that hold the vectors kfirst:klast are
+// decompressed first.  For a sparse or hypersparse A, the range of entries
+// Ap [k1]:Ap[k2]-1 in these vectors then determines the blocks of Ai and Ax
+// that are needed.  All other blocks are skipped.  If A is hypersparse, Ah is
+// decompressed in its entirety, since it must be searched for the vectors
+// kfirst:klast.
+
+// If shallow is true, Ab, Ai, and Ax of C may point into the blob, as done by
+// GB_deserialize.  Cp and Ch are always copied, since their values must be
+// shifted for the range.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    if (Ap_shallow) Ap = NULL ;             \
+    if (Ah_shallow) Ah = NULL ;             \
+    GB_FREE (&Ap, Ap_size) ;                \
+    GB_FREE (&Ah, Ah_size) ;                \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_Matrix_free (&C) ;                   \
+}
+
+//------------------------------------------------------------------------------
+// GB_first_vector: find the first k so that Ah [k] >= j
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_first_vector
+(
+    int64_t j,
+    const int64_t *restrict Ah,
+    int64_t anvec
+)
+{
+    int64_t pleft = 0, pright = anvec ;
+    while (pleft < pright)
+    {
+        int64_t pmiddle = (pleft + pright) / 2 ;
+        if (Ah [pmiddle] < j)
+        {
+            pleft = pmiddle + 1 ;
+        }
+        else
+        {
+            pright = pmiddle ;
+        }
+    }
+    return (pleft) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_range
+//------------------------------------------------------------------------------
+
+GrB_Info GB_deserialize_range       // deserialize a range of vectors
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *blob,            // serialized matrix
+    size_t blob_size,               // size of the blob
+    GrB_Index kfirst,               // first vector to deserialize
+    GrB_Index klast,                // last vector to deserialize
+    bool shallow,                   // if true, C may point into the blob
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (blob != NULL && Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    int64_t *Ap = NULL ; size_t Ap_size = 0 ; bool Ap_shallow = false ;
+    int64_t *Ah = NULL ; size_t Ah_size = 0 ; bool Ah_shallow = false ;
+
+    //--------------------------------------------------------------------------
+    // read the content of the header (160 bytes)
+    //--------------------------------------------------------------------------
+
+    size_t s = 0 ;
+
+    if (blob_size < GB_BLOB_HEADER_SIZE)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (blob_size2, uint64_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+    uint64_t blob_size1 = (uint64_t) blob_size ;
+
+    if (blob_size1 != blob_size2
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || (typecode == GB_UDT_code &&
+            blob_size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nblocks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nblocks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nblocks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    if (vlen < 0 || vdim < 0 || nvec < 0 || typesize <= 0)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the range of vectors
+    //--------------------------------------------------------------------------
+
+    if (kfirst > klast || klast >= (GrB_Index) vdim)
+    {
+        GB_ERROR (GrB_INVALID_INDEX, "Vectors " GBu " to " GBu " out of "
+            "range; must be < " GBd, kfirst, klast, vdim) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // blob is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // user-defined name is 128 bytes, if present
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        {
+            // blob is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        s += GxB_MAX_NAME_LEN ;
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        // blob is invalid
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the compressed block sizes from the blob for each array
+    //--------------------------------------------------------------------------
+
+    if (s + sizeof (int64_t) * (
+            (size_t) GB_IMAX (Cp_nblocks, 0) +
+            (size_t) GB_IMAX (Ch_nblocks, 0) +
+            (size_t) GB_IMAX (Cb_nblocks, 0) +
+            (size_t) GB_IMAX (Ci_nblocks, 0) +
+            (size_t) GB_IMAX (Cx_nblocks, 0)) > blob_size)
+    {
+        // blob is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READS (Cp_Sblocks, Cp_nblocks) ;
+    GB_BLOB_READS (Ch_Sblocks, Ch_nblocks) ;
+    GB_BLOB_READS (Cb_Sblocks, Cb_nblocks) ;
+    GB_BLOB_READS (Ci_Sblocks, Ci_nblocks) ;
+    GB_BLOB_READS (Cx_Sblocks, Cx_nblocks) ;
+
+    //--------------------------------------------------------------------------
+    // determine the alignment required for shallow components of C
+    //--------------------------------------------------------------------------
+
+    size_t pi_align = 0, b_align = 0, x_align = 0 ;
+    if (shallow)
+    {
+        pi_align = sizeof (int64_t) ;
+        b_align = 1 ;
+        x_align = 1 ;
+        while (x_align < 16 && (typesize % (2 * x_align)) == 0)
+        {
+            x_align *= 2 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // decompress the part of Ap and Ah that holds the vectors kfirst:klast
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    bool is_sparse_or_hyper = (sparsity == GxB_HYPERSPARSE ||
+        sparsity == GxB_SPARSE) ;
+    int64_t cvdim = klast - kfirst + 1 ;
+    int64_t cnvec = cvdim ;
+    int64_t k1 = kfirst, k2 = klast + 1 ;   // C holds vectors k1:k2-1 of A
+    int64_t pstart = 0, pend = 0 ;          // C holds entries pstart:pend-1
+    GBURBLE ("(deserialize range: " GBu " to " GBu ") ", kfirst, klast) ;
+
+    if (is_sparse_or_hyper)
+    {
+
+        // skip over Ap, for now
+        size_t s_Ap = s ;
+        int64_t Ap_compressed = (Cp_nblocks > 0) ?
+            Cp_Sblocks [Cp_nblocks-1] : 0 ;
+        if (Ap_compressed < 0 || s + Ap_compressed > blob_size)
+        {
+            // blob is invalid
+            return (GrB_INVALID_OBJECT)  ;
+        }
+        s += Ap_compressed ;
+
+        if (sparsity == GxB_HYPERSPARSE)
+        {
+            // decompress all of Ah, and find the vectors kfirst:klast in it
+            if (Ch_len != nvec * (int64_t) sizeof (int64_t))
+            {
+                // blob is invalid
+                return (GrB_INVALID_OBJECT)  ;
+            }
+            GB_OK (GB_deserialize_blob_range ((GB_void **) &Ah, &Ah_size,
+                &Ah_shallow, 0, Ch_len, Ch_len, blob, blob_size, Ch_Sblocks,
+                Ch_nblocks, Ch_method, sizeof (int64_t), &s)) ;
+            k1 = GB_first_vector (kfirst, Ah, nvec) ;
+            k2 = GB_first_vector (klast + 1, Ah, nvec) ;
+            cnvec = k2 - k1 ;
+        }
+
+        // decompress Ap [k1:k2] from the blob
+        GB_OK (GB_deserialize_blob_range ((GB_void **) &Ap, &Ap_size,
+            &Ap_shallow, k1 * sizeof (int64_t), (k2+1) * sizeof (int64_t),
+            Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method, 0,
+            &s_Ap)) ;
+        pstart = Ap [0] ;
+        pend = Ap [cnvec] ;
+        if (pstart < 0 || pstart > pend ||
+            pend > Ci_len / (int64_t) sizeof (int64_t))
+        {
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&C,  // new header (C is NULL on input)
+        ctype, vlen, cvdim,
+        is_sparse_or_hyper ? GB_Ap_malloc : GB_Ap_null, is_csc,
+        sparsity, hyper_switch, cnvec)) ;
+
+    C->nvec = cnvec ;
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    //--------------------------------------------------------------------------
+    // construct Cp and Ch, and decompress Cb
+    //--------------------------------------------------------------------------
+
+    int64_t xstart = 0, xend = 0 ;          // C holds Ax [xstart:xend-1]
+
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+        case GxB_SPARSE :
+        {
+            // Cp = Ap [k1:k2] - pstart, and Ch = Ah [k1:k2-1] - kfirst
+            int64_t *restrict Cp = C->p ;
+            int64_t *restrict Ch = C->h ;
+            int nthreads = GB_nthreads (cnvec + 1, chunk, nthreads_max) ;
+            int64_t k ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k <= cnvec ; k++)
+            {
+                Cp [k] = Ap [k] - pstart ;
+            }
+            if (Ch != NULL)
+            {
+                #pragma omp parallel for num_threads(nthreads) \
+                    schedule(static)
+                for (k = 0 ; k < cnvec ; k++)
+                {
+                    Ch [k] = Ah [k1 + k] - kfirst ;
+                }
+            }
+            C->nvals = pend - pstart ;
+            xstart = pstart ;
+            xend = pend ;
+
+            // decompress Ci [pstart:pend-1]
+            GB_OK (GB_deserialize_blob_range ((GB_void **) &(C->i),
+                &(C->i_size), &(C->i_shallow),
+                pstart * sizeof (int64_t), pend * sizeof (int64_t), Ci_len,
+                blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method, pi_align,
+                &s)) ;
+        }
+        break ;
+
+        case GxB_BITMAP :
+        {
+            // decompress Cb [k1*vlen:k2*vlen-1]
+            xstart = k1 * vlen ;
+            xend = k2 * vlen ;
+            GB_OK (GB_deserialize_blob_range ((GB_void **) &(C->b),
+                &(C->b_size), &(C->b_shallow), xstart, xend, Cb_len,
+                blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method, b_align,
+                &s)) ;
+
+            // count the entries in Cb
+            const int8_t *restrict Cb = C->b ;
+            int64_t cnzmax = xend - xstart ;
+            int nthreads = GB_nthreads (cnzmax, chunk, nthreads_max) ;
+            int64_t p, cnz = 0 ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:cnz)
+            for (p = 0 ; p < cnzmax ; p++)
+            {
+                cnz += (Cb [p] != 0) ;
+            }
+            C->nvals = cnz ;
+        }
+        break ;
+
+        case GxB_FULL :
+            xstart = k1 * vlen ;
+            xend = k2 * vlen ;
+            break ;
+
+        default:
+            // blob is invalid
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // decompress Cx [xstart:xend-1], or all of Cx if C is iso
+    //--------------------------------------------------------------------------
+
+    if (iso)
+    {
+        xstart = 0 ;
+        xend = Cx_len ;
+    }
+    else
+    {
+        xstart *= typesize ;
+        xend *= typesize ;
+    }
+    GB_OK (GB_deserialize_blob_range ((GB_void **) &(C->x), &(C->x_size),
+        &(C->x_shallow), xstart, xend, Cx_len, blob, blob_size,
+        Cx_Sblocks, Cx_nblocks, Cx_method, x_align, &s)) ;
+
+    if (GB_is_shallow (C))
+    {
+        GBURBLE ("(shallow deserialize) ") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    C->magic = GB_MAGIC ;
+    C->nvec_nonempty = GB_nvec_nonempty (C) ;
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize range", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_stream_read: read bytes from a stream into a growing buffer
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The sizes held in the header of a blob read from a stream cannot be trusted
+// until the bytes they describe have actually been read.  This method reads
+// len bytes from the stream into X [offset:offset+len-1], in chunks of at
+// most GB_STREAM_CHUNK bytes, and reallocates X as the bytes arrive, doubling
+// its size each time up to offset+len.  A truncated or corrupted stream that
+// claims a huge size thus fails after allocating at most about twice the
+// space of the bytes actually read from it.
+
+// X may be NULL on input, in which case it is allocated.  On error, X and
+// X_size hold the buffer as reallocated so far, and the caller must free it.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GB_deserialize_stream_read
+(
+    // input/output:
+    GB_void **X_handle,         // buffer, reallocated as needed
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    size_t offset,              // read into X [offset:offset+len-1]
+    size_t len,                 // # of bytes to read
+    GxB_stream_read_function reader,    // function to read from the stream
+    void *stream                // stream passed to the reader
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (X_handle != NULL) ;
+    ASSERT (X_size_handle != NULL) ;
+    ASSERT (reader != NULL) ;
+    GB_void *X = (*X_handle) ;
+    size_t X_size = (*X_size_handle) ;
+    GrB_Info info = GrB_SUCCESS ;
+
+    //--------------------------------------------------------------------------
+    // read the bytes in chunks, growing X as they arrive
+    //--------------------------------------------------------------------------
+
+    size_t xend = offset + len ;
+    for (size_t p = offset ; p < xend && info == GrB_SUCCESS ; )
+    {
+        size_t chunk = GB_IMIN (xend - p, GB_STREAM_CHUNK) ;
+        if (X == NULL || X_size < p + chunk)
+        {
+            // double the size of X, but do not exceed the size needed
+            size_t newsize = GB_IMIN (xend, GB_IMAX (p + chunk, 2 * X_size)) ;
+            bool ok = true ;
+            GB_REALLOC (X, newsize, GB_void, &X_size, &ok) ;
+            if (!ok)
+            {
+                // out of memory
+                info = GrB_OUT_OF_MEMORY ;
+                break ;
+            }
+        }
+        if (!reader (stream, X + p, chunk))
+        {
+            // stream is truncated or cannot be read
+            info = GrB_INVALID_OBJECT ;
+            break ;
+        }
+        p += chunk ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the buffer
+    //--------------------------------------------------------------------------
+
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    return (info) ;
+}
+
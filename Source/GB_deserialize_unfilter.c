@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_unfilter: reverse the filter of a decompressed block
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The inverse of GB_serialize_filter.  The decompressed block in src is
+// unshuffled into the block X [kstart:kend-1] of the array X, and for
+// GB_FILTER_DELTA, the int64_t differences are summed to recover the values.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+void GB_deserialize_unfilter
+(
+    // output:
+    GB_void *restrict dst,          // the block X [kstart:kend-1]
+    // input:
+    const GB_void *restrict src,    // filtered block, of size kend-kstart
+    int64_t kstart,                 // position of the block in X
+    int64_t kend,
+    int32_t filter                  // GB_FILTER_DELTA, or 2 to 16
+)
+{
+
+    //--------------------------------------------------------------------------
+    // find the whole entries in the block
+    //--------------------------------------------------------------------------
+
+    ASSERT (filter >= 1 && filter <= GB_FILTER_MAX) ;
+    int64_t esize = (filter == GB_FILTER_DELTA) ? sizeof (int64_t) : filter ;
+    int64_t n = kend - kstart ;
+    int64_t p0 = GB_IMIN ((esize - (kstart % esize)) % esize, n) ;
+    int64_t m = (n - p0) / esize ;
+    int64_t p1 = p0 + m * esize ;
+
+    //--------------------------------------------------------------------------
+    // copy the partial entries at the start and end of the block
+    //--------------------------------------------------------------------------
+
+    memcpy (dst, src, p0) ;
+    memcpy (dst + p1, src + p1, n - p1) ;
+
+    //--------------------------------------------------------------------------
+    // unfilter the whole entries
+    //--------------------------------------------------------------------------
+
+    src += p0 ;
+    dst += p0 ;
+    if (filter == GB_FILTER_DELTA)
+    {
+        // byte unshuffle and cumulative sum of int64_t values
+        uint64_t x = 0 ;
+        for (int64_t t = 0 ; t < m ; t++)
+        {
+            uint64_t d = 0 ;
+            for (int b = 0 ; b < 8 ; b++)
+            {
+                d |= ((uint64_t) src [b * m + t]) << (8 * b) ;
+            }
+            x += d ;
+            memcpy (dst + t * sizeof (int64_t), &x, sizeof (int64_t)) ;
+        }
+    }
+    else
+    {
+        // byte unshuffle of entries of size esize
+        for (int64_t b = 0 ; b < esize ; b++)
+        {
+            const GB_void *restrict s = src + b * m ;
+            GB_void *restrict d = dst + b ;
+            for (int64_t t = 0 ; t < m ; t++)
+            {
+                d [t * esize] = s [t] ;
+            }
+        }
+    }
+}
@@ -22,9 +22,16 @@
 // A can have any sparsity structure (sparse, hyper, bitmap, or full).
 // A may be jumbled.
 
+// If there are many tasks, the slices are computed in parallel, and the
+// result is kept in A->ek_slice_cache so that it can be reused the next time
+// A is sliced into the same # of tasks, if its pattern has not changed.
+
 #include "GB_ek_slice.h"
 #include "GB_ek_slice_search.c"
 
+// use one thread for each GB_EK_SLICE_CHUNK tasks
+#define GB_EK_SLICE_CHUNK 1024
+
 GB_CALLBACK_EK_SLICE_PROTO (GB_ek_slice)
 {
 
@@ -72,12 +79,42 @@ GB_CALLBACK_EK_SLICE_PROTO (GB_ek_slice)
         return ;
     }
 
+    //--------------------------------------------------------------------------
+    // use the cached slice of A, if available
+    //--------------------------------------------------------------------------
+
+    if (GB_ek_slice_cache_get (A_ek_slicing, A, ntasks))
+    { 
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int nthreads = GB_nthreads (ntasks, GB_EK_SLICE_CHUNK, nthreads_max) ;
+
     //--------------------------------------------------------------------------
     // find the first and last entries in each slice
     //--------------------------------------------------------------------------
 
-    // FUTURE: this can be done in parallel if there are many tasks
-    GB_eslice (pstart_slice, anz, ntasks) ;
+    int taskid ;
+    if (nthreads == 1)
+    { 
+        GB_eslice (pstart_slice, anz, ntasks) ;
+    }
+    else
+    {
+        // same as GB_eslice, in parallel
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (taskid = 1 ; taskid < ntasks ; taskid++)
+        { 
+            pstart_slice [taskid] = (int64_t) GB_PART (taskid, anz, ntasks) ;
+        }
+        pstart_slice [0] = 0 ;
+        pstart_slice [ntasks] = anz ;
+    }
 
     //--------------------------------------------------------------------------
     // find the first and last vectors in each slice
@@ -91,8 +128,8 @@ GB_CALLBACK_EK_SLICE_PROTO (GB_ek_slice)
     // pstart_slice [taskid+1]-1 is in the range Ap [k]...A[k+1]-1, and this
     // is vector is k = klast_slice [taskid].
 
-    // FUTURE: this can be done in parallel if there are many tasks
-    for (int taskid = 0 ; taskid < ntasks ; taskid++)
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (taskid = 0 ; taskid < ntasks ; taskid++)
     { 
         GB_ek_slice_search (taskid, ntasks, pstart_slice, Ap, anvec, avlen,
             kfirst_slice, klast_slice) ;
@@ -100,5 +137,11 @@ GB_CALLBACK_EK_SLICE_PROTO (GB_ek_slice)
 
     ASSERT (kfirst_slice [0] == 0) ;
     ASSERT (klast_slice  [ntasks-1] == anvec-1) ;
+
+    //--------------------------------------------------------------------------
+    // cache the slice of A, if it has many tasks
+    //--------------------------------------------------------------------------
+
+    GB_ek_slice_cache_put (A_ek_slicing, A, ntasks) ;
 }
 
@@ -46,6 +46,57 @@ void GB_ek_slice_merge2     // merge final results for matrix C
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_ek_slice_cache: the last slice of a matrix, kept for reuse
+//------------------------------------------------------------------------------
+
+// The slice computed by GB_ek_slice depends only on A->p, A->nvec, A->vlen,
+// nnz_held(A), and the # of tasks.  The last slice with many tasks of a sparse
+// or hypersparse matrix is kept in A->ek_slice_cache, and it is reused if A is
+// sliced again into the same # of tasks before its pattern changes.  The
+// pattern of A is described by its pattern_version, and the key also holds
+// the rest of the inputs to GB_ek_slice as a safeguard.
+
+// slices with fewer tasks than this are not cached
+#define GB_EK_SLICE_CACHE_MIN 256
+
+typedef struct
+{
+    int64_t pattern_version ;   // A->pattern_version
+    int64_t anz_held ;          // nnz_held (A)
+    int64_t anvec ;             // A->nvec
+    int64_t avlen ;             // A->vlen
+    int64_t Ap ;                // address of A->p
+    int64_t Ah ;                // address of A->h
+    int64_t ntasks ;            // # of tasks
+}
+GB_ek_slice_key ;
+
+struct GB_ek_slice_cache_struct     // content of A->ek_slice_cache
+{
+    size_t header_size ;        // size of the malloc'd block for this struct
+    GB_ek_slice_key key ;       // the inputs that defined the slice
+    int64_t *ek_slicing ;       // the slice, of size 3*ntasks+1
+    size_t ek_slicing_size ;
+} ;
+
+bool GB_ek_slice_cache_get      // get a cached slice of A, if available
+(
+    // output
+    int64_t *restrict A_ek_slicing, // size 3*ntasks+1
+    // input
+    GrB_Matrix A,                   // matrix to slice
+    int ntasks                      // # of tasks
+) ;
+
+void GB_ek_slice_cache_put      // cache the slice of A
+(
+    // input
+    const int64_t *restrict A_ek_slicing,   // size 3*ntasks+1
+    GrB_Matrix A,                   // matrix that was sliced
+    int ntasks                      // # of tasks
+) ;
+
 //------------------------------------------------------------------------------
 // GB_get_pA_and_pC: find the part of A(:,k) and C(:,k) for this task
 //------------------------------------------------------------------------------
@@ -0,0 +1,218 @@
+//------------------------------------------------------------------------------
+// GB_ek_slice_cache: cache and reuse the slice of a matrix for GB_ek_slice
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The last slice of a matrix A computed by GB_ek_slice with many tasks is kept
+// in A->ek_slice_cache, and reused if A is sliced again into the same number
+// of tasks and its pattern has not changed.  This is common when the same
+// matrix is used as an input to many elementwise, apply, select, or assign
+// operations, each of which slices it.
+
+// Only sparse and hypersparse matrices are considered, since the slice of a
+// bitmap or full matrix is trivial to compute.  A must own its A->p and A->h
+// arrays, since a matrix with shallow content might not be freed with
+// GB_phybix_free, which is required to free A->ek_slice_cache.
+
+// A matrix can be an input to many user threads at the same time, each of
+// which may slice it, so access to A->ek_slice_cache is protected by a
+// critical section.
+
+#include "GB_ek_slice.h"
+
+//------------------------------------------------------------------------------
+// GB_ek_slice_cache_ok: determine if the slice of A can be cached
+//------------------------------------------------------------------------------
+
+static inline bool GB_ek_slice_cache_ok
+(
+    const GrB_Matrix A,
+    const int ntasks
+)
+{
+    return ((GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) &&
+            A->pattern_version != 0 && ntasks >= GB_EK_SLICE_CACHE_MIN &&
+            !A->p_shallow && !A->h_shallow) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_ek_slice_key_construct: construct the key for the slice of A
+//------------------------------------------------------------------------------
+
+static inline void GB_ek_slice_key_construct
+(
+    GB_ek_slice_key *key,
+    const GrB_Matrix A,
+    const int ntasks
+)
+{
+    // clear the whole key so that it can be compared with memcmp
+    memset (key, 0, sizeof (GB_ek_slice_key)) ;
+    key->pattern_version = A->pattern_version ;
+    key->anz_held = GB_nnz_held (A) ;
+    key->anvec = A->nvec ;
+    key->avlen = A->vlen ;
+    key->Ap = (int64_t) ((uintptr_t) A->p) ;
+    key->Ah = (int64_t) ((uintptr_t) A->h) ;
+    key->ntasks = ntasks ;
+}
+
+//------------------------------------------------------------------------------
+// GB_ek_slice_cache_get: get a cached slice of A, if available
+//------------------------------------------------------------------------------
+
+// If found, the cached slice is copied into A_ek_slicing and true is returned.
+// A->ek_slice_cache is only read inside the critical section, since another
+// user thread slicing the same matrix can replace it at any time.
+
+bool GB_ek_slice_cache_get      // get a cached slice of A, if available
+(
+    // output
+    int64_t *restrict A_ek_slicing, // size 3*ntasks+1
+    // input
+    GrB_Matrix A,                   // matrix to slice
+    int ntasks                      // # of tasks
+)
+{
+
+    if (!GB_ek_slice_cache_ok (A, ntasks))
+    { 
+        // the slice of A cannot be cached
+        return (false) ;
+    }
+
+    GB_ek_slice_key key ;
+    GB_ek_slice_key_construct (&key, A, ntasks) ;
+    bool found = false ;
+    #pragma omp critical (GB_ek_slice_cache)
+    {
+        GB_ek_slice_cache S = A->ek_slice_cache ;
+        if (S != NULL && memcmp (&key, &(S->key), sizeof (GB_ek_slice_key))==0)
+        { 
+            // the cached slice is for the same pattern and # of tasks
+            memcpy (A_ek_slicing, S->ek_slicing,
+                (3 * ((int64_t) ntasks) + 1) * sizeof (int64_t)) ;
+            found = true ;
+        }
+    }
+    if (found) GBURBLE ("(cached slice) ") ;
+    return (found) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_ek_slice_cache_put: cache the slice of A
+//------------------------------------------------------------------------------
+
+// Any prior slice cached in A is replaced.  Its space is reused if it is large
+// enough, so that a matrix sliced many times (with a pattern that changes
+// between each slice) does not malloc and free the cache each time.  The
+// cache is optional, so if out of memory, no slice is cached and no error is
+// returned.
+
+void GB_ek_slice_cache_put      // cache the slice of A
+(
+    // input
+    const int64_t *restrict A_ek_slicing,   // size 3*ntasks+1
+    GrB_Matrix A,                   // matrix that was sliced
+    int ntasks                      // # of tasks
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (!GB_ek_slice_cache_ok (A, ntasks))
+    { 
+        return ;
+    }
+
+    int64_t n = 3 * ((int64_t) ntasks) + 1 ;
+    GB_ek_slice_key key ;
+    GB_ek_slice_key_construct (&key, A, ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // reuse the prior cache in A, if it is large enough
+    //--------------------------------------------------------------------------
+
+    bool done = false ;
+    #pragma omp critical (GB_ek_slice_cache)
+    {
+        GB_ek_slice_cache S = A->ek_slice_cache ;
+        if (S != NULL && S->ek_slicing_size >= n * sizeof (int64_t))
+        { 
+            memcpy (&(S->key), &key, sizeof (GB_ek_slice_key)) ;
+            memcpy (S->ek_slicing, A_ek_slicing, n * sizeof (int64_t)) ;
+            done = true ;
+        }
+    }
+    if (done)
+    { 
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate a new cache
+    //--------------------------------------------------------------------------
+
+    size_t header_size = 0, ek_slicing_size = 0 ;
+    GB_ek_slice_cache S = GB_MALLOC (1, struct GB_ek_slice_cache_struct,
+        &header_size) ;
+    if (S == NULL)
+    { 
+        // out of memory; do not cache the slice
+        return ;
+    }
+    S->header_size = header_size ;
+    S->ek_slicing = GB_MALLOC (n, int64_t, &ek_slicing_size) ;
+    S->ek_slicing_size = ek_slicing_size ;
+    if (S->ek_slicing == NULL)
+    { 
+        // out of memory; do not cache the slice
+        GB_FREE (&S, header_size) ;
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // save the slice and its key in A, replacing any prior slice
+    //--------------------------------------------------------------------------
+
+    memcpy (&(S->key), &key, sizeof (GB_ek_slice_key)) ;
+    memcpy (S->ek_slicing, A_ek_slicing, n * sizeof (int64_t)) ;
+    GB_ek_slice_cache S_old ;
+    #pragma omp critical (GB_ek_slice_cache)
+    {
+        S_old = A->ek_slice_cache ;
+        A->ek_slice_cache = S ;
+    }
+    if (S_old != NULL)
+    { 
+        GB_FREE (&(S_old->ek_slicing), S_old->ek_slicing_size) ;
+        GB_FREE (&S_old, S_old->header_size) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_ek_slice_cache_free: free A->ek_slice_cache of a matrix
+//------------------------------------------------------------------------------
+
+void GB_ek_slice_cache_free     // free A->ek_slice_cache of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+)
+{
+
+    if (A != NULL && A->ek_slice_cache != NULL)
+    { 
+        GB_ek_slice_cache S = A->ek_slice_cache ;
+        GB_FREE (&(S->ek_slicing), S->ek_slicing_size) ;
+        GB_FREE (&(A->ek_slice_cache), S->header_size) ;
+    }
+}
+
@@ -22,7 +22,10 @@ uint64_t GB_encodify_select     // encode an select problem
     const bool in_place_A,
     const GrB_IndexUnaryOp op,
     const bool flipij,
-    const GrB_Matrix A
+    const GrB_Matrix A,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp
 )
 { 
 
@@ -43,7 +46,8 @@ uint64_t GB_encodify_select     // encode an select problem
     //--------------------------------------------------------------------------
 
     encoding->kcode = kcode ;
-    GB_enumify_select (&encoding->code, C_iso, in_place_A, op, flipij, A) ;
+    GB_enumify_select (&encoding->code, C_iso, in_place_A, op, flipij, A,
+        M, Mask_struct, Mask_comp) ;
 
     //--------------------------------------------------------------------------
     // determine the suffix and its length
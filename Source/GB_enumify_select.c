@@ -10,8 +10,10 @@
 #include "GB.h"
 #include "GB_stringify.h"
 
-// Currently, the mask M and the accum are not present, and C and A have the
-// same type, but these conditions may change in the future.
+// Currently, the accum is not present, and C and A have the same type, but
+// these conditions may change in the future.  The mask M is present only for
+// the masked selector, GB_select_masked.  In that case, C has the sparsity
+// structure of M if M is sparse or hypersparse, or of A otherwise.
 
 void GB_enumify_select      // enumerate a GrB_selectproblem
 (
@@ -24,7 +26,11 @@ void GB_enumify_select      // enumerate a GrB_selectproblem
     GrB_IndexUnaryOp op,    // the index unary operator to enumify
     bool flipij,            // if true, flip i and j
     // A matrix:
-    GrB_Matrix A
+    GrB_Matrix A,
+    // mask matrix:
+    GrB_Matrix M,           // may be NULL
+    bool Mask_struct,
+    bool Mask_comp
 )
 {
 
@@ -81,7 +87,14 @@ void GB_enumify_select      // enumerate a GrB_selectproblem
     int A_sparsity = GB_sparsity (A) ;
     int C_sparsity ;
 
-    if (opcode == GB_DIAG_idxunop_code)
+    if (M != NULL)
+    { 
+        // C has the pattern of M if M is sparse or hypersparse, or A otherwise
+        int M_sparsity = GB_sparsity (M) ;
+        C_sparsity = (M_sparsity == GxB_SPARSE ||
+                      M_sparsity == GxB_HYPERSPARSE) ? M_sparsity : A_sparsity ;
+    }
+    else if (opcode == GB_DIAG_idxunop_code)
     { 
         C_sparsity = (A_sparsity == GxB_FULL) ? GxB_SPARSE : A_sparsity ;
     }
@@ -96,14 +109,32 @@ void GB_enumify_select      // enumerate a GrB_selectproblem
 
     int inplace = (in_place_A) ? 1 : 0 ;
 
+    //--------------------------------------------------------------------------
+    // enumify the mask
+    //--------------------------------------------------------------------------
+
+    // mask_ecode and msparsity are both zero if M is not present
+    int mtype_code = (M == NULL) ? 0 : M->type->code ;
+    int mask_ecode, msparsity = 0 ;
+    GB_enumify_mask (&mask_ecode, mtype_code, Mask_struct, Mask_comp) ;
+    if (M != NULL)
+    { 
+        GB_enumify_sparsity (&msparsity, GB_sparsity (M)) ;
+    }
+
     //--------------------------------------------------------------------------
     // construct the select scode
     //--------------------------------------------------------------------------
 
-    // total scode bits:  38 (10 hex digits)
+    // total scode bits:  44 (11 hex digits); the top hex digit is zero if
+    // M is not present
 
     (*scode) =
                                                // range        bits
+                // mask (6 bits)
+                GB_LSHIFT (msparsity  , 42) |  // 0 to 3       2
+                GB_LSHIFT (mask_ecode , 38) |  // 0 to 13      4
+
                 // iso of A aand C (2 bits)
                 GB_LSHIFT (C_iso_code , 37) |  // 0 or 1       1
                 GB_LSHIFT (A_iso_code , 36) |  // 0 or 1       1
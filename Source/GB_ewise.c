@@ -308,7 +308,8 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
         && no_typecast                      // no typecasting
         && !op_is_positional                // op is not positional
         && !any_bitmap                      // no bitmap matrices
-        && !any_pending_work)               // no matrix has pending work
+        && !any_pending_work                // no matrix has pending work
+        && !GB_is_shallow (C))              // C can be modified in place
     {
 
         if (GB_IS_FULL (C)                  // C is full
@@ -111,6 +111,12 @@ GrB_Info GB_export      // export/unpack a matrix in any format
         default: ;
     }
 
+    //--------------------------------------------------------------------------
+    // the exported arrays are owned by the user, so none can be shallow
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_unshallow (*A)) ;
+
     //--------------------------------------------------------------------------
     // allocate new space for Ap and Ah if unpacking
     //--------------------------------------------------------------------------
@@ -55,6 +55,11 @@ GrB_Matrix GB_hyper_shallow         // return C
     C->Y = NULL ;
     C->Y_shallow = false ;
 
+    // C has its own pattern_version, and no saxpy3 schedule or ek_slice
+    C->saxpy3_schedule = NULL ;
+    C->ek_slice_cache = NULL ;
+    GB_PATTERN_CHANGED (C) ;
+
     // flag all content of C as shallow
     C->p_shallow = true ;
     C->i_shallow = true ;
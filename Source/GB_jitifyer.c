@@ -13,6 +13,7 @@
 #include "GB_zstd.h"
 #include "GB_JITpackage.h"
 #include "GB_file.h"
+#include <ctype.h>
 
 typedef GB_JIT_KERNEL_USER_OP_PROTO ((*GB_user_op_f)) ;
 typedef GB_JIT_KERNEL_USER_TYPE_PROTO ((*GB_user_type_f)) ;
@@ -26,6 +27,30 @@ typedef GB_JIT_KERNEL_USER_TYPE_PROTO ((*GB_user_type_f)) ;
 // is either zero (at the beginning), or a power of two (of size
 // GB_JITIFIER_INITIAL_SIZE or more).
 
+// The hash table may be searched by any user thread without a critical
+// section (see GB_jitifyer_lookup), while entries are inserted or removed only
+// inside the GB_jitifyer_worker critical section.  To make this safe, the
+// insertion of an entry writes its dl_function last, so a reader that finds a
+// non-NULL dl_function also sees the rest of the entry.  When the table is
+// expanded, the new table is published (GB_jit_table) before its hash mask
+// (GB_jit_table_bits), and readers read them in the opposite order.  Thus a
+// reader never uses a mask larger than the table it searches.  The prior table
+// is not freed, since a reader may still be searching it.  Instead, it is
+// retired, and freed only when the whole hash table is freed (when the JIT is
+// turned off, or by GrB_finalize).  The tables grow by a factor of 4 each
+// time, so the retired tables take less space than the current one.
+
+// An entry is never rewritten while a reader can reach it.  An entry removed
+// from the table (an invalid PreJIT kernel, or a changed user-defined type or
+// operator) is left in place as a dead entry: its dl_function is set to
+// GB_JIT_DEAD, and its hash, encoding, and suffix are left unchanged, so a
+// reader comparing it with its own problem sees a consistent entry.  Readers
+// skip dead entries, and GB_jitifyer_insert only fills empty entries, never
+// dead ones, so a kernel that is inserted again is appended after its dead
+// entry.  Dead entries are dropped when the table is expanded, since the new
+// table is built and then published.  The suffix of a dead entry is retired,
+// and freed along with the retired tables.
+
 // The strings are used to create filenames and JIT compilation commands.
 
 #define GB_JITIFIER_INITIAL_SIZE (32*1024)
@@ -34,8 +59,24 @@ static GB_jit_entry *GB_jit_table = NULL ;
 static int64_t  GB_jit_table_size = 0 ;  // always a power of 2
 static uint64_t GB_jit_table_bits = 0 ;  // hash mask (0xFFFF if size is 2^16)
 static int64_t  GB_jit_table_populated = 0 ;
+static int64_t  GB_jit_table_dead = 0 ;  // # of dead entries in the table
 static size_t   GB_jit_table_allocated = 0 ;
 
+// prior hash tables, not yet freed:
+#define GB_JITIFIER_MAX_RETIRED 64
+static GB_jit_entry *GB_jit_table_retired [GB_JITIFIER_MAX_RETIRED] ;
+static int GB_jit_table_nretired = 0 ;
+
+// suffixes of entries removed from the hash table, not yet freed:
+static char **GB_jit_suffix_retired = NULL ;
+static int64_t GB_jit_suffix_nretired = 0 ;
+static int64_t GB_jit_suffix_maxretired = 0 ;
+
+// dl_function of a dead entry: any non-NULL pointer that is not a kernel
+#define GB_JIT_DEAD ((void *) (&GB_jit_table_dead))
+#define GB_JIT_LIVE(dl_function) \
+    ((dl_function) != NULL && (dl_function) != GB_JIT_DEAD)
+
 static bool GB_jit_use_cmake =
     #if GB_WINDOWS
     true ;      // Windows requires cmake
@@ -51,6 +92,21 @@ static size_t   GB_jit_cache_path_allocated = 0 ;
 static char    *GB_jit_error_log = NULL ;
 static size_t   GB_jit_error_log_allocated = 0 ;
 
+// path to file that records the kernels used:
+static char    *GB_jit_record = NULL ;
+static size_t   GB_jit_record_allocated = 0 ;
+
+// JIT archive: a single library holding many kernels (see GxB_JIT_archive).
+// Its kernels are treated as PreJIT kernels, with a prejit_index offset by the
+// number of PreJIT kernels compiled into GraphBLAS itself.
+#define GB_JIT_ARCHIVE_NAME "GB_jit_archive"
+typedef void (*GB_jit_archive_func)
+    (int32_t *nkernels, void ***Kernels, void ***Queries, char ***Names) ;
+static void    *GB_jit_archive_handle = NULL ;
+static int32_t  GB_jit_archive_nkernels = 0 ;
+static void   **GB_jit_archive_queries = NULL ;
+static char   **GB_jit_archive_names = NULL ;
+
 // name of the C compiler:
 static char    *GB_jit_C_compiler = NULL ;
 static size_t   GB_jit_C_compiler_allocated = 0 ;
@@ -89,6 +145,81 @@ static size_t   GB_jit_temp_allocated = 0 ;
 
 static GxB_JIT_Control GB_jit_control = GB_JIT_C_CONTROL_INIT ;
 
+//------------------------------------------------------------------------------
+// asynchronous compilation: static objects
+//------------------------------------------------------------------------------
+
+// If GB_jit_async is true, a kernel that must be compiled is not compiled by
+// the user thread that needs it.  Instead, its source file is created and its
+// compilation is queued for a single background thread, and the user thread
+// punts to its generic (or factory) kernel.  Subsequent calls that need the
+// same kernel find it still pending (and again use the generic kernel), or
+// find it compiled, at which point it is loaded into the hash table and used
+// from then on.  This requires POSIX threads and the direct compile method;
+// otherwise, kernels are always compiled synchronously.
+
+#if !defined ( NJIT ) && !GB_WINDOWS
+#define GB_JIT_ASYNC_SUPPORTED 1
+#include <pthread.h>
+#else
+#define GB_JIT_ASYNC_SUPPORTED 0
+#endif
+
+static bool GB_jit_async = false ;
+
+#if GB_JIT_ASYNC_SUPPORTED
+
+#define GB_JIT_ASYNC_NONE      0    // kernel is not in the queue
+#define GB_JIT_ASYNC_PENDING   1    // kernel is queued or being compiled
+#define GB_JIT_ASYNC_DONE      2    // compilation has finished
+
+typedef struct GB_jit_async_struct GB_jit_async_request ;
+
+struct GB_jit_async_struct
+{
+    GB_jit_async_request *next ;    // next request in the queue
+    uint64_t hash ;                 // hash code for the kernel
+    GB_jit_encoding encoding ;      // encoding of the problem
+    char *suffix ;                  // kernel suffix (NULL for builtin)
+    char *command ;                 // command to compile and link the kernel
+    char *obj_file ;                // *.o file to remove when done
+    char *lock_file ;               // kernel lock file
+    int status ;                    // GB_JIT_ASYNC_PENDING or _DONE
+    bool started ;                  // true if the compilation has started
+} ;
+
+// The queue is guarded by GB_jit_async_mutex, not by the
+// GB_jitifyer_worker critical section, since the background thread never
+// enters that critical section.
+static GB_jit_async_request *GB_jit_async_queue = NULL ;
+static pthread_mutex_t GB_jit_async_mutex = PTHREAD_MUTEX_INITIALIZER ;
+static pthread_cond_t  GB_jit_async_cond  = PTHREAD_COND_INITIALIZER ;
+static pthread_t GB_jit_async_thread ;
+static bool GB_jit_async_running = false ;     // true if the thread exists
+static bool GB_jit_async_shutdown = false ;    // true to terminate the thread
+
+static int GB_jitifyer_async_status
+(
+    uint64_t hash,
+    GB_jit_encoding *encoding,
+    const char *suffix
+) ;
+
+static bool GB_jitifyer_async_enqueue
+(
+    char *kernel_name,
+    uint32_t bucket,
+    uint64_t hash,
+    GB_jit_encoding *encoding,
+    const char *suffix
+) ;
+
+static void GB_jitifyer_async_stop (void) ;
+
+#endif
+
+static void GB_jitifyer_command (char *command) ;
+
 //------------------------------------------------------------------------------
 // check_table: check if the hash table is OK
 //------------------------------------------------------------------------------
@@ -96,13 +227,17 @@ static GxB_JIT_Control GB_jit_control = GB_JIT_C_CONTROL_INIT ;
 #ifdef GB_DEBUG
 static void check_table (void)
 {
-    int64_t populated = 0 ;
+    int64_t populated = 0, dead = 0 ;
     if (GB_jit_table != NULL)
     {
         for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
         {
             GB_jit_entry *e = &(GB_jit_table [k]) ;
-            if (e->dl_function != NULL)
+            if (e->dl_function == GB_JIT_DEAD)
+            {
+                dead++ ;
+            }
+            else if (e->dl_function != NULL)
             {
                 uint64_t hash = e->hash ;
                 uint64_t k2 = (hash & GB_jit_table_bits) ;
@@ -111,6 +246,7 @@ static void check_table (void)
         }
     }
     ASSERT (populated == GB_jit_table_populated) ;
+    ASSERT (dead == GB_jit_table_dead) ;
 }
 #define ASSERT_TABLE_OK check_table ( ) ;
 #else
@@ -199,9 +335,21 @@ static void check_table (void)
 
 void GB_jitifyer_finalize (void)
 { 
+    #if GB_JIT_ASYNC_SUPPORTED
+    GB_jitifyer_async_stop ( ) ;
+    #endif
     GB_jitifyer_table_free (true) ;
+    if (GB_jit_archive_handle != NULL)
+    { 
+        GB_file_dlclose (GB_jit_archive_handle) ;
+        GB_jit_archive_handle = NULL ;
+    }
+    GB_jit_archive_nkernels = 0 ;
+    GB_jit_archive_queries = NULL ;
+    GB_jit_archive_names = NULL ;
     GB_FREE_STUFF (GB_jit_cache_path) ;
     GB_FREE_STUFF (GB_jit_error_log) ;
+    GB_FREE_STUFF (GB_jit_record) ;
     GB_FREE_STUFF (GB_jit_C_compiler) ;
     GB_FREE_STUFF (GB_jit_C_flags) ;
     GB_FREE_STUFF (GB_jit_C_link_flags) ;
@@ -211,6 +359,289 @@ void GB_jitifyer_finalize (void)
     GB_FREE_STUFF (GB_jit_temp) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_kcode: find the kcode of a kname
+//------------------------------------------------------------------------------
+
+// Returns GB_JIT_KERNEL_NONE if the kname is not valid.
+
+GB_jit_kcode GB_jitifyer_kcode (const char *kname)
+{
+
+    #define IS(kernel) GB_STRING_MATCH (kname, kernel)
+
+    GB_jit_kcode c = GB_JIT_KERNEL_NONE ;
+    if      (IS ("add"          )) c = GB_JIT_KERNEL_ADD ;
+    else if (IS ("apply_bind1st")) c = GB_JIT_KERNEL_APPLYBIND1 ;
+    else if (IS ("apply_bind2nd")) c = GB_JIT_KERNEL_APPLYBIND2 ;
+    else if (IS ("apply_unop"   )) c = GB_JIT_KERNEL_APPLYUNOP ;
+    else if (IS ("AxB_dot2"     )) c = GB_JIT_KERNEL_AXB_DOT2 ;
+    else if (IS ("AxB_dot2n"    )) c = GB_JIT_KERNEL_AXB_DOT2N ;
+    else if (IS ("AxB_dot3"     )) c = GB_JIT_KERNEL_AXB_DOT3 ;
+    else if (IS ("AxB_dot4"     )) c = GB_JIT_KERNEL_AXB_DOT4 ;
+    else if (IS ("AxB_outer"    )) c = GB_JIT_KERNEL_AXB_OUTER ;
+    else if (IS ("AxB_saxbit"   )) c = GB_JIT_KERNEL_AXB_SAXBIT ;
+    else if (IS ("AxB_saxpy3"   )) c = GB_JIT_KERNEL_AXB_SAXPY3 ;
+    else if (IS ("AxB_saxpy4"   )) c = GB_JIT_KERNEL_AXB_SAXPY4 ;
+    else if (IS ("AxB_saxpy5"   )) c = GB_JIT_KERNEL_AXB_SAXPY5 ;
+    else if (IS ("build"        )) c = GB_JIT_KERNEL_BUILD ;
+    else if (IS ("colscale"     )) c = GB_JIT_KERNEL_COLSCALE ;
+    else if (IS ("concat_bitmap")) c = GB_JIT_KERNEL_CONCAT_BITMAP ;
+    else if (IS ("concat_full"  )) c = GB_JIT_KERNEL_CONCAT_FULL ;
+    else if (IS ("concat_sparse")) c = GB_JIT_KERNEL_CONCAT_SPARSE ;
+    else if (IS ("convert_s2b"  )) c = GB_JIT_KERNEL_CONVERTS2B ;
+    else if (IS ("emult_02"     )) c = GB_JIT_KERNEL_EMULT2 ;
+    else if (IS ("emult_03"     )) c = GB_JIT_KERNEL_EMULT3 ;
+    else if (IS ("emult_04"     )) c = GB_JIT_KERNEL_EMULT4 ;
+    else if (IS ("emult_08"     )) c = GB_JIT_KERNEL_EMULT8 ;
+    else if (IS ("emult_bitmap" )) c = GB_JIT_KERNEL_EMULT_BITMAP ;
+    else if (IS ("ewise_fulla"  )) c = GB_JIT_KERNEL_EWISEFA ;
+    else if (IS ("ewise_fulln"  )) c = GB_JIT_KERNEL_EWISEFN ;
+    else if (IS ("kroner"       )) c = GB_JIT_KERNEL_KRONER ;
+    else if (IS ("reduce"       )) c = GB_JIT_KERNEL_REDUCE ;
+    else if (IS ("rowscale"     )) c = GB_JIT_KERNEL_ROWSCALE ;
+    else if (IS ("select_bitmap")) c = GB_JIT_KERNEL_SELECT_BITMAP ;
+    else if (IS ("select_masked")) c = GB_JIT_KERNEL_SELECT_MASKED ;
+    else if (IS ("select_phase1")) c = GB_JIT_KERNEL_SELECT1 ;
+    else if (IS ("select_phase2")) c = GB_JIT_KERNEL_SELECT2 ;
+    else if (IS ("split_bitmap" )) c = GB_JIT_KERNEL_SPLIT_BITMAP ;
+    else if (IS ("split_full"   )) c = GB_JIT_KERNEL_SPLIT_FULL ;
+    else if (IS ("split_sparse" )) c = GB_JIT_KERNEL_SPLIT_SPARSE ;
+    else if (IS ("subassign_05d")) c = GB_JIT_KERNEL_SUBASSIGN_05d ;
+    else if (IS ("subassign_06d")) c = GB_JIT_KERNEL_SUBASSIGN_06d ;
+    else if (IS ("subassign_22" )) c = GB_JIT_KERNEL_SUBASSIGN_22 ;
+    else if (IS ("subassign_23" )) c = GB_JIT_KERNEL_SUBASSIGN_23 ;
+    else if (IS ("subassign_25" )) c = GB_JIT_KERNEL_SUBASSIGN_25 ;
+    else if (IS ("trans_bind1st")) c = GB_JIT_KERNEL_TRANSBIND1 ;
+    else if (IS ("trans_bind2nd")) c = GB_JIT_KERNEL_TRANSBIND2 ;
+    else if (IS ("trans_unop"   )) c = GB_JIT_KERNEL_TRANSUNOP ;
+    else if (IS ("union"        )) c = GB_JIT_KERNEL_UNION ;
+    else if (IS ("user_op"      )) c = GB_JIT_KERNEL_USEROP ;
+    else if (IS ("user_type"    )) c = GB_JIT_KERNEL_USERTYPE ;
+
+    #undef IS
+    return (c) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_prejit_insert: insert a list of PreJIT kernels in the hash table
+//------------------------------------------------------------------------------
+
+// The kernels are either PreJIT kernels compiled into GraphBLAS itself
+// (k0 = 0), or the kernels in a JIT archive (k0 = # of PreJIT kernels).  The
+// prejit_index of the kth kernel in the list is k0+k.  Invalid, stale, and
+// duplicate kernels are ignored.
+
+static GrB_Info GB_jitifyer_prejit_insert
+(
+    int32_t nkernels,           // # of kernels in the list
+    void **Kernels,             // list of function pointers to kernels
+    void **Queries,             // list of function pointers to queries
+    char **Names,               // list of kernel names
+    int64_t k0                  // prejit_index of the first kernel
+)
+{
+
+    for (int k = 0 ; k < nkernels ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the name and function pointer of the PreJIT kernel
+        //----------------------------------------------------------------------
+
+        void *dl_function = Kernels [k] ;
+        GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k] ;
+        ASSERT (dl_function != NULL && dl_query != NULL && Names [k] != NULL) ;
+        char kernel_name [GB_KLEN+1] ;
+        strncpy (kernel_name, Names [k], GB_KLEN) ;
+        kernel_name [GB_KLEN] = '\0' ;
+
+        //----------------------------------------------------------------------
+        // parse the kernel name
+        //----------------------------------------------------------------------
+
+        char *name_space = NULL ;
+        char *kname = NULL ;
+        uint64_t scode = 0 ;
+        char *suffix = NULL ;
+        GrB_Info info = GB_demacrofy_name (kernel_name, &name_space, &kname,
+            &scode, &suffix) ;
+
+        if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit"))
+        {
+            // PreJIT error: kernel_name is invalid; ignore this kernel
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // find the kcode of the kname
+        //----------------------------------------------------------------------
+
+        GB_jit_encoding encoding_struct ;
+        GB_jit_encoding *encoding = &encoding_struct ;
+        memset (encoding, 0, sizeof (GB_jit_encoding)) ;
+
+        GB_jit_kcode c = GB_jitifyer_kcode (kname) ;
+        if (c == GB_JIT_KERNEL_NONE)
+        {
+            // PreJIT error: kernel_name is invalid; ignore this kernel
+            continue ;
+        }
+
+        encoding->kcode = c ;
+        encoding->code = scode ;
+        encoding->suffix_len = (suffix == NULL) ? 0 :
+            ((int32_t) strlen (suffix)) ;
+
+        //----------------------------------------------------------------------
+        // get the hash of this PreJIT kernel
+        //----------------------------------------------------------------------
+
+        // Query the kernel for its hash and version number.  The hash is
+        // needed now so the PreJIT kernel can be added to the hash table.
+
+        // The type/op definitions and monoid id/term values for user-defined
+        // types/ops/ monoids are ignored, because the user-defined objects
+        // have not yet been created during this use of GraphBLAS (this method
+        // is called by GrB_init).  These definitions are checked the first
+        // time the kernel is run.
+
+        uint64_t hash = 0 ;
+        char *ignored [5] ;
+        int version [3] ;
+        (void) dl_query (&hash, version, ignored, NULL, NULL, 0, 0) ;
+
+        if (hash == 0 || hash == UINT64_MAX ||
+            (version [0] != GxB_IMPLEMENTATION_MAJOR) ||
+            (version [1] != GxB_IMPLEMENTATION_MINOR) ||
+            (version [2] != GxB_IMPLEMENTATION_SUB))
+        {
+            // PreJIT error: the kernel is stale; ignore it
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // make sure this kernel is not a duplicate
+        //----------------------------------------------------------------------
+
+        int64_t k1 = -1, kk = -1 ;
+        if (GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) != NULL)
+        {
+            // PreJIT error: the kernel is a duplicate; ignore it
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // insert the PreJIT kernel in the hash table
+        //----------------------------------------------------------------------
+
+        if (!GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function,
+            k0 + k))
+        {
+            // PreJIT error: out of memory
+            GB_jit_control = GxB_JIT_PAUSE ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_prejit_get: get the query and name of a PreJIT kernel
+//------------------------------------------------------------------------------
+
+static void GB_jitifyer_prejit_get
+(
+    // output:
+    GB_jit_query_func *dl_query,    // query function of the kernel
+    char **name,                    // name of the kernel
+    // input:
+    int64_t k1                      // prejit_index of the kernel
+)
+{
+    void **Kernels = NULL ;
+    void **Queries = NULL ;
+    char **Names = NULL ;
+    int32_t nkernels = 0 ;
+    GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
+    if (k1 >= nkernels)
+    { 
+        // the kernel is in the JIT archive
+        k1 -= nkernels ;
+        ASSERT (k1 < GB_jit_archive_nkernels) ;
+        Queries = GB_jit_archive_queries ;
+        Names = GB_jit_archive_names ;
+    }
+    (*dl_query) = (GB_jit_query_func) Queries [k1] ;
+    (*name) = Names [k1] ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_archive_load: load the JIT archive, if it exists
+//------------------------------------------------------------------------------
+
+// The JIT archive is the single library lib/libGB_jit_archive.so in the cache
+// folder, created by GxB_JIT_archive.  It is loaded once, and all of its
+// kernels are inserted in the hash table as unchecked PreJIT kernels.  If no
+// archive exists, or if one has already been loaded, nothing is done.
+
+static GrB_Info GB_jitifyer_archive_load (void)
+{
+
+    #ifndef NJIT
+    if (GB_jit_archive_handle != NULL || GB_jit_control < GxB_JIT_LOAD)
+    { 
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // open the archive
+    //--------------------------------------------------------------------------
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%s%s%s",
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_JIT_ARCHIVE_NAME, GB_LIB_SUFFIX) ;
+    void *dl_handle = GB_file_dlopen (GB_jit_temp) ;
+    if (dl_handle == NULL)
+    { 
+        // no archive
+        return (GrB_SUCCESS) ;
+    }
+    GB_jit_archive_func dl_archive = (GB_jit_archive_func)
+        GB_file_dlsym (dl_handle, GB_JIT_ARCHIVE_NAME) ;
+    if (dl_archive == NULL)
+    { 
+        // JIT error: the archive is invalid; ignore it
+        GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get its list of kernels and insert them in the hash table
+    //--------------------------------------------------------------------------
+
+    void **Kernels = NULL ;
+    void **Queries = NULL ;
+    char **Names = NULL ;
+    int32_t nkernels = 0 ;
+    dl_archive (&nkernels, &Kernels, &Queries, &Names) ;
+    GB_jit_archive_handle = dl_handle ;
+    GB_jit_archive_nkernels = nkernels ;
+    GB_jit_archive_queries = Queries ;
+    GB_jit_archive_names = Names ;
+    GBURBLE ("(jit: archive of %d kernels) ", nkernels) ;
+
+    void **Prejit_Kernels = NULL ;
+    void **Prejit_Queries = NULL ;
+    char **Prejit_Names = NULL ;
+    int32_t nprejit = 0 ;
+    GB_prejit (&nprejit, &Prejit_Kernels, &Prejit_Queries, &Prejit_Names) ;
+    return (GB_jitifyer_prejit_insert (nkernels, Kernels, Queries, Names,
+        nprejit)) ;
+    #else
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_init: initialize the CPU and CUDA JIT folders, flags, etc
 //------------------------------------------------------------------------------
@@ -301,6 +732,7 @@ GrB_Info GB_jitifyer_init (void)
     //--------------------------------------------------------------------------
 
     GB_COPY_STUFF (GB_jit_error_log,     "") ;
+    GB_COPY_STUFF (GB_jit_record,       "") ;
     GB_COPY_STUFF (GB_jit_C_compiler,   GB_C_COMPILER) ;
     GB_COPY_STUFF (GB_jit_C_flags,      GB_C_FLAGS) ;
     GB_COPY_STUFF (GB_jit_C_link_flags, GB_C_LINK_FLAGS) ;
@@ -350,183 +782,42 @@ GrB_Info GB_jitifyer_init (void)
     char **Names = NULL ;
     int32_t nkernels = 0 ;
     GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
+    OK (GB_jitifyer_prejit_insert (nkernels, Kernels, Queries, Names, 0)) ;
 
-    for (int k = 0 ; k < nkernels ; k++)
-    {
-
-        //----------------------------------------------------------------------
-        // get the name and function pointer of the PreJIT kernel
-        //----------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // hash all kernels in the JIT archive, if it exists
+    //--------------------------------------------------------------------------
 
-        void *dl_function = Kernels [k] ;
-        GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k] ;
-        ASSERT (dl_function != NULL && dl_query != NULL && Names [k] != NULL) ;
-        char kernel_name [GB_KLEN+1] ;
-        strncpy (kernel_name, Names [k], GB_KLEN) ;
-        kernel_name [GB_KLEN] = '\0' ;
+    OK (GB_jitifyer_archive_load ( )) ;
 
-        //----------------------------------------------------------------------
-        // parse the kernel name
-        //----------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // uncompress all the source files into the user source folder
+    //--------------------------------------------------------------------------
 
-        char *name_space = NULL ;
-        char *kname = NULL ;
-        uint64_t scode = 0 ;
-        char *suffix = NULL ;
-        GrB_Info info = GB_demacrofy_name (kernel_name, &name_space, &kname,
-            &scode, &suffix) ;
+    return (GB_jitifyer_extract_JITpackage (GrB_SUCCESS)) ;
+}
 
-        if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit"))
-        {
-            // PreJIT error: kernel_name is invalid; ignore this kernel
-            continue ;
-        }
+//------------------------------------------------------------------------------
+// GB_jitifyer_path_256: establish a folder and its 256 subfolders
+//------------------------------------------------------------------------------
 
-        //----------------------------------------------------------------------
-        // find the kcode of the kname
-        //----------------------------------------------------------------------
+bool GB_jitifyer_path_256 (char *folder)
+{
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s",
+        GB_jit_cache_path, folder) ;
+    bool ok = GB_file_mkdir (GB_jit_temp) ;
+    for (uint32_t bucket = 0 ; bucket <= 0xFF ; bucket++)
+    { 
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x",
+            GB_jit_cache_path, folder, bucket) ;
+        ok = ok && GB_file_mkdir (GB_jit_temp) ;
+    }
+    return (ok) ;
+}
 
-        GB_jit_encoding encoding_struct ;
-        GB_jit_encoding *encoding = &encoding_struct ;
-        memset (encoding, 0, sizeof (GB_jit_encoding)) ;
-
-        #define IS(kernel) GB_STRING_MATCH (kname, kernel)
-
-        GB_jit_kcode c = 0 ;
-        if      (IS ("add"          )) c = GB_JIT_KERNEL_ADD ;
-        else if (IS ("apply_bind1st")) c = GB_JIT_KERNEL_APPLYBIND1 ;
-        else if (IS ("apply_bind2nd")) c = GB_JIT_KERNEL_APPLYBIND2 ;
-        else if (IS ("apply_unop"   )) c = GB_JIT_KERNEL_APPLYUNOP ;
-        else if (IS ("AxB_dot2"     )) c = GB_JIT_KERNEL_AXB_DOT2 ;
-        else if (IS ("AxB_dot2n"    )) c = GB_JIT_KERNEL_AXB_DOT2N ;
-        else if (IS ("AxB_dot3"     )) c = GB_JIT_KERNEL_AXB_DOT3 ;
-        else if (IS ("AxB_dot4"     )) c = GB_JIT_KERNEL_AXB_DOT4 ;
-        else if (IS ("AxB_saxbit"   )) c = GB_JIT_KERNEL_AXB_SAXBIT ;
-        else if (IS ("AxB_saxpy3"   )) c = GB_JIT_KERNEL_AXB_SAXPY3 ;
-        else if (IS ("AxB_saxpy4"   )) c = GB_JIT_KERNEL_AXB_SAXPY4 ;
-        else if (IS ("AxB_saxpy5"   )) c = GB_JIT_KERNEL_AXB_SAXPY5 ;
-        else if (IS ("build"        )) c = GB_JIT_KERNEL_BUILD ;
-        else if (IS ("colscale"     )) c = GB_JIT_KERNEL_COLSCALE ;
-        else if (IS ("concat_bitmap")) c = GB_JIT_KERNEL_CONCAT_BITMAP ;
-        else if (IS ("concat_full"  )) c = GB_JIT_KERNEL_CONCAT_FULL ;
-        else if (IS ("concat_sparse")) c = GB_JIT_KERNEL_CONCAT_SPARSE ;
-        else if (IS ("convert_s2b"  )) c = GB_JIT_KERNEL_CONVERTS2B ;
-        else if (IS ("emult_02"     )) c = GB_JIT_KERNEL_EMULT2 ;
-        else if (IS ("emult_03"     )) c = GB_JIT_KERNEL_EMULT3 ;
-        else if (IS ("emult_04"     )) c = GB_JIT_KERNEL_EMULT4 ;
-        else if (IS ("emult_08"     )) c = GB_JIT_KERNEL_EMULT8 ;
-        else if (IS ("emult_bitmap" )) c = GB_JIT_KERNEL_EMULT_BITMAP ;
-        else if (IS ("ewise_fulla"  )) c = GB_JIT_KERNEL_EWISEFA ;
-        else if (IS ("ewise_fulln"  )) c = GB_JIT_KERNEL_EWISEFN ;
-        else if (IS ("reduce"       )) c = GB_JIT_KERNEL_REDUCE ;
-        else if (IS ("rowscale"     )) c = GB_JIT_KERNEL_ROWSCALE ;
-        else if (IS ("select_bitmap")) c = GB_JIT_KERNEL_SELECT_BITMAP ;
-        else if (IS ("select_phase1")) c = GB_JIT_KERNEL_SELECT1 ;
-        else if (IS ("select_phase2")) c = GB_JIT_KERNEL_SELECT2 ;
-        else if (IS ("split_bitmap" )) c = GB_JIT_KERNEL_SPLIT_BITMAP ;
-        else if (IS ("split_full"   )) c = GB_JIT_KERNEL_SPLIT_FULL ;
-        else if (IS ("split_sparse" )) c = GB_JIT_KERNEL_SPLIT_SPARSE ;
-        else if (IS ("subassign_05d")) c = GB_JIT_KERNEL_SUBASSIGN_05d ;
-        else if (IS ("subassign_06d")) c = GB_JIT_KERNEL_SUBASSIGN_06d ;
-        else if (IS ("subassign_22" )) c = GB_JIT_KERNEL_SUBASSIGN_22 ;
-        else if (IS ("subassign_23" )) c = GB_JIT_KERNEL_SUBASSIGN_23 ;
-        else if (IS ("subassign_25" )) c = GB_JIT_KERNEL_SUBASSIGN_25 ;
-        else if (IS ("trans_bind1st")) c = GB_JIT_KERNEL_TRANSBIND1 ;
-        else if (IS ("trans_bind2nd")) c = GB_JIT_KERNEL_TRANSBIND2 ;
-        else if (IS ("trans_unop"   )) c = GB_JIT_KERNEL_TRANSUNOP ;
-        else if (IS ("union"        )) c = GB_JIT_KERNEL_UNION ;
-        else if (IS ("user_op"      )) c = GB_JIT_KERNEL_USEROP ;
-        else if (IS ("user_type"    )) c = GB_JIT_KERNEL_USERTYPE ;
-        else
-        {
-            // PreJIT error: kernel_name is invalid; ignore this kernel
-            continue ;
-        }
-
-        #undef IS
-        encoding->kcode = c ;
-        encoding->code = scode ;
-        encoding->suffix_len = (suffix == NULL) ? 0 :
-            ((int32_t) strlen (suffix)) ;
-
-        //----------------------------------------------------------------------
-        // get the hash of this PreJIT kernel
-        //----------------------------------------------------------------------
-
-        // Query the kernel for its hash and version number.  The hash is
-        // needed now so the PreJIT kernel can be added to the hash table.
-
-        // The type/op definitions and monoid id/term values for user-defined
-        // types/ops/ monoids are ignored, because the user-defined objects
-        // have not yet been created during this use of GraphBLAS (this method
-        // is called by GrB_init).  These definitions are checked the first
-        // time the kernel is run.
-
-        uint64_t hash = 0 ;
-        char *ignored [5] ;
-        int version [3] ;
-        (void) dl_query (&hash, version, ignored, NULL, NULL, 0, 0) ;
-
-        if (hash == 0 || hash == UINT64_MAX ||
-            (version [0] != GxB_IMPLEMENTATION_MAJOR) ||
-            (version [1] != GxB_IMPLEMENTATION_MINOR) ||
-            (version [2] != GxB_IMPLEMENTATION_SUB))
-        {
-            // PreJIT error: the kernel is stale; ignore it
-            continue ;
-        }
-
-        //----------------------------------------------------------------------
-        // make sure this kernel is not a duplicate
-        //----------------------------------------------------------------------
-
-        int64_t k1 = -1, kk = -1 ;
-        if (GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) != NULL)
-        {
-            // PreJIT error: the kernel is a duplicate; ignore it
-            continue ;
-        }
-
-        //----------------------------------------------------------------------
-        // insert the PreJIT kernel in the hash table
-        //----------------------------------------------------------------------
-
-        if (!GB_jitifyer_insert (hash, encoding, suffix, NULL, dl_function, k))
-        {
-            // PreJIT error: out of memory
-            GB_jit_control = GxB_JIT_PAUSE ;
-            return (GrB_OUT_OF_MEMORY) ;
-        }
-    }
-
-    //--------------------------------------------------------------------------
-    // uncompress all the source files into the user source folder
-    //--------------------------------------------------------------------------
-
-    return (GB_jitifyer_extract_JITpackage (GrB_SUCCESS)) ;
-}
-
-//------------------------------------------------------------------------------
-// GB_jitifyer_path_256: establish a folder and its 256 subfolders
-//------------------------------------------------------------------------------
-
-bool GB_jitifyer_path_256 (char *folder)
-{
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s",
-        GB_jit_cache_path, folder) ;
-    bool ok = GB_file_mkdir (GB_jit_temp) ;
-    for (uint32_t bucket = 0 ; bucket <= 0xFF ; bucket++)
-    { 
-        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/%s/%02x",
-            GB_jit_cache_path, folder, bucket) ;
-        ok = ok && GB_file_mkdir (GB_jit_temp) ;
-    }
-    return (ok) ;
-}
-
-//------------------------------------------------------------------------------
-// GB_jitifyer_establish_paths: make sure cache and its folders exist
-//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// GB_jitifyer_establish_paths: make sure cache and its folders exist
+//------------------------------------------------------------------------------
 
 // Returns GrB_SUCCESS if succesful, or GrB_OUT_OF_MEMORY if out of memory.  If
 // the paths cannot be established, the JIT is disabled, and the
@@ -850,6 +1141,8 @@ GrB_Info GB_jitifyer_set_cache_path (const char *new_cache_path)
 
 GrB_Info GB_jitifyer_set_cache_path_worker (const char *new_cache_path)
 { 
+    // finish any kernels being compiled for the old cache path
+    GB_jitifyer_async_drain ( ) ;
     // free the old the cache path
     GB_FREE_STUFF (GB_jit_cache_path) ;
     // allocate the new GB_jit_cache_path
@@ -859,7 +1152,9 @@ GrB_Info GB_jitifyer_set_cache_path_worker (const char *new_cache_path)
     // set the src path and make sure cache and src paths are accessible
     OK (GB_jitifyer_establish_paths (GrB_INVALID_VALUE)) ;
     // uncompress all the source files into the user source folder
-    return (GB_jitifyer_extract_JITpackage (GrB_INVALID_VALUE)) ;
+    OK (GB_jitifyer_extract_JITpackage (GrB_INVALID_VALUE)) ;
+    // load the JIT archive in the new cache path, if it exists
+    return (GB_jitifyer_archive_load ( )) ;
 }
 
 //------------------------------------------------------------------------------
@@ -912,6 +1207,75 @@ GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log)
     return (GB_jitifyer_alloc_space ( )) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_record: return the current record file
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_get_record (void)
+{ 
+    const char *s ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        s = GB_jit_record ;
+    }
+    return (s) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_record: set a new record file
+//------------------------------------------------------------------------------
+
+// If the new_record is NULL or the empty string, kernels are not recorded.
+
+GrB_Info GB_jitifyer_set_record (const char *new_record)
+{ 
+
+    //--------------------------------------------------------------------------
+    // set the record file in a critical section
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_set_record_worker
+            ((new_record == NULL) ? "" : new_record) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_record_worker: set record file in a critical section
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_set_record_worker (const char *new_record)
+{ 
+    // free the old record file
+    GB_FREE_STUFF (GB_jit_record) ;
+    // allocate the new GB_jit_record
+    GB_COPY_STUFF (GB_jit_record, new_record) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_record: record a kernel in the record file
+//------------------------------------------------------------------------------
+
+// If the record file is set (GxB_JIT_RECORD), each kernel is appended to it
+// when it is first loaded into the hash table, or when a PreJIT kernel is
+// first used, as a single line with the hash of the kernel and its name.
+// The file has the same format as the manifest for GxB_JIT_compile.  No
+// error condition is returned; kernels that cannot be recorded are skipped.
+// This method is called inside the GB_jitifyer_worker critical section.
+
+static void GB_jitifyer_record (const char *kernel_name, uint64_t hash)
+{ 
+    if (GB_jit_record == NULL || GB_jit_record [0] == '\0') return ;
+    FILE *fp = fopen (GB_jit_record, "a") ;
+    if (fp == NULL) return ;
+    fprintf (fp, "%016" PRIx64 " %s\n", hash, kernel_name) ;
+    fclose (fp) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_C_compiler: return the current C compiler
 //------------------------------------------------------------------------------
@@ -1168,6 +1532,45 @@ void GB_jitifyer_set_use_cmake (bool use_cmake)
     }
 }
 
+//------------------------------------------------------------------------------
+// GB_jitifyer_get_async: return true/false if asynchronous compile is in use
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_get_async (void)
+{ 
+    bool async ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        async = GB_jit_async ;
+    }
+    return (async) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_set_async: set controls true/false to compile asynchronously
+//------------------------------------------------------------------------------
+
+// Setting the async control to false waits for all kernels currently being
+// compiled in the background to finish.  This can also be used by the
+// application as a barrier, to ensure all pending kernels have been compiled.
+
+void GB_jitifyer_set_async (bool async)
+{ 
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        #if GB_JIT_ASYNC_SUPPORTED
+        // asynchronous compilation requires POSIX threads
+        GB_jit_async = async ;
+        #else
+        GB_jit_async = false ;
+        #endif
+        if (!GB_jit_async)
+        { 
+            GB_jitifyer_async_drain ( ) ;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_jitifyer_get_C_cmake_libs: return the current cmake libs
 //------------------------------------------------------------------------------
@@ -1438,18 +1841,15 @@ GrB_Info GB_jitifyer_load
     }
 
     //--------------------------------------------------------------------------
-    // handle the GxB_JIT_RUN case: critical section not required
+    // look up the kernel in the hash table: critical section not required
     //--------------------------------------------------------------------------
 
-    if ((GB_jit_control == GxB_JIT_RUN) &&
-        (family != GB_jit_user_op_family) &&
+    // Kernels for user-defined types and operators must be checked inside the
+    // critical section, since their definitions may have changed.
+
+    if ((family != GB_jit_user_op_family) &&
         (family != GB_jit_user_type_family))
     {
-
-        //----------------------------------------------------------------------
-        // look up the kernel in the hash table
-        //----------------------------------------------------------------------
-
         int64_t k1 = -1, kk = -1 ;
         (*dl_function) = GB_jitifyer_lookup (hash, encoding, suffix, &k1, &kk) ;
         if (k1 >= 0)
@@ -1461,7 +1861,7 @@ GrB_Info GB_jitifyer_load
             // found the kernel in the hash table
             return (GrB_SUCCESS) ;
         }
-        else
+        else if (GB_jit_control == GxB_JIT_RUN)
         { 
             // No kernels may be loaded or compiled, but existing kernels
             // already loaded may be run (handled above if dl_function was
@@ -1520,12 +1920,9 @@ GrB_Info GB_jitifyer_worker
         if (k1 >= 0)
         {
             // unchecked PreJIT kernel; check it now
-            void **Kernels = NULL ;
-            void **Queries = NULL ;
-            char **Names = NULL ;
-            int32_t nkernels = 0 ;
-            GB_prejit (&nkernels, &Kernels, &Queries, &Names) ;
-            GB_jit_query_func dl_query = (GB_jit_query_func) Queries [k1] ;
+            GB_jit_query_func dl_query ;
+            char *prejit_name ;
+            GB_jitifyer_prejit_get (&dl_query, &prejit_name, k1) ;
             bool ok = GB_jitifyer_query (dl_query, hash, semiring, monoid, op,
                 type1, type2, type3) ;
             if (ok)
@@ -1533,6 +1930,8 @@ GrB_Info GB_jitifyer_worker
                 // PreJIT kernel is fine; flag it as checked by flipping
                 // its prejit_index.
                 GBURBLE ("(prejit: ok) ") ;
+                GB_jitifyer_record (prejit_name, hash) ;
+                GB_ATOMIC_WRITE
                 e->prejit_index = GB_FLIP (k1) ;
                 return (GrB_SUCCESS) ;
             }
@@ -1603,6 +2002,22 @@ GrB_Info GB_jitifyer_worker
         return (GrB_NO_VALUE) ;
     }
 
+    //--------------------------------------------------------------------------
+    // check if the kernel is being compiled in the background
+    //--------------------------------------------------------------------------
+
+    bool compiled = false ;
+    #if GB_JIT_ASYNC_SUPPORTED
+    int async_status = GB_jitifyer_async_status (hash, encoding, suffix) ;
+    if (async_status == GB_JIT_ASYNC_PENDING)
+    { 
+        // the kernel is not yet compiled, so punt to generic
+        GBURBLE ("(jit: compiling in background) ") ;
+        return (GrB_NO_VALUE) ;
+    }
+    compiled = (async_status == GB_JIT_ASYNC_DONE) ;
+    #endif
+
     //--------------------------------------------------------------------------
     // construct the kernel name
     //--------------------------------------------------------------------------
@@ -1648,6 +2063,7 @@ GrB_Info GB_jitifyer_worker
 
         case GB_jit_select_family : 
             op1 = op ;
+            // the masked selector has 11 digits; all others have 10
             scode_digits = 10 ;
             break ;
 
@@ -1690,7 +2106,11 @@ GrB_Info GB_jitifyer_worker
 
     GrB_Info info = GB_jitifyer_load_worker (dl_function, kernel_name, family,
         kname, hash, encoding, suffix, semiring, monoid, op, op1, op2,
-        type1, type2, type3) ;
+        type1, type2, type3, compiled) ;
+    if (info == GrB_SUCCESS)
+    { 
+        GB_jitifyer_record (kernel_name, hash) ;
+    }
 
     //--------------------------------------------------------------------------
     // unlock the kernel
@@ -1728,7 +2148,8 @@ GrB_Info GB_jitifyer_load_worker
     GB_Operator op2,
     GrB_Type type1,
     GrB_Type type2,
-    GrB_Type type3
+    GrB_Type type3,
+    bool compiled               // true if just compiled in the background
 )
 {
 
@@ -1820,6 +2241,26 @@ GrB_Info GB_jitifyer_load_worker
         // if the source file was not created above, the compilation will
         // gracefully fail.
 
+        #if GB_JIT_ASYNC_SUPPORTED
+        if (GB_jit_async && !GB_jit_use_cmake && !compiled &&
+            family != GB_jit_user_op_family &&
+            family != GB_jit_user_type_family)
+        {
+            // Queue the kernel for the background thread to compile, and
+            // punt to generic for now.  If the request cannot be queued, the
+            // kernel is compiled below, synchronously.  If the kernel was
+            // just compiled in the background but could not be loaded, it is
+            // not queued again.  Instead, it is compiled synchronously, and
+            // a second failure disables the compiler, as usual.
+            if (GB_jitifyer_async_enqueue (kernel_name, bucket, hash,
+                encoding, suffix))
+            { 
+                GBURBLE ("(jit: queued for background compile) ") ;
+                return (GrB_NO_VALUE) ;
+            }
+        }
+        #endif
+
         // compile the kernel to get the lib*.so file
         if (GB_jit_use_cmake)
         { 
@@ -1913,7 +2354,24 @@ void *GB_jitifyer_lookup    // return dl_function pointer, or NULL if not found
 
     (*k1) = -1 ;
 
-    if (GB_jit_table == NULL)
+    //--------------------------------------------------------------------------
+    // get the hash table
+    //--------------------------------------------------------------------------
+
+    // This method may be called outside of any critical section, while another
+    // thread is inserting an entry or expanding the table.  The mask is read
+    // before the table, which is the opposite order in which they are written
+    // by GB_jitifyer_insert.  The table is thus at least as large as the mask.
+
+    uint64_t table_bits ;
+    GB_ATOMIC_READ
+    table_bits = GB_jit_table_bits ;
+    GB_OMP_FLUSH
+    GB_jit_entry *table ;
+    GB_ATOMIC_READ
+    table = GB_jit_table ;
+
+    if (table == NULL || table_bits == 0)
     { 
         // no table yet so it isn't present
         return (NULL) ;
@@ -1922,29 +2380,54 @@ void *GB_jitifyer_lookup    // return dl_function pointer, or NULL if not found
     uint32_t suffix_len = encoding->suffix_len ;
     bool builtin = (bool) (suffix_len == 0) ;
 
+    //--------------------------------------------------------------------------
     // look up the entry in the hash table
+    //--------------------------------------------------------------------------
+
     for (uint64_t k = hash ; ; k++)
     {
-        k = k & GB_jit_table_bits ;
-        GB_jit_entry *e = &(GB_jit_table [k]) ;
-        if (e->dl_function == NULL)
+        k = k & table_bits ;
+        GB_jit_entry *e = &(table [k]) ;
+        void *dl_function ;
+        GB_ATOMIC_READ
+        dl_function = e->dl_function ;
+        if (dl_function == NULL)
         { 
             // found an empty entry, so the entry is not in the table
             return (NULL) ;
         }
-        else if (e->hash == hash &&
+        if (dl_function == GB_JIT_DEAD)
+        { 
+            // skip a dead entry
+            continue ;
+        }
+        GB_OMP_FLUSH
+        const char *e_suffix = e->suffix ;
+        if (e->hash == hash &&
             e->encoding.code == encoding->code &&
             e->encoding.kcode == encoding->kcode &&
             e->encoding.suffix_len == suffix_len &&
-            (builtin || (memcmp (e->suffix, suffix, suffix_len) == 0)))
+            (builtin || (e_suffix != NULL &&
+                memcmp (e_suffix, suffix, suffix_len) == 0)))
         { 
-            // found the right entry: return the corresponding dl_function
+            // found the right entry, unless it was removed from the table
+            // during the comparison
+            void *dl_function_now ;
+            GB_OMP_FLUSH
+            GB_ATOMIC_READ
+            dl_function_now = e->dl_function ;
+            if (dl_function_now != dl_function || e->hash != hash)
+            { 
+                // the entry is dead; keep looking past it
+                continue ;
+            }
+            // return the corresponding dl_function
             int64_t my_k1 ;
             GB_ATOMIC_READ
             my_k1 = e->prejit_index ;   // >= 0: unchecked JIT kernel
             (*k1) = my_k1 ;
             (*kk) = k ;
-            return (e->dl_function) ;
+            return (dl_function) ;
         }
         // otherwise, keep looking
     }
@@ -1990,11 +2473,16 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
         }
         memset (GB_jit_table, 0, siz) ;
         GB_jit_table_size = GB_JITIFIER_INITIAL_SIZE ;
-        GB_jit_table_bits = GB_JITIFIER_INITIAL_SIZE - 1 ; 
         GB_jit_table_allocated = siz ;
+        // publish the mask after the table
+        GB_OMP_FLUSH
+        GB_ATOMIC_WRITE
+        GB_jit_table_bits = GB_JITIFIER_INITIAL_SIZE - 1 ; 
 
     }
-    else if (4 * GB_jit_table_populated >= GB_jit_table_size)
+    else if (4 * (GB_jit_table_populated + GB_jit_table_dead) >=
+             GB_jit_table_size &&
+             GB_jit_table_nretired < GB_JITIFIER_MAX_RETIRED)
     {
 
         //----------------------------------------------------------------------
@@ -2014,11 +2502,12 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
             return (false) ;
         }
 
-        // rehash into the new table
+        // rehash the live entries into the new table; dead entries are
+        // dropped
         memset (new_table, 0, siz) ;
         for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
         {
-            if (GB_jit_table [k].dl_function != NULL)
+            if (GB_JIT_LIVE (GB_jit_table [k].dl_function))
             { 
                 // rehash the entry to the larger hash table
                 uint64_t hash = GB_jit_table [k].hash ;
@@ -2036,14 +2525,19 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
             }
         }
 
-        // free the old table
-        GB_FREE_STUFF (GB_jit_table) ;
+        // retire the old table; it may still be in use by GB_jitifyer_lookup
+        GB_jit_table_retired [GB_jit_table_nretired++] = GB_jit_table ;
 
-        // use the new table
+        // publish the new table, and then its mask
+        GB_OMP_FLUSH
+        GB_ATOMIC_WRITE
         GB_jit_table = new_table ;
-        GB_jit_table_size = new_size ;
+        GB_OMP_FLUSH
+        GB_ATOMIC_WRITE
         GB_jit_table_bits = new_bits ;
+        GB_jit_table_size = new_size ;
         GB_jit_table_allocated = siz ;
+        GB_jit_table_dead = 0 ;
         ASSERT_TABLE_OK ;
     }
 
@@ -2061,7 +2555,8 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
         GB_jit_entry *e = &(GB_jit_table [k]) ;
         if (e->dl_function == NULL)
         { 
-            // found an empty slot
+            // found an empty slot; dead entries are never reused, since a
+            // reader may still be comparing them with its own problem
             e->suffix = NULL ;
             if (!builtin)
             { 
@@ -2077,9 +2572,12 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
             e->hash = hash ;
             memcpy (&(e->encoding), encoding, sizeof (GB_jit_encoding)) ;
             e->dl_handle = dl_handle ;              // NULL for PreJIT
+            e->prejit_index = prejit_index ;        // -1 for JIT kernels
+            // publish the entry by writing its dl_function last
+            GB_OMP_FLUSH
+            GB_ATOMIC_WRITE
             e->dl_function = dl_function ;
             GB_jit_table_populated++ ;
-            e->prejit_index = prejit_index ;        // -1 for JIT kernels
             ASSERT_TABLE_OK ;
             return (true) ;
         }
@@ -2091,11 +2589,47 @@ bool GB_jitifyer_insert         // return true if successful, false if failure
 // GB_jitifyer_entry_free: free a single JIT hash table entry
 //------------------------------------------------------------------------------
 
+// The entry is left in the table as a dead entry, since a reader in
+// GB_jitifyer_lookup may still be comparing it with its own problem, outside
+// of any critical section.  Its hash, encoding, and suffix are not modified.
+// The suffix is retired, and freed by GB_jitifyer_table_free along with the
+// retired hash tables.  If the list of retired suffixes cannot grow, the
+// suffix is leaked, which is safer than freeing it.
+
 void GB_jitifyer_entry_free (GB_jit_entry *e)
 {
-    e->dl_function = NULL ;
+    ASSERT (GB_JIT_LIVE (e->dl_function)) ;
+    GB_ATOMIC_WRITE
+    e->dl_function = GB_JIT_DEAD ;
+    GB_OMP_FLUSH
     GB_jit_table_populated-- ;
-    GB_FREE_PERSISTENT (e->suffix) ;
+    GB_jit_table_dead++ ;
+    if (e->suffix != NULL)
+    {
+        if (GB_jit_suffix_nretired == GB_jit_suffix_maxretired)
+        { 
+            // double the size of the list of retired suffixes
+            int64_t newmax = GB_IMAX (2 * GB_jit_suffix_maxretired, 64) ;
+            char **newlist ;
+            GB_MALLOC_PERSISTENT (newlist, newmax * sizeof (char *)) ;
+            if (newlist != NULL)
+            { 
+                if (GB_jit_suffix_nretired > 0)
+                { 
+                    memcpy (newlist, GB_jit_suffix_retired,
+                        GB_jit_suffix_nretired * sizeof (char *)) ;
+                }
+                GB_FREE_PERSISTENT (GB_jit_suffix_retired) ;
+                GB_jit_suffix_retired = newlist ;
+                GB_jit_suffix_maxretired = newmax ;
+            }
+        }
+        if (GB_jit_suffix_nretired < GB_jit_suffix_maxretired)
+        { 
+            // retire the suffix
+            GB_jit_suffix_retired [GB_jit_suffix_nretired++] = e->suffix ;
+        }
+    }
     // unload the dl library
     if (e->dl_handle != NULL)
     { 
@@ -2126,7 +2660,7 @@ void GB_jitifyer_table_free (bool freeall)
         for (uint64_t k = 0 ; k < GB_jit_table_size ; k++)
         {
             GB_jit_entry *e = &(GB_jit_table [k]) ;
-            if (e->dl_function != NULL)
+            if (GB_JIT_LIVE (e->dl_function))
             {
                 // found an entry
                 if (e->dl_handle == NULL)
@@ -2148,10 +2682,26 @@ void GB_jitifyer_table_free (bool freeall)
     ASSERT (GB_IMPLIES (freeall, GB_jit_table_populated == 0)) ;
     if (GB_jit_table_populated == 0)
     { 
-        // the JIT table is now empty, so free it
+        // the JIT table is now empty, so free it, and all retired tables
+        // and suffixes
+        GB_ATOMIC_WRITE
+        GB_jit_table_bits = 0 ;
+        GB_OMP_FLUSH
         GB_FREE_STUFF (GB_jit_table) ;
         GB_jit_table_size = 0 ;
-        GB_jit_table_bits = 0 ;
+        GB_jit_table_dead = 0 ;
+        for (int k = 0 ; k < GB_jit_table_nretired ; k++)
+        { 
+            GB_FREE_PERSISTENT (GB_jit_table_retired [k]) ;
+        }
+        GB_jit_table_nretired = 0 ;
+        for (int64_t k = 0 ; k < GB_jit_suffix_nretired ; k++)
+        { 
+            GB_FREE_PERSISTENT (GB_jit_suffix_retired [k]) ;
+        }
+        GB_FREE_PERSISTENT (GB_jit_suffix_retired) ;
+        GB_jit_suffix_nretired = 0 ;
+        GB_jit_suffix_maxretired = 0 ;
     }
 }
 
@@ -2298,6 +2848,32 @@ void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash)
 void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket)
 { 
 
+#ifndef NJIT
+
+    // construct the command to compile and link the kernel
+    GB_jitifyer_direct_command (kernel_name, bucket) ;
+
+    // compile the library and return result
+    GBURBLE ("(jit: %s) ", GB_jit_temp) ;
+    GB_jitifyer_command (GB_jit_temp) ;
+
+    // remove the *.o file
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
+        GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+    remove (GB_jit_temp) ;
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_direct_command: construct the command for a direct compile
+//------------------------------------------------------------------------------
+
+// The command to compile and link the kernel is placed in GB_jit_temp.
+
+void GB_jitifyer_direct_command (char *kernel_name, uint32_t bucket)
+{ 
+
 #ifndef NJIT
 
     char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
@@ -2346,16 +2922,1168 @@ void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket)
     burble_stdout,                      // burble stdout
     err_redirect, GB_jit_error_log) ;   // error log file
 
-    // compile the library and return result
-    GBURBLE ("(jit: %s) ", GB_jit_temp) ;
-    GB_jitifyer_command (GB_jit_temp) ;
+#endif
+}
 
-    // remove the *.o file
-    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
-        GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
-    remove (GB_jit_temp) ;
+#ifndef NJIT
 
-#endif
+//------------------------------------------------------------------------------
+// GB_jitifyer_strdup: copy a string into persistent memory
+//------------------------------------------------------------------------------
+
+static char *GB_jitifyer_strdup (const char *src)
+{ 
+    size_t len = strlen (src) ;
+    char *dst ;
+    GB_MALLOC_PERSISTENT (dst, len+2) ;
+    if (dst != NULL)
+    { 
+        strncpy (dst, src, len+1) ;
+    }
+    return (dst) ;
+}
+
+#endif
+
+#if GB_JIT_ASYNC_SUPPORTED
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_async_request_free: free a single request
+//------------------------------------------------------------------------------
+
+static void GB_jitifyer_async_request_free (GB_jit_async_request **r_handle)
+{
+    GB_jit_async_request *r = (*r_handle) ;
+    if (r != NULL)
+    { 
+        GB_FREE_PERSISTENT (r->suffix) ;
+        GB_FREE_PERSISTENT (r->command) ;
+        GB_FREE_PERSISTENT (r->obj_file) ;
+        GB_FREE_PERSISTENT (r->lock_file) ;
+        GB_FREE_PERSISTENT (r) ;
+    }
+    (*r_handle) = NULL ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_async_worker: the background thread that compiles kernels
+//------------------------------------------------------------------------------
+
+// The background thread compiles each queued kernel in turn, in the order they
+// were queued.  The commands and filenames are constructed when the request is
+// queued, so this thread does not access GB_jit_temp or any other JIT string,
+// and it never enters the GB_jitifyer_worker critical section.  A request is
+// never freed while it is being compiled; it is freed only by the user thread
+// that finds it done (GB_jitifyer_async_status), or by
+// GB_jitifyer_async_drain and GB_jitifyer_async_stop, which wait for the
+// compilation to finish.
+
+static void *GB_jitifyer_async_worker (void *arg)
+{
+    pthread_mutex_lock (&GB_jit_async_mutex) ;
+    while (!GB_jit_async_shutdown)
+    {
+
+        //----------------------------------------------------------------------
+        // find the next request that has not been started
+        //----------------------------------------------------------------------
+
+        GB_jit_async_request *r = GB_jit_async_queue ;
+        while (r != NULL && r->started)
+        { 
+            r = r->next ;
+        }
+        if (r == NULL)
+        { 
+            // nothing to do; wait for a new request or for shutdown
+            pthread_cond_wait (&GB_jit_async_cond, &GB_jit_async_mutex) ;
+            continue ;
+        }
+        r->started = true ;
+        pthread_mutex_unlock (&GB_jit_async_mutex) ;
+
+        //----------------------------------------------------------------------
+        // compile the kernel, outside of the mutex
+        //----------------------------------------------------------------------
+
+        // The kernel lock guards against other processes compiling the same
+        // kernel at the same time.
+        FILE *fp_klock = NULL ;
+        int fd_klock = -1 ;
+        bool locked = GB_file_open_and_lock (r->lock_file, &fp_klock,
+            &fd_klock) ;
+        GB_jitifyer_command (r->command) ;
+        remove (r->obj_file) ;
+        if (locked)
+        { 
+            GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+        }
+
+        //----------------------------------------------------------------------
+        // flag the request as done
+        //----------------------------------------------------------------------
+
+        pthread_mutex_lock (&GB_jit_async_mutex) ;
+        r->status = GB_JIT_ASYNC_DONE ;
+        pthread_cond_broadcast (&GB_jit_async_cond) ;
+    }
+    pthread_mutex_unlock (&GB_jit_async_mutex) ;
+    return (NULL) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_async_enqueue: queue a kernel for compilation in the background
+//------------------------------------------------------------------------------
+
+// The kernel source file must already exist.  Returns true if the request has
+// been queued, or false if out of memory or if the background thread cannot be
+// started.  In that case, the caller compiles the kernel itself.  This method
+// is called inside the GB_jitifyer_worker critical section.
+
+static bool GB_jitifyer_async_enqueue
+(
+    char *kernel_name,          // kernel file name (excluding the path)
+    uint32_t bucket,            // hash & 0xFF
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix          // suffix for the kernel_name (NULL if none)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // start the background thread, if not already running
+    //--------------------------------------------------------------------------
+
+    if (!GB_jit_async_running)
+    {
+        GB_jit_async_shutdown = false ;
+        if (pthread_create (&GB_jit_async_thread, NULL,
+            GB_jitifyer_async_worker, NULL) != 0)
+        { 
+            // JIT error: unable to start the thread
+            return (false) ;
+        }
+        GB_jit_async_running = true ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the request
+    //--------------------------------------------------------------------------
+
+    GB_jit_async_request *r ;
+    GB_MALLOC_PERSISTENT (r, sizeof (GB_jit_async_request)) ;
+    if (r == NULL)
+    { 
+        // JIT error: out of memory
+        return (false) ;
+    }
+    memset (r, 0, sizeof (GB_jit_async_request)) ;
+    r->hash = hash ;
+    memcpy (&(r->encoding), encoding, sizeof (GB_jit_encoding)) ;
+    r->status = GB_JIT_ASYNC_PENDING ;
+    bool ok = true ;
+    if (encoding->suffix_len > 0)
+    { 
+        r->suffix = GB_jitifyer_strdup (suffix) ;
+        ok = (r->suffix != NULL) ;
+    }
+
+    // the command to compile and link the kernel
+    GB_jitifyer_direct_command (kernel_name, bucket) ;
+    r->command = GB_jitifyer_strdup (GB_jit_temp) ;
+
+    // the *.o file, to be removed when the compilation is done
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
+        GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+    r->obj_file = GB_jitifyer_strdup (GB_jit_temp) ;
+
+    // the kernel lock file
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket, hash) ;
+    r->lock_file = GB_jitifyer_strdup (GB_jit_temp) ;
+
+    ok = ok && (r->command != NULL) && (r->obj_file != NULL) &&
+        (r->lock_file != NULL) ;
+    if (!ok)
+    { 
+        // JIT error: out of memory
+        GB_jitifyer_async_request_free (&r) ;
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // append the request to the queue and wake up the background thread
+    //--------------------------------------------------------------------------
+
+    pthread_mutex_lock (&GB_jit_async_mutex) ;
+    GB_jit_async_request **tail = &GB_jit_async_queue ;
+    while ((*tail) != NULL)
+    { 
+        tail = &((*tail)->next) ;
+    }
+    (*tail) = r ;
+    pthread_cond_broadcast (&GB_jit_async_cond) ;
+    pthread_mutex_unlock (&GB_jit_async_mutex) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_async_status: check if a kernel is being compiled
+//------------------------------------------------------------------------------
+
+// Returns GB_JIT_ASYNC_NONE if the kernel is not in the queue,
+// GB_JIT_ASYNC_PENDING if it is queued or being compiled, or
+// GB_JIT_ASYNC_DONE if its compilation has finished.  In the latter case, the
+// request is removed from the queue, and the caller must load the kernel.
+// This method is called inside the GB_jitifyer_worker critical section.
+
+static int GB_jitifyer_async_status
+(
+    uint64_t hash,              // hash code for the kernel
+    GB_jit_encoding *encoding,  // encoding of the problem
+    const char *suffix          // suffix for the kernel_name (NULL if none)
+)
+{
+
+    if (!GB_jit_async_running)
+    { 
+        // nothing has been queued
+        return (GB_JIT_ASYNC_NONE) ;
+    }
+
+    uint32_t suffix_len = encoding->suffix_len ;
+    bool builtin = (bool) (suffix_len == 0) ;
+    int status = GB_JIT_ASYNC_NONE ;
+    GB_jit_async_request *done = NULL ;
+
+    pthread_mutex_lock (&GB_jit_async_mutex) ;
+    for (GB_jit_async_request **p = &GB_jit_async_queue ; (*p) != NULL ;
+        p = &((*p)->next))
+    {
+        GB_jit_async_request *r = (*p) ;
+        if (r->hash == hash &&
+            r->encoding.code == encoding->code &&
+            r->encoding.kcode == encoding->kcode &&
+            r->encoding.suffix_len == suffix_len &&
+            (builtin || (memcmp (r->suffix, suffix, suffix_len) == 0)))
+        {
+            // found the request
+            status = r->status ;
+            if (status == GB_JIT_ASYNC_DONE)
+            { 
+                // remove it from the queue
+                (*p) = r->next ;
+                done = r ;
+            }
+            break ;
+        }
+    }
+    pthread_mutex_unlock (&GB_jit_async_mutex) ;
+
+    GB_jitifyer_async_request_free (&done) ;
+    return (status) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_async_stop: terminate the background thread
+//------------------------------------------------------------------------------
+
+// The kernel being compiled (if any) is finished, but any other kernels in the
+// queue are not compiled.  Their source files have already been created, and
+// they are compiled the next time they are needed.
+
+static void GB_jitifyer_async_stop (void)
+{
+
+    if (GB_jit_async_running)
+    { 
+        pthread_mutex_lock (&GB_jit_async_mutex) ;
+        GB_jit_async_shutdown = true ;
+        pthread_cond_broadcast (&GB_jit_async_cond) ;
+        pthread_mutex_unlock (&GB_jit_async_mutex) ;
+        pthread_join (GB_jit_async_thread, NULL) ;
+        GB_jit_async_running = false ;
+        GB_jit_async_shutdown = false ;
+    }
+
+    // free all requests
+    while (GB_jit_async_queue != NULL)
+    { 
+        GB_jit_async_request *r = GB_jit_async_queue ;
+        GB_jit_async_queue = r->next ;
+        GB_jitifyer_async_request_free (&r) ;
+    }
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_async_drain: wait for all queued kernels to be compiled
+//------------------------------------------------------------------------------
+
+// All requests are removed from the queue.  Kernels that have been compiled
+// are not loaded here; they are loaded the next time they are needed.  This
+// method is called inside the GB_jitifyer_worker critical section.
+
+void GB_jitifyer_async_drain (void)
+{
+    #if GB_JIT_ASYNC_SUPPORTED
+    if (GB_jit_async_running)
+    {
+        pthread_mutex_lock (&GB_jit_async_mutex) ;
+        while (true)
+        {
+            bool pending = false ;
+            for (GB_jit_async_request *r = GB_jit_async_queue ; r != NULL ;
+                r = r->next)
+            { 
+                pending = pending || (r->status == GB_JIT_ASYNC_PENDING) ;
+            }
+            if (!pending) break ;
+            pthread_cond_wait (&GB_jit_async_cond, &GB_jit_async_mutex) ;
+        }
+        GB_jit_async_request *queue = GB_jit_async_queue ;
+        GB_jit_async_queue = NULL ;
+        pthread_mutex_unlock (&GB_jit_async_mutex) ;
+        while (queue != NULL)
+        { 
+            GB_jit_async_request *r = queue ;
+            queue = r->next ;
+            GB_jitifyer_async_request_free (&r) ;
+        }
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_compile: compile and load the kernels listed in a manifest
+//------------------------------------------------------------------------------
+
+// The manifest is a text file with one kernel per line: the hash of the
+// kernel, as 16 hexadecimal digits, followed by the kernel name.  Blank lines,
+// and lines that start with '#', are ignored.  Each kernel whose lib*.so file
+// is not in the cache is compiled, with up to ncompilers compilations running
+// at the same time.  The source of each of these kernels must already be in
+// the cache, from a prior run of GraphBLAS that created it.
+
+// Built-in kernels are then loaded into the hash table, so they are ready for
+// their first use.  User-defined kernels are compiled but not loaded, since
+// their user-defined types and operators must be checked first.  They are
+// loaded when first needed.
+
+#ifndef NJIT
+
+typedef struct
+{
+    uint64_t hash ;                 // hash code for the kernel
+    char *command ;                 // command to compile and link the kernel
+    char *obj_file ;                // *.o file to remove when done
+    char *lock_file ;               // kernel lock file
+    char kernel_name [GB_KLEN+1] ;  // kernel name
+}
+GB_jit_batch_item ;
+
+#define GB_FREE_BATCH                                       \
+{                                                           \
+    for (int64_t k = 0 ; k < nitems ; k++)                  \
+    {                                                       \
+        GB_FREE_PERSISTENT (Items [k].command) ;            \
+        GB_FREE_PERSISTENT (Items [k].obj_file) ;           \
+        GB_FREE_PERSISTENT (Items [k].lock_file) ;          \
+    }                                                       \
+    GB_FREE_PERSISTENT (Items) ;                            \
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_manifest_read: read a manifest of kernels
+//------------------------------------------------------------------------------
+
+// Duplicate kernels in the manifest are skipped.  The kernel name is used to
+// construct the commands that compile the kernel, so it may only contain
+// letters, digits, and underscores.
+
+static GrB_Info GB_jitifyer_manifest_read
+(
+    // output:
+    GB_jit_batch_item **Items_handle,   // list of kernels in the manifest
+    int64_t *nitems_handle,             // # of kernels in the manifest
+    // input:
+    const char *manifest                // filename of the manifest
+)
+{
+
+    //--------------------------------------------------------------------------
+    // count the lines in the manifest
+    //--------------------------------------------------------------------------
+
+    FILE *fp = fopen (manifest, "r") ;
+    if (fp == NULL)
+    { 
+        // manifest not found
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    char line [GB_KLEN+64] ;
+    int64_t nlines = 0 ;
+    while (fgets (line, GB_KLEN+64, fp) != NULL)
+    { 
+        nlines++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the manifest
+    //--------------------------------------------------------------------------
+
+    GB_jit_batch_item *Items = NULL ;
+    int64_t nitems = 0 ;
+    GB_MALLOC_PERSISTENT (Items, (nlines+1) * sizeof (GB_jit_batch_item)) ;
+    if (Items == NULL)
+    { 
+        // out of memory
+        fclose (fp) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    rewind (fp) ;
+    bool ok = true ;
+    while (nitems < nlines && fgets (line, GB_KLEN+64, fp) != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // skip comments and blank lines
+        //----------------------------------------------------------------------
+
+        char *p = line ;
+        while (isspace (*p)) p++ ;
+        if (*p == '#' || *p == '\0')
+        { 
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // parse the hash and the kernel name
+        //----------------------------------------------------------------------
+
+        // The kernel name is used to construct the command that compiles the
+        // kernel, so it may only contain letters, digits, and underscores.
+
+        char *q ;
+        uint64_t hash = (uint64_t) strtoull (p, &q, 16) ;
+        if (q == p || !isspace (*q) || hash == 0 || hash == UINT64_MAX)
+        { 
+            ok = false ;
+            break ;
+        }
+        while (isspace (*q)) q++ ;
+        size_t len = 0 ;
+        while (isalnum (q [len]) || q [len] == '_')
+        { 
+            len++ ;
+        }
+        if (len == 0 || len > GB_KLEN || !(q [len] == '\0' || isspace (q [len]))
+            || strncmp (q, "GB_jit__", 8) != 0)
+        { 
+            ok = false ;
+            break ;
+        }
+
+        GB_jit_batch_item *item = &(Items [nitems]) ;
+        memset (item, 0, sizeof (GB_jit_batch_item)) ;
+        item->hash = hash ;
+        memcpy (item->kernel_name, q, len) ;
+        item->kernel_name [len] = '\0' ;
+
+        //----------------------------------------------------------------------
+        // skip duplicates
+        //----------------------------------------------------------------------
+
+        bool duplicate = false ;
+        for (int64_t k = 0 ; k < nitems && !duplicate ; k++)
+        { 
+            duplicate = (Items [k].hash == hash) &&
+                (strcmp (Items [k].kernel_name, item->kernel_name) == 0) ;
+        }
+        if (!duplicate)
+        { 
+            nitems++ ;
+        }
+    }
+    fclose (fp) ;
+
+    if (!ok)
+    { 
+        // invalid manifest
+        GB_FREE_BATCH ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    (*Items_handle) = Items ;
+    (*nitems_handle) = nitems ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_batch_compile: run the compile commands of a batch in parallel
+//------------------------------------------------------------------------------
+
+// Each thread runs one compiler at a time, in its own child process.  The
+// threads do not access any JIT state, other than their own Items.  Items
+// with no command are skipped.
+
+static void GB_jitifyer_batch_compile
+(
+    GB_jit_batch_item *Items,   // list of kernels
+    int64_t nitems,             // # of kernels in the list
+    int nthreads,               // # of compilers to run at the same time
+    bool remove_obj             // if true, remove each *.o file when done
+)
+{
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (k = 0 ; k < nitems ; k++)
+    {
+        GB_jit_batch_item *item = &(Items [k]) ;
+        if (item->command == NULL) continue ;
+        FILE *fp_klock = NULL ;
+        int fd_klock = -1 ;
+        bool locked = (item->lock_file != NULL) &&
+            GB_file_open_and_lock (item->lock_file, &fp_klock, &fd_klock) ;
+        GB_jitifyer_command (item->command) ;
+        if (remove_obj)
+        { 
+            remove (item->obj_file) ;
+        }
+        if (locked)
+        { 
+            GB_file_unlock_and_close (&fp_klock, &fd_klock) ;
+        }
+    }
+}
+
+static GrB_Info GB_jitifyer_compile_worker
+(
+    const char *manifest,       // filename of the manifest
+    int32_t ncompilers          // # of compilers to run at the same time
+)
+{
+
+    //--------------------------------------------------------------------------
+    // read the manifest
+    //--------------------------------------------------------------------------
+
+    GB_jit_batch_item *Items = NULL ;
+    int64_t nitems = 0 ;
+    GrB_Info info = GB_jitifyer_manifest_read (&Items, &nitems, manifest) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // manifest not found, not valid, or out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // quick return if the JIT may not load any kernels
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_control < GxB_JIT_LOAD)
+    { 
+        GB_FREE_BATCH ;
+        return (GrB_SUCCESS) ;
+    }
+
+    // finish any kernels being compiled in the background
+    GB_jitifyer_async_drain ( ) ;
+
+    //--------------------------------------------------------------------------
+    // find the kernels to compile
+    //--------------------------------------------------------------------------
+
+    int64_t ncompile = 0 ;
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        GB_jit_batch_item *item = &(Items [k]) ;
+        char *kernel_name = item->kernel_name ;
+        uint32_t bucket = item->hash & 0xFF ;
+
+        // check if the lib*.so file already exists
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+            GB_jit_cache_path, bucket, GB_LIB_PREFIX, kernel_name,
+            GB_LIB_SUFFIX) ;
+        FILE *fp = fopen (GB_jit_temp, "r") ;
+        if (fp != NULL)
+        { 
+            fclose (fp) ;
+            continue ;
+        }
+
+        // the kernel must be compiled, if the JIT is permitted to do so
+        if (GB_jit_control < GxB_JIT_ON)
+        { 
+            continue ;
+        }
+
+        // check if the source file exists
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+            GB_jit_cache_path, bucket, kernel_name) ;
+        fp = fopen (GB_jit_temp, "r") ;
+        if (fp == NULL)
+        { 
+            GBURBLE ("(jit: %s source not found) ", kernel_name) ;
+            continue ;
+        }
+        fclose (fp) ;
+
+        if (GB_jit_use_cmake)
+        { 
+            // cmake uses GB_jit_temp, so these kernels are compiled one at a
+            // time, here
+            GB_jitifyer_cmake_compile (kernel_name, item->hash) ;
+            continue ;
+        }
+
+        // the command to compile and link the kernel
+        GB_jitifyer_direct_command (kernel_name, bucket) ;
+        item->command = GB_jitifyer_strdup (GB_jit_temp) ;
+
+        // the *.o file, to be removed when the compilation is done
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s%s",
+            GB_jit_cache_path, bucket, kernel_name, GB_OBJ_SUFFIX) ;
+        item->obj_file = GB_jitifyer_strdup (GB_jit_temp) ;
+
+        // the kernel lock file
+        snprintf (GB_jit_temp, GB_jit_temp_allocated,
+            "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket,
+            item->hash) ;
+        item->lock_file = GB_jitifyer_strdup (GB_jit_temp) ;
+
+        if (item->command == NULL || item->obj_file == NULL ||
+            item->lock_file == NULL)
+        { 
+            // out of memory
+            GB_FREE_BATCH ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        ncompile++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compile the kernels in parallel
+    //--------------------------------------------------------------------------
+
+    if (ncompile > 0)
+    { 
+        int nthreads = (int) GB_IMIN (ncompile, GB_IMAX (ncompilers, 1)) ;
+        GBURBLE ("(jit: compiling %" PRId64 " kernels with %d compilers) ",
+            ncompile, nthreads) ;
+        GB_jitifyer_batch_compile (Items, nitems, nthreads, true) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load the built-in kernels into the hash table
+    //--------------------------------------------------------------------------
+
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // parse the kernel name
+        //----------------------------------------------------------------------
+
+        GB_jit_batch_item *item = &(Items [k]) ;
+        uint64_t hash = item->hash ;
+        uint32_t bucket = hash & 0xFF ;
+        char name [GB_KLEN+1] ;
+        strncpy (name, item->kernel_name, GB_KLEN) ;
+        name [GB_KLEN] = '\0' ;
+
+        char *name_space = NULL ;
+        char *kname = NULL ;
+        uint64_t scode = 0 ;
+        char *suffix = NULL ;
+        info = GB_demacrofy_name (name, &name_space, &kname, &scode,
+            &suffix) ;
+        if (info != GrB_SUCCESS || !GB_STRING_MATCH (name_space, "GB_jit")
+            || suffix != NULL)
+        { 
+            // user-defined kernels are loaded when first needed
+            continue ;
+        }
+
+        GB_jit_encoding encoding_struct ;
+        GB_jit_encoding *encoding = &encoding_struct ;
+        memset (encoding, 0, sizeof (GB_jit_encoding)) ;
+        encoding->kcode = GB_jitifyer_kcode (kname) ;
+        encoding->code = scode ;
+        if (encoding->kcode == GB_JIT_KERNEL_NONE ||
+            encoding->kcode == GB_JIT_KERNEL_USEROP ||
+            encoding->kcode == GB_JIT_KERNEL_USERTYPE ||
+            GB_jitifyer_hash_encoding (encoding) != hash)
+        { 
+            // not a valid built-in kernel
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // skip the kernel if it is already in the hash table
+        //----------------------------------------------------------------------
+
+        int64_t k1 = -1, kk = -1 ;
+        if (GB_jitifyer_lookup (hash, encoding, NULL, &k1, &kk) != NULL)
+        { 
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // load the kernel and check its definitions
+        //----------------------------------------------------------------------
+
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%02x/%s%s%s",
+            GB_jit_cache_path, bucket, GB_LIB_PREFIX, item->kernel_name,
+            GB_LIB_SUFFIX) ;
+        void *dl_handle = GB_file_dlopen (GB_jit_temp) ;
+        if (dl_handle == NULL)
+        { 
+            // the kernel was not compiled; it is compiled when first needed
+            continue ;
+        }
+
+        GB_jit_query_func dl_query = (GB_jit_query_func)
+            GB_file_dlsym (dl_handle, "GB_jit_query") ;
+        void *dl_function = GB_file_dlsym (dl_handle, "GB_jit_kernel") ;
+        if (dl_query == NULL || dl_function == NULL ||
+            !GB_jitifyer_query (dl_query, hash, NULL, NULL, NULL, NULL, NULL,
+            NULL))
+        { 
+            // the kernel is stale; it is recompiled when first needed
+            GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // insert the kernel into the hash table
+        //----------------------------------------------------------------------
+
+        if (!GB_jitifyer_insert (hash, encoding, NULL, dl_handle, dl_function,
+            -1))
+        { 
+            // out of memory
+            GB_file_dlclose (dl_handle) ; dl_handle = NULL ;
+            GB_FREE_BATCH ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_BATCH ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_archive_worker: build a JIT archive in a critical section
+//------------------------------------------------------------------------------
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                                         \
+{                                                           \
+    for (int64_t k = 0 ; k < nitems ; k++)                  \
+    {                                                       \
+        if (Items [k].obj_file != NULL)                     \
+        {                                                   \
+            remove (Items [k].obj_file) ;                   \
+        }                                                   \
+    }                                                       \
+    GB_FREE_BATCH ;                                         \
+    GB_FREE_PERSISTENT (archive_file) ;                     \
+    GB_file_unlock_and_close (&fp_klock, &fd_klock) ;       \
+}
+
+static GrB_Info GB_jitifyer_archive_worker
+(
+    const char *manifest,       // filename of the manifest
+    int32_t ncompilers          // # of compilers to run at the same time
+)
+{
+
+    //--------------------------------------------------------------------------
+    // read the manifest
+    //--------------------------------------------------------------------------
+
+    GB_jit_batch_item *Items = NULL ;
+    int64_t nitems = 0 ;
+    GrB_Info info = GB_jitifyer_manifest_read (&Items, &nitems, manifest) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // manifest not found, not valid, or out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // quick return if the JIT may not compile any kernels
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_control < GxB_JIT_ON)
+    { 
+        GB_FREE_BATCH ;
+        return (GrB_SUCCESS) ;
+    }
+
+    if (GB_jit_use_cmake)
+    { 
+        // the archive can only be built with the direct compile method
+        GB_FREE_BATCH ;
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+
+    // finish any kernels being compiled in the background
+    GB_jitifyer_async_drain ( ) ;
+
+    //--------------------------------------------------------------------------
+    // lock the archive and create its build folder
+    //--------------------------------------------------------------------------
+
+    // The archive lock guards against other processes building the archive
+    // at the same time.
+
+    char *archive_file = NULL ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lock/%s_lock",
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME) ;
+    FILE *fp_klock = NULL ;
+    int fd_klock = -1 ;
+    if (!GB_file_open_and_lock (GB_jit_temp, &fp_klock, &fd_klock))
+    { 
+        // unable to lock the archive
+        GB_FREE_BATCH ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s",
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME) ;
+    if (!GB_file_mkdir (GB_jit_temp))
+    { 
+        // unable to create the build folder
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the command to compile each kernel
+    //--------------------------------------------------------------------------
+
+    // Each kernel is compiled into its own *.o file in the build folder, with
+    // its GB_jit_kernel and GB_jit_query functions renamed (just as for a
+    // PreJIT kernel), so that all kernels can be linked into one library.
+
+    char *burble_stdout = GB_Global_burble_get ( ) ? "" : GB_DEV_NULL ;
+    char *err_redirect = (strlen (GB_jit_error_log) > 0) ? " 2>> " : "" ;
+    int64_t ncompile = 0 ;
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        GB_jit_batch_item *item = &(Items [k]) ;
+        char *kernel_name = item->kernel_name ;
+        uint32_t bucket = item->hash & 0xFF ;
+
+        // check if the source file exists
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/c/%02x/%s.c",
+            GB_jit_cache_path, bucket, kernel_name) ;
+        FILE *fp = fopen (GB_jit_temp, "r") ;
+        if (fp == NULL)
+        { 
+            GBURBLE ("(jit: %s source not found) ", kernel_name) ;
+            continue ;
+        }
+        fclose (fp) ;
+
+        // the *.o file for this kernel, removed when the archive is done
+        snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s/%s%s",
+            GB_jit_cache_path, GB_JIT_ARCHIVE_NAME, kernel_name,
+            GB_OBJ_SUFFIX) ;
+        item->obj_file = GB_jitifyer_strdup (GB_jit_temp) ;
+        if (item->obj_file != NULL)
+        { 
+            remove (item->obj_file) ;
+        }
+
+        // the command to compile the kernel
+        snprintf (GB_jit_temp, GB_jit_temp_allocated,
+            "%s -DGB_JIT_RUNTIME=1 "        // compiler command
+            "-DGB_jit_kernel=%s "           // rename the kernel
+            "-DGB_jit_query=%s_query "      // rename the query
+            "%s "                           // C flags
+            "-I%s/src "                     // include source directory
+            "%s "                           // openmp include directories
+            "-o %s "                        // *.o output file
+            "-c %s/c/%02x/%s.c "            // *.c input file
+            "%s "                           // burble stdout
+            "%s %s ",                       // error log file
+            GB_jit_C_compiler,
+            kernel_name,
+            kernel_name,
+            GB_jit_C_flags,
+            GB_jit_cache_path,
+            GB_OMP_INC,
+            (item->obj_file == NULL) ? "" : item->obj_file,
+            GB_jit_cache_path, bucket, kernel_name,
+            burble_stdout,
+            err_redirect, GB_jit_error_log) ;
+        item->command = GB_jitifyer_strdup (GB_jit_temp) ;
+
+        // the kernel lock file, to guard the kernel source file
+        snprintf (GB_jit_temp, GB_jit_temp_allocated,
+            "%s/lock/%02x/%016" PRIx64 "_lock", GB_jit_cache_path, bucket,
+            item->hash) ;
+        item->lock_file = GB_jitifyer_strdup (GB_jit_temp) ;
+
+        if (item->command == NULL || item->obj_file == NULL ||
+            item->lock_file == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        ncompile++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compile the kernels in parallel
+    //--------------------------------------------------------------------------
+
+    if (ncompile > 0)
+    { 
+        int nthreads = (int) GB_IMIN (ncompile, GB_IMAX (ncompilers, 1)) ;
+        GBURBLE ("(jit: compiling %" PRId64 " kernels with %d compilers) ",
+            ncompile, nthreads) ;
+        GB_jitifyer_batch_compile (Items, nitems, nthreads, false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the kernels that were compiled
+    //--------------------------------------------------------------------------
+
+    int64_t narchive = 0 ;
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        GB_jit_batch_item *item = &(Items [k]) ;
+        if (item->command == NULL) continue ;
+        FILE *fp = fopen (item->obj_file, "r") ;
+        if (fp == NULL)
+        { 
+            // the kernel failed to compile; leave it out of the archive
+            GBURBLE ("(jit: %s compiler error) ", item->kernel_name) ;
+            GB_FREE_PERSISTENT (item->command) ;
+            continue ;
+        }
+        fclose (fp) ;
+        narchive++ ;
+    }
+
+    if (narchive == 0)
+    { 
+        // nothing to archive
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // list the *.o files to link into the archive
+    //--------------------------------------------------------------------------
+
+    // Only the *.o files of the kernels just compiled are linked, not any
+    // others that may be left in the build folder by a prior archive.  The
+    // list is passed to the linker in a response file, since it can be too
+    // long for the command line.
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s/%s.objs",
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME, GB_JIT_ARCHIVE_NAME) ;
+    FILE *fp = fopen (GB_jit_temp, "w") ;
+    if (fp == NULL)
+    { 
+        // unable to create the list
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        if (Items [k].command == NULL) continue ;
+        fprintf (fp, "\"%s\"\n", Items [k].obj_file) ;
+    }
+    fclose (fp) ;
+
+    //--------------------------------------------------------------------------
+    // create the list of kernels in the archive
+    //--------------------------------------------------------------------------
+
+    // The list is a function, GB_jit_archive, with the same signature as
+    // GB_prejit, that returns the kernels, their queries, and their names.
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s/%s.c",
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME, GB_JIT_ARCHIVE_NAME) ;
+    fp = fopen (GB_jit_temp, "w") ;
+    if (fp == NULL)
+    { 
+        // unable to create the list
+        GB_FREE_ALL ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    fprintf (fp, "// %s.c: list of kernels in a GraphBLAS JIT archive\n"
+        "#include <stdint.h>\n", GB_JIT_ARCHIVE_NAME) ;
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        if (Items [k].command == NULL) continue ;
+        char *kernel_name = Items [k].kernel_name ;
+        fprintf (fp, "void %s (void) ;\nvoid %s_query (void) ;\n",
+            kernel_name, kernel_name) ;
+    }
+    fprintf (fp, "static void *Kernels [%" PRId64 "] =\n{\n", narchive) ;
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        if (Items [k].command == NULL) continue ;
+        fprintf (fp, "    (void *) %s,\n", Items [k].kernel_name) ;
+    }
+    fprintf (fp, "} ;\nstatic void *Queries [%" PRId64 "] =\n{\n", narchive) ;
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        if (Items [k].command == NULL) continue ;
+        fprintf (fp, "    (void *) %s_query,\n", Items [k].kernel_name) ;
+    }
+    fprintf (fp, "} ;\nstatic char *Names [%" PRId64 "] =\n{\n", narchive) ;
+    for (int64_t k = 0 ; k < nitems ; k++)
+    {
+        if (Items [k].command == NULL) continue ;
+        fprintf (fp, "    \"%s\",\n", Items [k].kernel_name) ;
+    }
+    fprintf (fp, "} ;\n"
+        "void %s (int32_t *nkernels, void ***Kernel_handle,\n"
+        "    void ***Query_handle, char ***Name_handle)\n"
+        "{\n"
+        "    (*nkernels) = %" PRId64 " ;\n"
+        "    (*Kernel_handle) = Kernels ;\n"
+        "    (*Query_handle) = Queries ;\n"
+        "    (*Name_handle) = Names ;\n"
+        "}\n", GB_JIT_ARCHIVE_NAME, narchive) ;
+    fclose (fp) ;
+
+    //--------------------------------------------------------------------------
+    // link the archive
+    //--------------------------------------------------------------------------
+
+    // The archive is linked in the build folder and then renamed into the lib
+    // folder, so that any process already using the old archive is not
+    // affected.
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/lib/%s%s%s",
+        GB_jit_cache_path, GB_LIB_PREFIX, GB_JIT_ARCHIVE_NAME, GB_LIB_SUFFIX) ;
+    archive_file = GB_jitifyer_strdup (GB_jit_temp) ;
+    if (archive_file == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated,
+        "%s "                               // C compiler
+        "%s "                               // C flags
+        "%s "                               // C link flags
+        "-o %s/tmp/%s/%s%s%s "              // lib*.so output file
+        "%s/tmp/%s/%s.c "                   // list of kernels
+        "@%s/tmp/%s/%s.objs "               // list of *.o input files
+        "%s "                               // libraries to link with
+        "%s"                                // burble stdout
+        "%s %s ",                           // error log file
+        GB_jit_C_compiler,
+        GB_jit_C_flags,
+        GB_jit_C_link_flags,
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME,
+        GB_LIB_PREFIX, GB_JIT_ARCHIVE_NAME, GB_LIB_SUFFIX,
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME, GB_JIT_ARCHIVE_NAME,
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME, GB_JIT_ARCHIVE_NAME,
+        GB_jit_C_libraries,
+        burble_stdout,
+        err_redirect, GB_jit_error_log) ;
+    GBURBLE ("(jit: %s) ", GB_jit_temp) ;
+    GB_jitifyer_command (GB_jit_temp) ;
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s/%s%s%s",
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME,
+        GB_LIB_PREFIX, GB_JIT_ARCHIVE_NAME, GB_LIB_SUFFIX) ;
+    bool ok = (rename (GB_jit_temp, archive_file) == 0) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s/%s.c",
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME, GB_JIT_ARCHIVE_NAME) ;
+    remove (GB_jit_temp) ;
+    snprintf (GB_jit_temp, GB_jit_temp_allocated, "%s/tmp/%s/%s.objs",
+        GB_jit_cache_path, GB_JIT_ARCHIVE_NAME, GB_JIT_ARCHIVE_NAME) ;
+    remove (GB_jit_temp) ;
+    GB_FREE_ALL ;
+    if (!ok)
+    { 
+        GBURBLE ("(jit: archive link error) ") ;
+        return (GrB_INVALID_VALUE) ;
+    }
+    GBURBLE ("(jit: archive of %" PRId64 " kernels created) ", narchive) ;
+    return (GrB_SUCCESS) ;
+}
+
+#undef GB_FREE_ALL
+#undef GB_FREE_BATCH
+
+#endif
+
+GrB_Info GB_jitifyer_compile
+(
+    const char *manifest,       // filename of the manifest
+    int32_t ncompilers          // # of compilers to run at the same time
+)
+{ 
+
+    #ifndef NJIT
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    { 
+        info = GB_jitifyer_compile_worker (manifest, ncompilers) ;
+    }
+    return (info) ;
+    #else
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_archive: build a JIT archive from the kernels in a manifest
+//------------------------------------------------------------------------------
+
+// Each kernel listed in the manifest whose source is in the cache is compiled,
+// with up to ncompilers compilations running at the same time, and all of the
+// kernels are linked into a single library, lib/libGB_jit_archive.so in the
+// cache.  This archive replaces any prior one.  It is not loaded by this
+// method, but by the next call to GrB_init, or when the cache path is set.
+// Its kernels are then inserted in the hash table all at once, and used just
+// like PreJIT kernels.  The archive can only be built with the direct compile
+// method, not with cmake.
+
+GrB_Info GB_jitifyer_archive
+(
+    const char *manifest,       // filename of the manifest
+    int32_t ncompilers          // # of compilers to run at the same time
+)
+{ 
+
+    #ifndef NJIT
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    { 
+        info = GB_jitifyer_archive_worker (manifest, ncompilers) ;
+    }
+    return (info) ;
+    #else
+    return (GrB_SUCCESS) ;
+    #endif
 }
 
 //------------------------------------------------------------------------------
@@ -31,11 +31,11 @@ void GB_prejit
 typedef enum
 {
     GB_jit_reduce_family    = 1,    // kcode 1
-    GB_jit_mxm_family       = 2,    // kcodes 2 to 9
-    GB_jit_ewise_family     = 3,    // kcodes 10 to 24
+    GB_jit_mxm_family       = 2,    // kcodes 2 to 9, and 88
+    GB_jit_ewise_family     = 3,    // kcodes 10 to 24, and 83
     GB_jit_apply_family     = 4,    // kcodes 25 to 33
     GB_jit_build_family     = 5,    // kcode 34
-    GB_jit_select_family    = 6,    // kcodes 35 to 37
+    GB_jit_select_family    = 6,    // kcodes 35 to 37, and 89
     GB_jit_user_op_family   = 7,    // kcode 38
     GB_jit_user_type_family = 8,    // kcode 39
     GB_jit_assign_family    = 9,    // kcodes 40 to 44 (future:: to 78)
@@ -63,6 +63,7 @@ typedef enum
     GB_JIT_KERNEL_AXB_SAXPY3    = 7,  // GB_AxB_saxpy3
     GB_JIT_KERNEL_AXB_SAXPY4    = 8,  // GB_AxB_saxpy4
     GB_JIT_KERNEL_AXB_SAXPY5    = 9,  // GB_AxB_saxpy5
+    GB_JIT_KERNEL_AXB_OUTER     = 88, // GB_AxB_outer
 
     // ewise methods:
     GB_JIT_KERNEL_COLSCALE      = 10, // GB_colscale
@@ -80,6 +81,7 @@ typedef enum
     GB_JIT_KERNEL_APPLYBIND2    = 22, // GB_apply_op, bind2nd
     GB_JIT_KERNEL_TRANSBIND1    = 23, // GB_transpose_op, bind1st
     GB_JIT_KERNEL_TRANSBIND2    = 24, // GB_transpose_op, bind2nd
+    GB_JIT_KERNEL_KRONER        = 83, // GB_kroner
 
     // apply (unary and idxunary op) methods:
     GB_JIT_KERNEL_APPLYUNOP     = 25, // GB_apply_op, GB_cast_array
@@ -99,6 +101,7 @@ typedef enum
     GB_JIT_KERNEL_SELECT1       = 35, // GB_select_sparse
     GB_JIT_KERNEL_SELECT2       = 36, // GB_select_sparse
     GB_JIT_KERNEL_SELECT_BITMAP = 37, // GB_select_bitmap
+    GB_JIT_KERNEL_SELECT_MASKED = 89, // GB_select_masked
 
     // user type and op
     GB_JIT_KERNEL_USERTYPE      = 38, // GxB_Type_new
@@ -161,9 +164,6 @@ typedef enum
     GB_JIT_KERNEL_MASKER_PHASE1 = 81, // GB_masker_phase1
     GB_JIT_KERNEL_MASKER_PHASE2 = 82, // GB_masker_phase2
 
-    // future:: Kronecker:
-    GB_JIT_KERNEL_KRONER        = 83, // GB_kroner
-
     // future:: utilities:
     GB_JIT_KERNEL_CHECKISO      = 84, // GB_check_if_iso
     GB_JIT_KERNEL_CONVERTBITMAP = 85, // GB_convert_bitmap_worker
@@ -269,7 +269,8 @@ GrB_Info GB_jitifyer_load_worker
     GB_Operator op2,
     GrB_Type type1,
     GrB_Type type2,
-    GrB_Type type3
+    GrB_Type type3,
+    bool compiled               // true if just compiled in the background
 ) ;
 
 void *GB_jitifyer_lookup    // return dl_function pointer, or NULL if not found
@@ -326,6 +327,21 @@ bool GB_jitifyer_query
 
 void GB_jitifyer_cmake_compile (char *kernel_name, uint64_t hash) ;
 void GB_jitifyer_direct_compile (char *kernel_name, uint32_t bucket) ;
+void GB_jitifyer_direct_command (char *kernel_name, uint32_t bucket) ;
+
+GrB_Info GB_jitifyer_compile
+(
+    const char *manifest,       // filename of the manifest
+    int32_t ncompilers          // # of compilers to run at the same time
+) ;
+
+GrB_Info GB_jitifyer_archive
+(
+    const char *manifest,       // filename of the manifest
+    int32_t ncompilers          // # of compilers to run at the same time
+) ;
+
+GB_jit_kcode GB_jitifyer_kcode (const char *kname) ;
 
 GrB_Info GB_jitifyer_init (void) ;  // initialize the JIT
 
@@ -376,8 +392,16 @@ const char *GB_jitifyer_get_error_log (void) ;
 GrB_Info GB_jitifyer_set_error_log (const char *new_error_log) ;
 GrB_Info GB_jitifyer_set_error_log_worker (const char *new_error_log) ;
 
+const char *GB_jitifyer_get_record (void) ;
+GrB_Info GB_jitifyer_set_record (const char *new_record) ;
+GrB_Info GB_jitifyer_set_record_worker (const char *new_record) ;
+
 bool GB_jitifyer_get_use_cmake (void) ;
 void GB_jitifyer_set_use_cmake (bool use_cmake) ;
 
+bool GB_jitifyer_get_async (void) ;
+void GB_jitifyer_set_async (bool async) ;
+void GB_jitifyer_async_drain (void) ;
+
 #endif
 
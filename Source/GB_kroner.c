@@ -7,27 +7,25 @@
 
 //------------------------------------------------------------------------------
 
-// JIT: needed.
+// JIT: done.
 
 // C = kron(A,B) where op determines the binary multiplier to use.  The type of
 // A and B are compatible with the x and y inputs of z=op(x,y), but can be
 // different.  The type of C is the type of z.  C is hypersparse if either A
 // or B are hypersparse.
 
-// FUTURE: this would be faster with built-in types and operators.
-
-// FUTURE: at most one thread is used for each vector of C=kron(A,B).  The
-// matrix C is normally very large, but if both A and B are n-by-1, then C is
-// n^2-by-1 and only a single thread is used.  A better method for this case
-// would construct vectors of C in parallel.
-
-// FUTURE: each vector C(:,k) takes O(nnz(C(:,k))) work, but this is not
-// accounted for in the parallel load-balancing.
-
-#define GB_FREE_WORKSPACE       \
-{                               \
-    GB_Matrix_free (&Awork) ;   \
-    GB_Matrix_free (&Bwork) ;   \
+// The entries of C are sliced with GB_ek_slice, so the work is balanced across
+// the threads by the number of entries in C, and a single vector of C can be
+// computed by many threads.  This is important when both A and B are n-by-1,
+// so that C is n^2-by-1 with a single vector.  The JIT kernel is used for all
+// non-positional operators; the generic kernel handles positional operators,
+// the iso case, and the case when the JIT is disabled.
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (C_ek_slicing, int64_t) ;   \
+    GB_Matrix_free (&Awork) ;               \
+    GB_Matrix_free (&Bwork) ;               \
 }
 
 #define GB_FREE_ALL         \
@@ -38,6 +36,8 @@
 
 #include "GB_kron.h"
 #include "GB_emult.h"
+#include "GB_ek_slice.h"
+#include "GB_stringify.h"
 
 GrB_Info GB_kroner                  // C = kron (A,B)
 (
@@ -61,6 +61,7 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     struct GB_Matrix_opaque Awork_header, Bwork_header ;
     GrB_Matrix Awork = NULL, Bwork = NULL ;
+    GB_WERK_DECLARE (C_ek_slicing, int64_t) ;
 
     ASSERT_MATRIX_OK (A_in, "A_in for kron (A,B)", GB0) ;
     ASSERT_MATRIX_OK (B_in, "B_in for kron (A,B)", GB0) ;
@@ -109,8 +110,6 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     const int64_t *restrict Ap = A->p ;
     const int64_t *restrict Ah = A->h ;
-    const int64_t *restrict Ai = A->i ;
-    const GB_void *restrict Ax = A_is_pattern ? NULL : ((GB_void *) A->x) ;
     const int64_t asize = A->type->size ;
     const int64_t avlen = A->vlen ;
     const int64_t avdim = A->vdim ;
@@ -119,8 +118,6 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     const int64_t *restrict Bp = B->p ;
     const int64_t *restrict Bh = B->h ;
-    const int64_t *restrict Bi = B->i ;
-    const GB_void *restrict Bx = B_is_pattern ? NULL : ((GB_void *) B->x) ;
     const int64_t bsize = B->type->size ;
     const int64_t bvlen = B->vlen ;
     const int64_t bvdim = B->vdim ;
@@ -181,38 +178,11 @@ GrB_Info GB_kroner                  // C = kron (A,B)
         sparsity, true, B->hyper_switch, cnvec, cnzmax, true, C_iso)) ;
 
     //--------------------------------------------------------------------------
-    // get C and the operator
+    // get C
     //--------------------------------------------------------------------------
 
     int64_t *restrict Cp = C->p ;
     int64_t *restrict Ch = C->h ;
-    int64_t *restrict Ci = C->i ;
-    GB_void *restrict Cx = (GB_void *) C->x ;
-    int64_t *restrict Cx_int64 = NULL ;
-    int32_t *restrict Cx_int32 = NULL ;
-
-    GxB_binary_function fmult = op->binop_function ;
-    GB_Opcode opcode = op->opcode ;
-    bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
-    GB_cast_function cast_A = NULL, cast_B = NULL ;
-    if (!A_is_pattern)
-    { 
-        cast_A = GB_cast_factory (op->xtype->code, A->type->code) ;
-    }
-    if (!B_is_pattern)
-    { 
-        cast_B = GB_cast_factory (op->ytype->code, B->type->code) ;
-    }
-
-    int64_t offset = 0 ;
-    bool depends_on_j = false ;
-    if (op_is_positional)
-    { 
-        offset = GB_positional_offset (opcode, NULL, &depends_on_j) ;
-        Cx_int64 = (int64_t *) Cx ;
-        Cx_int32 = (int32_t *) Cx ;
-    }
-    bool is64 = (ctype == GrB_INT64) ;
 
     //--------------------------------------------------------------------------
     // compute the column counts of C, and C->h if C is hypersparse
@@ -268,136 +238,157 @@ GrB_Info GB_kroner                  // C = kron (A,B)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // slice the entries of C
+    //--------------------------------------------------------------------------
+
+    int C_ntasks, C_nthreads ;
+    GB_SLICE_MATRIX (C, 8) ;
+
     //--------------------------------------------------------------------------
     // C = kron (A,B)
     //--------------------------------------------------------------------------
 
-    const bool A_iso = A->iso ;
-    const bool B_iso = B->iso ;
+    GB_Opcode opcode = op->opcode ;
+    bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
+    info = GrB_NO_VALUE ;
+
+    if (C_iso)
+    { 
+
+        //----------------------------------------------------------------------
+        // C is iso: only the pattern of C is computed
+        //----------------------------------------------------------------------
 
-    #pragma omp parallel for num_threads(nthreads) schedule(guided)
-    for (kC = 0 ; kC < cnvec ; kC++)
+        #define GB_ISO_KRONER
+        #include "GB_kroner_template.c"
+        info = GrB_SUCCESS ;
+    }
+    else if (!op_is_positional)
+    { 
+
+        //----------------------------------------------------------------------
+        // via the JIT or PreJIT kernel
+        //----------------------------------------------------------------------
+
+        // No factory kernels are provided for kron.  There were none before
+        // the JIT kernel was added either: the prior method used the generic
+        // kernel for all operators and types, and it still does so if the
+        // JIT is disabled, but now with entry-balanced tasks.
+        info = GB_kroner_jit (C, op, A, B, C_ek_slicing, C_ntasks,
+            C_nthreads) ;
+    }
+
+    if (info == GrB_NO_VALUE)
     {
-        int64_t kA = kC / bnvec ;
-        int64_t kB = kC % bnvec ;
-
-        // get B(:,jB), the (kB)th vector of B
-        int64_t jB = GBH (Bh, kB) ;
-        int64_t pB_start = GBP (Bp, kB, bvlen) ;
-        int64_t pB_end   = GBP (Bp, kB+1, bvlen) ;
-        int64_t bknz = pB_start - pB_end ;
-        if (bknz == 0) continue ;
-        GB_void bwork [GB_VLA(bsize)] ;
-        if (!B_is_pattern && B_iso)
-        { 
-            cast_B (bwork, Bx, bsize) ;
-        }
 
-        // get C(:,jC), the (kC)th vector of C
-        // int64_t kC = kA * bnvec + kB ;
-        int64_t pC = GBP (Cp, kC, cvlen) ;
+        //----------------------------------------------------------------------
+        // via the generic kernel
+        //----------------------------------------------------------------------
 
-        // get A(:,jA), the (kA)th vector of A
-        int64_t jA = GBH (Ah, kA) ;
-        int64_t pA_start = GBP (Ap, kA, avlen) ;
-        int64_t pA_end   = GBP (Ap, kA+1, avlen) ;
-        GB_void awork [GB_VLA(asize)] ;
-        if (!A_is_pattern && A_iso)
+        GBURBLE ("(generic kron) ") ;
+        GB_cast_function cast_A = NULL, cast_B = NULL ;
+        if (!A_is_pattern)
+        { 
+            cast_A = GB_cast_factory (op->xtype->code, A->type->code) ;
+        }
+        if (!B_is_pattern)
         { 
-            cast_A (awork, Ax, asize) ;
+            cast_B = GB_cast_factory (op->ytype->code, B->type->code) ;
         }
+        const size_t xsize = (A_is_pattern) ? 1 : op->xtype->size ;
+        const size_t ysize = (B_is_pattern) ? 1 : op->ytype->size ;
+
+        // declare aij as xtype
+        #define GB_DECLAREA(aij)                                            \
+            GB_void aij [GB_VLA(xsize)] ;
+
+        // aij = (xtype) A(i,j), located in Ax [pA]
+        #define GB_GETA(aij,Ax,pA,A_iso)                                    \
+            if (cast_A != NULL)                                             \
+            {                                                               \
+                cast_A (aij, Ax +((A_iso) ? 0:(pA)*asize), asize) ;         \
+            }
+
+        // declare bij as ytype
+        #define GB_DECLAREB(bij)                                            \
+            GB_void bij [GB_VLA(ysize)] ;
 
-        for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+        // bij = (ytype) B(i,j), located in Bx [pB]
+        #define GB_GETB(bij,Bx,pB,B_iso)                                    \
+            if (cast_B != NULL)                                             \
+            {                                                               \
+                cast_B (bij, Bx +((B_iso) ? 0:(pB)*bsize), bsize) ;         \
+            }
+
+        #include "GB_generic.h"
+
+        if (op_is_positional)
         {
-            // awork = A(iA,jA), typecasted to op->xtype
-            int64_t iA = GBI (Ai, pA, avlen) ;
-            int64_t iAblock = iA * bvlen ;
-            if (!A_is_pattern && !A_iso)
+
+            //------------------------------------------------------------------
+            // positional binary operator
+            //------------------------------------------------------------------
+
+            // z = first_i(A(iA,jA),y) == iA, first_j(A(iA,jA),y) == jA,
+            // z = second_i(x,B(iB,jB)) == iB, second_j(x,B(iB,jB)) == jB,
+            // or the 1-based variants (iA+1, jA+1, iB+1, or jB+1).
+            bool depends_on_j ;
+            const int64_t offset = GB_positional_offset (opcode, NULL,
+                &depends_on_j) ;
+            const bool index_is_first =
+                (opcode == GB_FIRSTI_binop_code  ) ||
+                (opcode == GB_FIRSTI1_binop_code ) ||
+                (opcode == GB_FIRSTJ_binop_code  ) ||
+                (opcode == GB_FIRSTJ1_binop_code ) ;
+
+            #define GB_KRONER_INDEX(iA,jA,iB,jB)                            \
+                (index_is_first ? (depends_on_j ? (jA) : (iA))              \
+                                : (depends_on_j ? (jB) : (iB))) + offset
+
+            if (op->ztype == GrB_INT64)
             { 
-                cast_A (awork, Ax + (pA*asize), asize) ;
+                #undef  GB_C_TYPE
+                #define GB_C_TYPE int64_t
+                #define GB_KRONER_OP(Cx,pC,aij,bij,iA,jA,iB,jB)             \
+                    Cx [pC] = GB_KRONER_INDEX (iA, jA, iB, jB)
+                #include "GB_kroner_template.c"
+                #undef  GB_KRONER_OP
             }
-            for (int64_t pB = pB_start ; pB < pB_end ; pB++)
-            {
-                // bwork = B(iB,jB), typecasted to op->ytype
-                int64_t iB = GBI (Bi, pB, bvlen) ;
-                if (!B_is_pattern && !B_iso)
-                { 
-                    cast_B (bwork, Bx +(pB*bsize), bsize) ;
-                }
-                // C(iC,jC) = A(iA,jA) * B(iB,jB)
-                if (!C_is_full)
-                { 
-                    int64_t iC = iAblock + iB ;
-                    Ci [pC] = iC ;
-                }
-                if (op_is_positional)
-                {
-                    // positional binary operator
-                    switch (opcode)
-                    {
-                        case GB_FIRSTI_binop_code   : 
-                            // z = first_i(A(iA,jA),y) == iA
-                        case GB_FIRSTI1_binop_code  : 
-                            // z = first_i1(A(iA,jA),y) == iA+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = iA + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (iA + offset) ;
-                            }
-                            break ;
-                        case GB_FIRSTJ_binop_code   : 
-                            // z = first_j(A(iA,jA),y) == jA
-                        case GB_FIRSTJ1_binop_code  : 
-                            // z = first_j1(A(iA,jA),y) == jA+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = jA + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (jA + offset) ;
-                            }
-                            break ;
-                        case GB_SECONDI_binop_code  : 
-                            // z = second_i(x,B(iB,jB)) == iB
-                        case GB_SECONDI1_binop_code : 
-                            // z = second_i1(x,B(iB,jB)) == iB+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = iB + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (iB + offset) ;
-                            }
-                            break ;
-                        case GB_SECONDJ_binop_code  : 
-                            // z = second_j(x,B(iB,jB)) == jB
-                        case GB_SECONDJ1_binop_code : 
-                            // z = second_j1(x,B(iB,jB)) == jB+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = jB + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (jB + offset) ;
-                            }
-                            break ;
-                        default: ;
-                    }
-                }
-                else if (!C_iso)
-                { 
-                    // standard binary operator
-                    fmult (Cx +(pC*csize), awork, bwork) ;
-                }
-                pC++ ;
+            else
+            { 
+                #undef  GB_C_TYPE
+                #define GB_C_TYPE int32_t
+                #define GB_KRONER_OP(Cx,pC,aij,bij,iA,jA,iB,jB)             \
+                    Cx [pC] = (int32_t) (GB_KRONER_INDEX (iA, jA, iB, jB))
+                #include "GB_kroner_template.c"
+                #undef  GB_KRONER_OP
             }
         }
+        else
+        { 
+
+            //------------------------------------------------------------------
+            // standard binary operator
+            //------------------------------------------------------------------
+
+            // C has the same type as z, so no typecast of z is needed
+            GxB_binary_function fmult = op->binop_function ;
+            #undef  GB_C_TYPE
+            #define GB_C_TYPE GB_void
+            #define GB_KRONER_OP(Cx,pC,aij,bij,iA,jA,iB,jB)                 \
+                fmult (Cx +((pC)*csize), aij, bij)
+            #include "GB_kroner_template.c"
+            #undef  GB_KRONER_OP
+        }
+        info = GrB_SUCCESS ;
+    }
+
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory, or other error
+        GB_FREE_ALL ;
+        return (info) ;
     }
 
     //--------------------------------------------------------------------------
@@ -26,6 +26,10 @@ void GB_macrofy_select          // construct all macros for GrB_select
     // extract the select scode
     //--------------------------------------------------------------------------
 
+    // mask (6 bits)
+    int msparsity   = GB_RSHIFT (scode, 42, 2) ;
+    int mask_ecode  = GB_RSHIFT (scode, 38, 4) ;
+
     // iso of A and C (2 bits)
     bool C_iso      = GB_RSHIFT (scode, 37, 1) ;
     bool A_iso      = GB_RSHIFT (scode, 36, 1) ;
@@ -225,6 +229,15 @@ void GB_macrofy_select          // construct all macros for GrB_select
     GB_macrofy_input (fp, "a", "A", "A", true, xtype,
         atype, asparsity, acode, 0, -1) ;
 
+    //--------------------------------------------------------------------------
+    // construct the macros for M, for the masked selector only
+    //--------------------------------------------------------------------------
+
+    if (mask_ecode != 0)
+    { 
+        GB_macrofy_mask (fp, mask_ecode, "M", msparsity) ;
+    }
+
     //--------------------------------------------------------------------------
     // include the final default definitions
     //--------------------------------------------------------------------------
@@ -27,6 +27,13 @@ static inline void *GB_malloc_helper
     // make sure the block is at least 8 bytes in size
     (*size) = GB_IMAX (*size, 8) ;
 
+    // get a block from the memory pool, if enabled; this may round up the size
+    p = GB_memory_pool_get (size) ;
+    if (p != NULL)
+    { 
+        return (p) ;
+    }
+
     p = GB_Global_malloc_function (*size) ;
 
     #ifdef GB_MEMDUMP
@@ -20,7 +20,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     size_t *mem_deep,       // # of bytes in blocks owned by this matrix
     size_t *mem_shallow,    // # of bytes in blocks owned by another matrix
     const GrB_Matrix A,     // matrix to query
-    bool count_hyper_hash   // if true, include A->Y
+    bool count_hyper_hash   // if true, include A->Y and cached schedules
 ) ;
 
 // See GB_callbacks.h:
@@ -59,6 +59,35 @@ void *GB_xalloc_memory      // return the newly-allocated space
     size_t *size            // resulting size
 ) ;
 
+//------------------------------------------------------------------------------
+// memory pool
+//------------------------------------------------------------------------------
+
+void *GB_memory_pool_get    // get a block from the pool, or NULL
+(
+    // input/output:
+    size_t *size            // on input: # of bytes requested
+                            // on output: # of bytes to allocate
+) ;
+
+bool GB_memory_pool_put     // return true if the block is kept in the pool
+(
+    void *p,                // block to free
+    size_t size             // size of the block, in bytes
+) ;
+
+GrB_Info GB_memory_pool_limit_set (int64_t limit) ;
+int64_t  GB_memory_pool_limit_get (void) ;
+
+void GB_memory_pool_stats
+(
+    int64_t *nbytes,        // # of bytes held in the pool
+    int64_t *hits,          // # of requests satisfied by the pool
+    int64_t *misses         // # of requests that called malloc
+) ;
+
+void GB_memory_pool_finalize (void) ;
+
 //------------------------------------------------------------------------------
 // parallel memcpy and memset
 //------------------------------------------------------------------------------
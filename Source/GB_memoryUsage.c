@@ -8,6 +8,8 @@
 //------------------------------------------------------------------------------
 
 #include "GB.h"
+#include "GB_AxB_saxpy3.h"
+#include "GB_ek_slice.h"
 
 void GB_memoryUsage         // count # allocated blocks and their sizes
 (
@@ -15,7 +17,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     size_t *mem_deep,       // # of bytes in blocks owned by this matrix
     size_t *mem_shallow,    // # of bytes in blocks owned by another matrix
     const GrB_Matrix A,     // matrix to query
-    bool count_hyper_hash   // if true, include A->Y
+    bool count_hyper_hash   // if true, include A->Y and cached schedules
 )
 {
 
@@ -160,6 +162,22 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         }
     }
 
+    if (count_hyper_hash && A->saxpy3_schedule != NULL)
+    { 
+        // the cached saxpy3 tasks are never shallow
+        (*nallocs) += 2 ;
+        (*mem_deep) += A->saxpy3_schedule->header_size
+                    +  A->saxpy3_schedule->SaxpyTasks_size ;
+    }
+
+    if (count_hyper_hash && A->ek_slice_cache != NULL)
+    { 
+        // the cached slice is never shallow
+        (*nallocs) += 2 ;
+        (*mem_deep) += A->ek_slice_cache->header_size
+                    +  A->ek_slice_cache->ek_slicing_size ;
+    }
+
     #pragma omp flush
     return ;
 }
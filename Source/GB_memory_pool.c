@@ -0,0 +1,385 @@
+//------------------------------------------------------------------------------
+// GB_memory_pool: pool of free blocks for GB_malloc_memory and GB_free_memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Blocks freed by GB_free_memory can be kept in a pool and reused by
+// GB_malloc_memory and GB_calloc_memory, instead of being returned to the
+// free function passed to GxB_init (or the ANSI C free).  This avoids
+// contention in the allocator, and page faults from memory returned to the
+// operating system and then requested again, when an application makes many
+// calls to GraphBLAS on small problems.
+
+// When the pool is enabled, each request of size 2^GB_POOL_MAXLOG or less is
+// rounded up to the next power of two, and the rounded size is returned to
+// the caller as the size_allocated.  GB_free_memory uses this size to find
+// the size class of the block.  Each thread has its own cache of up to
+// GB_POOL_THREAD_MAX blocks of each size class, which it accesses with no
+// synchronization.  If the thread cache is full, a freed block spills to a
+// global list for its size class, and if the thread cache is empty, a
+// request is satisfied from the global list.  The global lists are protected
+// by a critical section.  The free blocks are kept in singly-linked lists,
+// with the link held in the first 8 bytes of each free block.
+
+// The total number of bytes held in the pool (in all thread caches and the
+// global lists) is limited by GrB_set (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT).
+// The default limit is zero, which disables the pool.  The pool requires
+// OpenMP for its thread-local caches.  It is also bypassed if malloc tracking
+// is enabled, which is used for testing only.
+
+// Setting the limit, and GrB_finalize, free all blocks in the pool.  Neither
+// may be done while any other user thread is calling GraphBLAS.
+
+#include "GB.h"
+
+#define GB_POOL_MINLOG 3                        // smallest class: 8 bytes
+#define GB_POOL_MAXLOG 24                       // largest class: 16 MB
+#define GB_POOL_NCLASSES (GB_POOL_MAXLOG+1)
+#define GB_POOL_THREAD_MAX 4                    // max blocks per thread class
+
+#define GB_POOL_NEXT(p) (*((void **) (p)))      // link to next free block
+
+//------------------------------------------------------------------------------
+// pool state
+//------------------------------------------------------------------------------
+
+typedef struct GB_pool_cache_struct GB_pool_cache ;
+
+struct GB_pool_cache_struct     // free blocks held by a single thread
+{
+    void *head [GB_POOL_NCLASSES] ;     // free blocks of size 2^k
+    int nblocks [GB_POOL_NCLASSES] ;    // # of blocks in head [k]
+    int64_t hits ;                      // # of requests satisfied by the pool
+    int64_t misses ;                    // # of requests passed to malloc
+    GB_pool_cache *next ;               // next thread cache
+} ;
+
+static int64_t GB_pool_limit = 0 ;      // max # of bytes held in the pool
+static int64_t GB_pool_nbytes = 0 ;     // # of bytes held in the pool
+static void *GB_pool_head [GB_POOL_NCLASSES] ;  // global lists of free blocks
+static GB_pool_cache *GB_pool_caches = NULL ;   // list of all thread caches
+static int64_t GB_pool_generation = 1 ; // incremented by GrB_finalize
+
+#if defined ( _OPENMP )
+// Each thread has its own cache.  GB_pool_thread is stale if its generation
+// does not match GB_pool_generation (the cache was freed by GrB_finalize).
+static GB_pool_cache *GB_pool_thread = NULL ;
+static int64_t GB_pool_thread_generation = 0 ;
+#pragma omp threadprivate (GB_pool_thread, GB_pool_thread_generation)
+#endif
+
+//------------------------------------------------------------------------------
+// GB_pool_class: find the size class of a block
+//------------------------------------------------------------------------------
+
+static inline int GB_pool_class (size_t size)
+{
+    int k = GB_POOL_MINLOG ;
+    while ((((size_t) 1) << k) < size)
+    {
+        k++ ;
+    }
+    return (k) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_enabled: true if the pool can be used for a block of a given size
+//------------------------------------------------------------------------------
+
+static inline bool GB_pool_enabled (size_t size)
+{
+    return (GB_pool_limit > 0 && size <= (((size_t) 1) << GB_POOL_MAXLOG)
+        && !GB_Global_malloc_tracking_get ( )) ;
+}
+
+#if defined ( _OPENMP )
+
+//------------------------------------------------------------------------------
+// GB_pool_cache_get: get the cache of this thread, creating it if needed
+//------------------------------------------------------------------------------
+
+static GB_pool_cache *GB_pool_cache_get (void)
+{
+    if (GB_pool_thread == NULL ||
+        GB_pool_thread_generation != GB_pool_generation)
+    {
+        GB_pool_cache *cache =
+            GB_Global_persistent_malloc (sizeof (GB_pool_cache)) ;
+        if (cache == NULL)
+        {
+            // out of memory: the pool cannot be used by this thread
+            return (NULL) ;
+        }
+        memset (cache, 0, sizeof (GB_pool_cache)) ;
+        #pragma omp critical (GB_memory_pool)
+        {
+            cache->next = GB_pool_caches ;
+            GB_pool_caches = cache ;
+        }
+        GB_pool_thread = cache ;
+        GB_pool_thread_generation = GB_pool_generation ;
+    }
+    return (GB_pool_thread) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_get: get a block from the pool
+//------------------------------------------------------------------------------
+
+// If the pool is enabled for a block of this size, the size is rounded up to
+// its size class.  A block of that size is returned if the pool holds one;
+// otherwise NULL is returned and the caller must allocate a new block of the
+// rounded size.
+
+void *GB_memory_pool_get
+(
+    // input/output:
+    size_t *size            // on input: # of bytes requested
+                            // on output: # of bytes to allocate
+)
+{
+
+    #if defined ( _OPENMP )
+    if (!GB_pool_enabled (*size))
+    {
+        return (NULL) ;
+    }
+
+    int k = GB_pool_class (*size) ;
+    (*size) = ((size_t) 1) << k ;
+    GB_pool_cache *cache = GB_pool_cache_get ( ) ;
+    if (cache == NULL)
+    {
+        return (NULL) ;
+    }
+
+    // get a block from the thread cache, or from the global list if empty
+    void *p = cache->head [k] ;
+    if (p != NULL)
+    {
+        cache->head [k] = GB_POOL_NEXT (p) ;
+        cache->nblocks [k]-- ;
+    }
+    else
+    {
+        #pragma omp critical (GB_memory_pool)
+        {
+            p = GB_pool_head [k] ;
+            if (p != NULL)
+            {
+                GB_pool_head [k] = GB_POOL_NEXT (p) ;
+            }
+        }
+    }
+
+    if (p == NULL)
+    {
+        cache->misses++ ;
+        return (NULL) ;
+    }
+
+    cache->hits++ ;
+    int64_t s = (int64_t) (*size) ;
+    GB_ATOMIC_UPDATE
+    GB_pool_nbytes -= s ;
+    return (p) ;
+    #else
+    return (NULL) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_put: return a block to the pool
+//------------------------------------------------------------------------------
+
+// Returns true if the block was placed in the pool, or false if the caller
+// must free it.  A block is kept only if its size is exactly one of the size
+// classes and the pool would not exceed its limit.
+
+bool GB_memory_pool_put
+(
+    void *p,                // block to free
+    size_t size             // size of the block, in bytes
+)
+{
+
+    #if defined ( _OPENMP )
+    if (!GB_pool_enabled (size) || size < (((size_t) 1) << GB_POOL_MINLOG)
+        || (size & (size-1)) != 0)
+    {
+        return (false) ;
+    }
+
+    // reserve space in the pool.  The read may include reservations by other
+    // threads, so the block is conservatively rejected if they all do not fit.
+    // An atomic capture is not used, since MS Visual Studio does not have it.
+    int64_t s = (int64_t) size, nbytes ;
+    GB_ATOMIC_UPDATE
+    GB_pool_nbytes += s ;
+    GB_ATOMIC_READ
+    nbytes = GB_pool_nbytes ;
+    GB_pool_cache *cache = NULL ;
+    if (nbytes <= GB_pool_limit)
+    {
+        cache = GB_pool_cache_get ( ) ;
+    }
+    if (cache == NULL)
+    {
+        // pool is full, or the thread cache cannot be allocated
+        GB_ATOMIC_UPDATE
+        GB_pool_nbytes -= s ;
+        return (false) ;
+    }
+
+    // put the block in the thread cache, or in the global list if full
+    int k = GB_pool_class (size) ;
+    if (cache->nblocks [k] < GB_POOL_THREAD_MAX)
+    {
+        GB_POOL_NEXT (p) = cache->head [k] ;
+        cache->head [k] = p ;
+        cache->nblocks [k]++ ;
+    }
+    else
+    {
+        #pragma omp critical (GB_memory_pool)
+        {
+            GB_POOL_NEXT (p) = GB_pool_head [k] ;
+            GB_pool_head [k] = p ;
+        }
+    }
+    return (true) ;
+    #else
+    return (false) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_pool_list_free: free all blocks in a list
+//------------------------------------------------------------------------------
+
+static void GB_pool_list_free (void **head)
+{
+    void *p = (*head) ;
+    while (p != NULL)
+    {
+        void *next = GB_POOL_NEXT (p) ;
+        GB_Global_free_function (p) ;
+        p = next ;
+    }
+    (*head) = NULL ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_flush: free all blocks held in the pool
+//------------------------------------------------------------------------------
+
+// If free_caches is true, the thread caches are also freed (by GrB_finalize).
+
+static void GB_memory_pool_flush (bool free_caches)
+{
+    #pragma omp critical (GB_memory_pool)
+    {
+        GB_pool_cache *cache = GB_pool_caches ;
+        while (cache != NULL)
+        {
+            for (int k = 0 ; k < GB_POOL_NCLASSES ; k++)
+            {
+                GB_pool_list_free (&(cache->head [k])) ;
+                cache->nblocks [k] = 0 ;
+            }
+            GB_pool_cache *next = cache->next ;
+            if (free_caches)
+            {
+                GB_Global_persistent_free ((void **) &cache) ;
+            }
+            cache = next ;
+        }
+        if (free_caches)
+        {
+            GB_pool_caches = NULL ;
+            GB_pool_generation++ ;
+        }
+        for (int k = 0 ; k < GB_POOL_NCLASSES ; k++)
+        {
+            GB_pool_list_free (&(GB_pool_head [k])) ;
+        }
+        GB_pool_nbytes = 0 ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_limit_set: set the max # of bytes held in the pool
+//------------------------------------------------------------------------------
+
+GrB_Info GB_memory_pool_limit_set (int64_t limit)
+{
+    if (limit < 0)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    #if !defined ( _OPENMP )
+    if (limit > 0)
+    {
+        // the pool requires OpenMP
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    #endif
+    GB_pool_limit = 0 ;
+    GB_memory_pool_flush (false) ;
+    GB_pool_limit = limit ;
+    return (GrB_SUCCESS) ;
+}
+
+int64_t GB_memory_pool_limit_get (void)
+{
+    return (GB_pool_limit) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_stats: return the pool statistics
+//------------------------------------------------------------------------------
+
+// The hits and misses are summed over all thread caches.  They are counted
+// since GrB_init, or the last call to GrB_finalize.
+
+void GB_memory_pool_stats
+(
+    int64_t *nbytes,        // # of bytes held in the pool
+    int64_t *hits,          // # of requests satisfied by the pool
+    int64_t *misses         // # of requests that called malloc
+)
+{
+    int64_t h = 0, m = 0 ;
+    #pragma omp critical (GB_memory_pool)
+    {
+        for (GB_pool_cache *cache = GB_pool_caches ; cache != NULL ;
+            cache = cache->next)
+        {
+            h += cache->hits ;
+            m += cache->misses ;
+        }
+    }
+    if (nbytes != NULL)
+    {
+        GB_ATOMIC_READ
+        (*nbytes) = GB_pool_nbytes ;
+    }
+    if (hits   != NULL) (*hits  ) = h ;
+    if (misses != NULL) (*misses) = m ;
+}
+
+//------------------------------------------------------------------------------
+// GB_memory_pool_finalize: free the pool, for GrB_finalize
+//------------------------------------------------------------------------------
+
+void GB_memory_pool_finalize (void)
+{
+    GB_memory_pool_flush (true) ;
+    GB_pool_limit = 0 ;
+}
@@ -0,0 +1,35 @@
+//------------------------------------------------------------------------------
+// GB_mm.h: definitions for reading/writing Matrix Market files
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_MM_H
+#define GB_MM_H
+
+GrB_Info GB_mm_read             // read a matrix from a Matrix Market file
+(
+    GrB_Matrix *Chandle,        // output matrix read from the file
+    GrB_Type ctype,             // type of C, or NULL to use the file's type
+    FILE *f,                    // file to read from, already open
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_mm_write            // write a matrix to a Matrix Market file
+(
+    const GrB_Matrix A,         // matrix to write
+    FILE *f,                    // file to write to, already open
+    GB_Werk Werk
+) ;
+
+// size of each chunk of the file, parsed or formatted in parallel
+#define GB_MM_CHUNK (64 * 1024 * 1024)
+
+// maximum length of a header line
+#define GB_MM_LINE 1024
+
+#endif
+
@@ -0,0 +1,591 @@
+//------------------------------------------------------------------------------
+// GB_mm_read: read a matrix from a Matrix Market file, in parallel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Reads a matrix in the Matrix Market coordinate format.  The banner and size
+// lines are read with fgets.  The entries are then read with fread, in chunks
+// of GB_MM_CHUNK bytes, and each chunk is parsed in parallel:  the chunk is cut
+// into ntasks slices at line boundaries, the entries in each slice are counted
+// (phase 1), and then each task parses its own entries directly into the
+// I_work, J_work, and S_work arrays (phase 2), at the position given by the
+// cumulative sum of the counts.  Since the file must be read in order, the
+// partial line at the end of each chunk is moved to the start of the next one.
+// The file can be a pipe, since it is only read sequentially.
+
+// The I_work, J_work, and S_work arrays are passed to GB_builder, which takes
+// ownership of them, so the tuples are never copied.  The indices are checked
+// while parsing, so GB_builder need not check them.  For a symmetric,
+// skew-symmetric, or Hermitian matrix, the kth entry A(i,j) is placed in
+// position k, and its mirror image A(j,i) is placed in position nnz+k.  An
+// entry on the diagonal is thus given twice, with the same value, and the
+// duplicate is discarded by GB_builder.
+
+// The field of the file determines the type of the tuples: GrB_BOOL (pattern,
+// as an iso value), GrB_INT64 (integer), GrB_FP64 (real or double), or GxB_FC64
+// (complex).  This is also the type of C if ctype is NULL.  Otherwise the
+// entries are typecast into ctype, which must be a built-in type.  If an
+// entry appears more than once, the last one is kept.  An integer file read
+// into an unsigned ctype is parsed with strtoull into GrB_UINT64 tuples
+// instead, since strtoll would clamp any value larger than INT64_MAX.
+
+#include "GB_build.h"
+#include "GB_transplant.h"
+#include "GB_iso.h"
+#include "GB_mm.h"
+
+#define GB_MM_PATTERN   0
+#define GB_MM_INTEGER   1
+#define GB_MM_REAL      2
+#define GB_MM_COMPLEX   3
+#define GB_MM_UNSIGNED  4       // integer field, read as uint64_t
+
+#define GB_MM_GENERAL   0
+#define GB_MM_SYMMETRIC 1
+#define GB_MM_SKEW      2
+#define GB_MM_HERMITIAN 3
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&buf, buf_size) ;             \
+    GB_FREE_WORK (&Count, Count_size) ;         \
+    GB_FREE_WORK (&Slice, Slice_size) ;         \
+    GB_FREE (&I_work, I_work_size) ;            \
+    GB_FREE (&J_work, J_work_size) ;            \
+    GB_FREE (&S_work, S_work_size) ;            \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_Matrix_free (&T) ;                       \
+    GB_Matrix_free (&C) ;                       \
+}
+
+//------------------------------------------------------------------------------
+// GB_mm_getline: read a line of the header
+//------------------------------------------------------------------------------
+
+// Any part of the line beyond GB_MM_LINE-1 characters is discarded.
+
+static bool GB_mm_getline (char *line, FILE *f)
+{
+    if (fgets (line, GB_MM_LINE, f) == NULL)
+    {
+        // end of file, or I/O error
+        return (false) ;
+    }
+    size_t len = strlen (line) ;
+    if (len > 0 && line [len-1] != '\n')
+    {
+        // discard the rest of a long line
+        int c ;
+        do
+        {
+            c = fgetc (f) ;
+        }
+        while (c != EOF && c != '\n') ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mm_is_entry: return true if a line holds an entry
+//------------------------------------------------------------------------------
+
+// Blank lines and comment lines may appear anywhere in the file.
+
+static inline bool GB_mm_is_entry (const char *p)
+{
+    while (*p == ' ' || *p == '\t' || *p == '\r')
+    {
+        p++ ;
+    }
+    return (*p != '\n' && *p != '\0' && *p != '%') ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mm_read
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mm_read             // read a matrix from a Matrix Market file
+(
+    GrB_Matrix *Chandle,        // output matrix read from the file
+    GrB_Type ctype,             // type of C, or NULL to use the file's type
+    FILE *f,                    // file to read from, already open
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT (f != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL, T = NULL ;
+    struct GB_Matrix_opaque T_header ;
+    char *buf = NULL ; size_t buf_size = 0 ;
+    int64_t *Count = NULL ; size_t Count_size = 0 ;
+    size_t *Slice = NULL ; size_t Slice_size = 0 ;
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    GB_void *S_work = NULL ; size_t S_work_size = 0 ;
+
+    if (ctype != NULL && ctype->code == GB_UDT_code)
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Type [%s] must be built-in",
+            ctype->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the banner
+    //--------------------------------------------------------------------------
+
+    char line [GB_MM_LINE] ;
+    char token [5][GB_MM_LINE] ;
+    if (!GB_mm_getline (line, f))
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "%s", "Matrix Market file is empty") ;
+    }
+    for (char *p = line ; *p != '\0' ; p++)
+    {
+        // convert the banner to lower case
+        if ((*p) >= 'A' && (*p) <= 'Z') (*p) += ('a' - 'A') ;
+    }
+    if (sscanf (line, "%1023s %1023s %1023s %1023s %1023s", token [0],
+        token [1], token [2], token [3], token [4]) != 5
+        || strcmp (token [0], "%%matrixmarket") != 0
+        || strcmp (token [1], "matrix") != 0)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "%s", "Matrix Market banner invalid") ;
+    }
+
+    if (strcmp (token [2], "coordinate") != 0)
+    {
+        // only the sparse coordinate format is supported
+        GB_ERROR (GrB_NOT_IMPLEMENTED, "Matrix Market format [%s] not "
+            "supported", token [2]) ;
+    }
+
+    int field ;
+    GrB_Type stype ;
+    if (strcmp (token [3], "pattern") == 0)
+    {
+        field = GB_MM_PATTERN ;
+        stype = GrB_BOOL ;
+    }
+    else if (strcmp (token [3], "integer") == 0)
+    {
+        field = GB_MM_INTEGER ;
+        stype = GrB_INT64 ;
+    }
+    else if (strcmp (token [3], "real") == 0 ||
+             strcmp (token [3], "double") == 0)
+    {
+        field = GB_MM_REAL ;
+        stype = GrB_FP64 ;
+    }
+    else if (strcmp (token [3], "complex") == 0)
+    {
+        field = GB_MM_COMPLEX ;
+        stype = GxB_FC64 ;
+    }
+    else
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Matrix Market field [%s] invalid",
+            token [3]) ;
+    }
+
+    int symmetry ;
+    if (strcmp (token [4], "general") == 0)
+    {
+        symmetry = GB_MM_GENERAL ;
+    }
+    else if (strcmp (token [4], "symmetric") == 0)
+    {
+        symmetry = GB_MM_SYMMETRIC ;
+    }
+    else if (strcmp (token [4], "skew-symmetric") == 0)
+    {
+        symmetry = GB_MM_SKEW ;
+    }
+    else if (strcmp (token [4], "hermitian") == 0)
+    {
+        symmetry = (field == GB_MM_COMPLEX) ? GB_MM_HERMITIAN :
+            GB_MM_SYMMETRIC ;
+    }
+    else
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Matrix Market symmetry [%s] invalid",
+            token [4]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read the size line, skipping any comments
+    //--------------------------------------------------------------------------
+
+    int64_t nrows = -1, ncols = -1, nnz = -1 ;
+    while (true)
+    {
+        if (!GB_mm_getline (line, f))
+        {
+            GB_ERROR (GrB_INVALID_VALUE, "%s",
+                "Matrix Market size line missing") ;
+        }
+        if (GB_mm_is_entry (line))
+        {
+            break ;
+        }
+    }
+    if (sscanf (line, "%" SCNd64 " %" SCNd64 " %" SCNd64, &nrows, &ncols,
+        &nnz) != 3 || nrows < 0 || ncols < 0 || nnz < 0
+        || (symmetry != GB_MM_GENERAL && nrows != ncols))
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "%s", "Matrix Market size line invalid") ;
+    }
+
+    bool sym = (symmetry != GB_MM_GENERAL) ;
+    int64_t ntuples = (sym ? 2 : 1) * nnz ;
+    if (ntuples > GB_NMAX)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Problem too large: nvals " GBd
+            " exceeds " GBu, ntuples, GB_NMAX) ;
+    }
+    GBURBLE ("(mm read: %s %s) ", token [3], token [4]) ;
+
+    //--------------------------------------------------------------------------
+    // create the output matrix C
+    //--------------------------------------------------------------------------
+
+    if (ctype == NULL)
+    {
+        ctype = stype ;
+    }
+    else if (field == GB_MM_INTEGER &&
+        (ctype->code == GB_UINT8_code  || ctype->code == GB_UINT16_code ||
+         ctype->code == GB_UINT32_code || ctype->code == GB_UINT64_code))
+    {
+        // read the integers as uint64_t, to keep values above INT64_MAX
+        field = GB_MM_UNSIGNED ;
+        stype = GrB_UINT64 ;
+    }
+    GB_OK (GB_Matrix_new (&C, ctype, nrows, ncols)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int ntasks = (nthreads_max == 1) ? 1 : (4 * nthreads_max) ;
+    size_t ssize = stype->size ;
+    I_work = GB_MALLOC (ntuples, int64_t, &I_work_size) ;
+    J_work = GB_MALLOC (ntuples, int64_t, &J_work_size) ;
+    S_work = GB_MALLOC ((field == GB_MM_PATTERN) ? ssize : (ntuples * ssize),
+        GB_void, &S_work_size) ;
+    Count = GB_MALLOC_WORK (ntasks + 1, int64_t, &Count_size) ;
+    Slice = GB_MALLOC_WORK (ntasks + 1, size_t, &Slice_size) ;
+    buf = GB_MALLOC_WORK (GB_MM_CHUNK + 1, char, &buf_size) ;
+    if (I_work == NULL || J_work == NULL || S_work == NULL || Count == NULL
+        || Slice == NULL || buf == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    if (field == GB_MM_PATTERN)
+    {
+        // the values of a pattern matrix are iso
+        S_work [0] = 1 ;
+    }
+    int64_t  *Sx_int  = (int64_t  *) S_work ;
+    uint64_t *Sx_uint = (uint64_t *) S_work ;
+    double   *Sx_dbl  = (double   *) S_work ;
+
+    //--------------------------------------------------------------------------
+    // read and parse the entries, one chunk at a time
+    //--------------------------------------------------------------------------
+
+    int64_t nread = 0 ;         // # of entries parsed so far
+    size_t carry = 0 ;          // # of bytes carried over from the last chunk
+    bool eof = false ;
+    while (!eof)
+    {
+
+        //----------------------------------------------------------------------
+        // read the next chunk, and trim it to the last complete line
+        //----------------------------------------------------------------------
+
+        size_t nget = GB_MM_CHUNK - carry ;
+        size_t len = carry + fread (buf + carry, 1, nget, f) ;
+        eof = (len < GB_MM_CHUNK) ;
+        if (eof && ferror (f))
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_INVALID_VALUE, "%s", "Matrix Market read error") ;
+        }
+        size_t end = len ;
+        if (eof)
+        {
+            // terminate the last line of the file, if needed
+            if (end > 0 && buf [end-1] != '\n')
+            {
+                buf [end++] = '\n' ;
+            }
+        }
+        else
+        {
+            while (end > 0 && buf [end-1] != '\n')
+            {
+                end-- ;
+            }
+            if (end == 0)
+            {
+                // a single line fills the whole chunk
+                GB_FREE_ALL ;
+                GB_ERROR (GrB_INVALID_VALUE, "%s",
+                    "Matrix Market line too long") ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // slice the chunk at line boundaries
+        //----------------------------------------------------------------------
+
+        Slice [0] = 0 ;
+        for (int tid = 1 ; tid < ntasks ; tid++)
+        {
+            size_t p = GB_IMAX (Slice [tid-1], (tid * end) / ntasks) ;
+            while (p > 0 && p < end && buf [p-1] != '\n')
+            {
+                p++ ;
+            }
+            Slice [tid] = p ;
+        }
+        Slice [ntasks] = end ;
+
+        //----------------------------------------------------------------------
+        // phase 1: count the entries in each slice
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_IMIN (nthreads_max, ntasks) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t n = 0 ;
+            size_t p = Slice [tid] ;
+            while (p < Slice [tid+1])
+            {
+                if (GB_mm_is_entry (buf + p)) n++ ;
+                char *eol = memchr (buf + p, '\n', Slice [tid+1] - p) ;
+                p = (eol - buf) + 1 ;
+            }
+            Count [tid] = n ;
+        }
+
+        GB_cumsum (Count, ntasks, NULL, 1, Werk) ;
+        if (nread + Count [ntasks] > nnz)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_INVALID_VALUE, "Matrix Market file has more than "
+                GBd " entries", nnz) ;
+        }
+
+        //----------------------------------------------------------------------
+        // phase 2: parse the entries in each slice
+        //----------------------------------------------------------------------
+
+        bool ok = true ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+            reduction(&&:ok)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t k = nread + Count [tid] ;
+            size_t p = Slice [tid] ;
+            while (p < Slice [tid+1])
+            {
+                // terminate this line, so that no token crosses into the next
+                char *eol = memchr (buf + p, '\n', Slice [tid+1] - p) ;
+                (*eol) = '\0' ;
+                char *q = buf + p ;
+                p = (eol - buf) + 1 ;
+                if (!GB_mm_is_entry (q)) continue ;
+
+                // get the row and column indices
+                char *e ;
+                int64_t i = strtoll (q, &e, 10) ;
+                bool ok_entry = (e != q) ;
+                q = e ;
+                int64_t j = strtoll (q, &e, 10) ;
+                ok_entry = ok_entry && (e != q) &&
+                    (i >= 1 && i <= nrows && j >= 1 && j <= ncols) ;
+                q = e ;
+                I_work [k] = i - 1 ;
+                J_work [k] = j - 1 ;
+                int64_t kmirror = nnz + k ;
+                bool diag = (i == j) ;
+                if (sym)
+                {
+                    I_work [kmirror] = j - 1 ;
+                    J_work [kmirror] = i - 1 ;
+                }
+
+                // get the value
+                switch (field)
+                {
+                    case GB_MM_INTEGER :
+                    {
+                        int64_t x = strtoll (q, &e, 10) ;
+                        ok_entry = ok_entry && (e != q) ;
+                        Sx_int [k] = x ;
+                        if (sym)
+                        {
+                            bool neg = (symmetry == GB_MM_SKEW && !diag) ;
+                            Sx_int [kmirror] = neg ? (-x) : x ;
+                        }
+                    }
+                    break ;
+
+                    case GB_MM_UNSIGNED :
+                    {
+                        uint64_t x = strtoull (q, &e, 10) ;
+                        ok_entry = ok_entry && (e != q) ;
+                        Sx_uint [k] = x ;
+                        if (sym)
+                        {
+                            bool neg = (symmetry == GB_MM_SKEW && !diag) ;
+                            Sx_uint [kmirror] = neg ? (-x) : x ;
+                        }
+                    }
+                    break ;
+
+                    case GB_MM_REAL :
+                    {
+                        double x = strtod (q, &e) ;
+                        ok_entry = ok_entry && (e != q) ;
+                        Sx_dbl [k] = x ;
+                        if (sym)
+                        {
+                            bool neg = (symmetry == GB_MM_SKEW && !diag) ;
+                            Sx_dbl [kmirror] = neg ? (-x) : x ;
+                        }
+                    }
+                    break ;
+
+                    case GB_MM_COMPLEX :
+                    {
+                        double xr = strtod (q, &e) ;
+                        ok_entry = ok_entry && (e != q) ;
+                        q = e ;
+                        double xi = strtod (q, &e) ;
+                        ok_entry = ok_entry && (e != q) ;
+                        Sx_dbl [2*k  ] = xr ;
+                        Sx_dbl [2*k+1] = xi ;
+                        if (sym)
+                        {
+                            bool neg = (symmetry == GB_MM_SKEW && !diag) ;
+                            bool conj = (symmetry == GB_MM_HERMITIAN && !diag);
+                            Sx_dbl [2*kmirror  ] = neg ? (-xr) : xr ;
+                            Sx_dbl [2*kmirror+1] = (neg || conj) ? (-xi) : xi ;
+                        }
+                    }
+                    break ;
+
+                    default : ;
+                }
+                ok = ok && ok_entry ;
+                k++ ;
+            }
+        }
+
+        if (!ok)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_INVALID_VALUE, "%s",
+                "Matrix Market file has an invalid entry") ;
+        }
+        nread += Count [ntasks] ;
+
+        //----------------------------------------------------------------------
+        // move the partial line at the end of the chunk to the start
+        //----------------------------------------------------------------------
+
+        carry = eof ? 0 : (len - end) ;
+        if (carry > 0)
+        {
+            memmove (buf, buf + end, carry) ;
+        }
+    }
+
+    if (nread != nnz)
+    {
+        GB_FREE_ALL ;
+        GB_ERROR (GrB_INVALID_VALUE, "Matrix Market file has " GBd
+            " entries, not " GBd, nread, nnz) ;
+    }
+    GB_FREE_WORK (&buf, buf_size) ;
+
+    //--------------------------------------------------------------------------
+    // build T from the tuples, transplanting I_work, J_work, and S_work
+    //--------------------------------------------------------------------------
+
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    bool is_csc = C->is_csc ;
+    GB_OK (GB_builder (
+        T,              // create T using a static header
+        stype,          // the type of T
+        C->vlen,        // T->vlen = C->vlen
+        C->vdim,        // T->vdim = C->vdim
+        is_csc,         // T has the same CSR/CSC format as C
+        is_csc ? (&I_work) : (&J_work),     // indices within each vector
+        is_csc ? (&I_work_size) : (&J_work_size),
+        is_csc ? (&J_work) : (&I_work),     // vector indices
+        is_csc ? (&J_work_size) : (&I_work_size),
+        &S_work,        // values, transplanted into T->x if possible
+        &S_work_size,
+        false,          // known_sorted: not yet known
+        false,          // known_no_duplicates: not yet known
+        ntuples,        // size of I_work, J_work, and S_work
+        true,           // T is a GrB_Matrix
+        NULL,           // no I_input
+        NULL,           // no J_input
+        NULL,           // no S_input
+        field == GB_MM_PATTERN,     // S_work is iso for a pattern matrix
+        ntuples,        // number of tuples
+        NULL,           // keep the last duplicate, if any
+        stype,          // type of the S_work array
+        true,           // burble is OK
+        Werk
+    )) ;
+
+    //--------------------------------------------------------------------------
+    // determine if T is iso
+    //--------------------------------------------------------------------------
+
+    if (!T->iso && GB_check_if_iso (T))
+    {
+        // All entries in T are the same; convert T to iso
+        GBURBLE ("(post iso) ") ;
+        T->iso = true ;
+        GB_OK (GB_convert_any_to_iso (T, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // transplant and typecast T into C, conform C, and free T
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_transplant_conform (C, C->type, &T, Werk)) ;
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C read from Matrix Market file", GB0) ;
+    (*Chandle) = C ;
+    return (GrB_SUCCESS) ;
+}
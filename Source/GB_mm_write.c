@@ -0,0 +1,284 @@
+//------------------------------------------------------------------------------
+// GB_mm_write: write a matrix to a Matrix Market file, in parallel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Writes a matrix in the Matrix Market coordinate general format.  The entries
+// of A are formatted in batches of GB_MM_CHUNK / GB_MM_ENTRY entries.  Each
+// batch is split into ntasks slices, and each task formats its entries into
+// its own part of a single buffer, using at most GB_MM_ENTRY bytes per entry.
+// The parts are then written to the file in order, with fwrite.  The entries
+// are read directly from A, in any sparsity format, with no copy of its
+// tuples.  Boolean and integer matrices are written with the integer field,
+// floating-point matrices with the real field, and complex matrices with the
+// complex field.  The values are written with enough digits to be read back
+// exactly.
+
+#include "GB.h"
+#include "GB_mm.h"
+#include "GB_search_for_vector_template.c"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&buf, buf_size) ;             \
+    GB_FREE_WORK (&Len, Len_size) ;             \
+}
+
+// maximum # of bytes for a single entry
+#define GB_MM_ENTRY 128
+
+//------------------------------------------------------------------------------
+// GB_mm_format: format a single entry
+//------------------------------------------------------------------------------
+
+static inline size_t GB_mm_format
+(
+    char *out,                  // output buffer of size GB_MM_ENTRY
+    int64_t i,                  // 1-based row index
+    int64_t j,                  // 1-based column index
+    const GB_void *x,           // value of the entry
+    GB_Type_code code           // type of the entry
+)
+{
+    int n = 0 ;
+    switch (code)
+    {
+        case GB_BOOL_code   :
+        case GB_INT8_code   :
+        case GB_INT16_code  :
+        case GB_INT32_code  :
+        case GB_INT64_code  :
+        {
+            int64_t v = 0 ;
+            switch (code)
+            {
+                case GB_BOOL_code   : v = *((const bool    *) x) ; break ;
+                case GB_INT8_code   : v = *((const int8_t  *) x) ; break ;
+                case GB_INT16_code  : v = *((const int16_t *) x) ; break ;
+                case GB_INT32_code  : v = *((const int32_t *) x) ; break ;
+                default             : v = *((const int64_t *) x) ; break ;
+            }
+            n = snprintf (out, GB_MM_ENTRY, "%" PRId64 " %" PRId64
+                " %" PRId64 "\n", i, j, v) ;
+        }
+        break ;
+
+        case GB_UINT8_code  :
+        case GB_UINT16_code :
+        case GB_UINT32_code :
+        case GB_UINT64_code :
+        {
+            uint64_t v = 0 ;
+            switch (code)
+            {
+                case GB_UINT8_code  : v = *((const uint8_t  *) x) ; break ;
+                case GB_UINT16_code : v = *((const uint16_t *) x) ; break ;
+                case GB_UINT32_code : v = *((const uint32_t *) x) ; break ;
+                default             : v = *((const uint64_t *) x) ; break ;
+            }
+            n = snprintf (out, GB_MM_ENTRY, "%" PRId64 " %" PRId64
+                " %" PRIu64 "\n", i, j, v) ;
+        }
+        break ;
+
+        case GB_FP32_code   :
+            n = snprintf (out, GB_MM_ENTRY, "%" PRId64 " %" PRId64
+                " %.9g\n", i, j, (double) *((const float *) x)) ;
+            break ;
+
+        case GB_FP64_code   :
+            n = snprintf (out, GB_MM_ENTRY, "%" PRId64 " %" PRId64
+                " %.17g\n", i, j, *((const double *) x)) ;
+            break ;
+
+        case GB_FC32_code   :
+        {
+            float v [2] ;
+            memcpy (v, x, 2 * sizeof (float)) ;
+            n = snprintf (out, GB_MM_ENTRY, "%" PRId64 " %" PRId64
+                " %.9g %.9g\n", i, j, (double) v [0], (double) v [1]) ;
+        }
+        break ;
+
+        case GB_FC64_code   :
+        {
+            double v [2] ;
+            memcpy (v, x, 2 * sizeof (double)) ;
+            n = snprintf (out, GB_MM_ENTRY, "%" PRId64 " %" PRId64
+                " %.17g %.17g\n", i, j, v [0], v [1]) ;
+        }
+        break ;
+
+        default : ;
+    }
+    return ((n < 0) ? 0 : GB_IMIN (n, GB_MM_ENTRY - 1)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mm_write
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mm_write            // write a matrix to a Matrix Market file
+(
+    const GrB_Matrix A,         // matrix to write
+    FILE *f,                    // file to write to, already open
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (f != NULL) ;
+    char *buf = NULL ; size_t buf_size = 0 ;
+    int64_t *Len = NULL ; size_t Len_size = 0 ;
+
+    GB_Type_code code = A->type->code ;
+    if (code == GB_UDT_code)
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Type [%s] must be built-in",
+            A->type->name) ;
+    }
+
+    // ensure all pending work is finished
+    GB_OK (GB_wait (A, "A to write", Werk)) ;
+    ASSERT_MATRIX_OK (A, "A to write to Matrix Market file", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // write the banner and size line
+    //--------------------------------------------------------------------------
+
+    const char *field = "integer" ;
+    if (code == GB_FP32_code || code == GB_FP64_code)
+    {
+        field = "real" ;
+    }
+    else if (code == GB_FC32_code || code == GB_FC64_code)
+    {
+        field = "complex" ;
+    }
+
+    int64_t nrows = GB_NROWS (A) ;
+    int64_t ncols = GB_NCOLS (A) ;
+    int64_t nvals = GB_nnz (A) ;
+    GBURBLE ("(mm write: %s) ", field) ;
+    if (fprintf (f, "%%%%MatrixMarket matrix coordinate %s general\n"
+        "%" PRId64 " %" PRId64 " %" PRId64 "\n", field, nrows, ncols,
+        nvals) < 0)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "%s", "Matrix Market write error") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the content of A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+    const bool A_iso = A->iso ;
+    const bool is_csc = A->is_csc ;
+    const size_t asize = A->type->size ;
+    const int64_t anz_held = GB_nnz_held (A) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int ntasks = (nthreads_max == 1) ? 1 : (4 * nthreads_max) ;
+    int64_t batch = GB_MM_CHUNK / GB_MM_ENTRY ;
+    buf = GB_MALLOC_WORK (GB_MM_CHUNK, char, &buf_size) ;
+    Len = GB_MALLOC_WORK (ntasks, int64_t, &Len_size) ;
+    if (buf == NULL || Len == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // format and write the entries, one batch at a time
+    //--------------------------------------------------------------------------
+
+    for (int64_t p1 = 0 ; p1 < anz_held ; p1 += batch)
+    {
+
+        //----------------------------------------------------------------------
+        // format the entries A [p1:p2-1] in parallel
+        //----------------------------------------------------------------------
+
+        int64_t p2 = GB_IMIN (p1 + batch, anz_held) ;
+        int64_t bnz = p2 - p1 ;
+        int nthreads = GB_IMIN (nthreads_max, ntasks) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t pstart, pend ;
+            GB_PARTITION (pstart, pend, bnz, tid, ntasks) ;
+            char *out = buf + pstart * GB_MM_ENTRY ;
+            pstart += p1 ;
+            pend += p1 ;
+            size_t len = 0 ;
+            int64_t k = (pstart < pend) ?
+                GB_search_for_vector (pstart, Ap, 0, anvec, avlen) : 0 ;
+            for (int64_t p = pstart ; p < pend ; p++)
+            {
+                if (!GBB (Ab, p)) continue ;
+                if (Ap == NULL)
+                {
+                    // A is bitmap or full
+                    k = p / avlen ;
+                }
+                else
+                {
+                    // A is sparse or hypersparse
+                    while (Ap [k+1] <= p) k++ ;
+                }
+                int64_t i = GBI (Ai, p, avlen) ;
+                int64_t j = GBH (Ah, k) ;
+                len += GB_mm_format (out + len,
+                    (is_csc ? i : j) + 1, (is_csc ? j : i) + 1,
+                    Ax + (A_iso ? 0 : (p * asize)), code) ;
+            }
+            Len [tid] = len ;
+        }
+
+        //----------------------------------------------------------------------
+        // write each part of the buffer, in order
+        //----------------------------------------------------------------------
+
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t pstart = GB_PART (tid, bnz, ntasks) ;
+            char *out = buf + pstart * GB_MM_ENTRY ;
+            size_t len = (size_t) Len [tid] ;
+            if (len > 0 && fwrite (out, 1, len, f) != len)
+            {
+                GB_FREE_ALL ;
+                GB_ERROR (GrB_INVALID_VALUE, "%s",
+                    "Matrix Market write error") ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
@@ -117,6 +117,7 @@ bool GB_AxB_semiring_builtin        // true if semiring is builtin
 GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 (
     GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C_in,                // if present, compute C_in+=A'*B in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M_in,          // mask matrix for C<!M>=A'*B, may be NULL
@@ -158,6 +159,9 @@ GrB_Info GB_AxB_dot3_slice
     int *p_nthreads,                // # of threads to use
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix, C has the same pattern
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
     GB_Werk Werk
 ) ;
 
@@ -184,6 +188,17 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_AxB_outer               // C+=A*B', outer-product method
+(
+    GrB_Matrix C,                   // input/output matrix, must be full
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C+=A*B'
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    bool *done_in_place,            // if true, C has been computed
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_bitmap_expand_to_hyper
 (
     // input/output:
@@ -224,6 +239,57 @@ static inline bool GB_AxB_dot4_control
         && (C_in->type == accum->ztype)) ;  // ctype must match ztype
 }
 
+//------------------------------------------------------------------------------
+// GB_AxB_outer_control: determine if the outer-product method should be used
+//------------------------------------------------------------------------------
+
+// C += A*B' where C is modified in-place, and A and B are sparse or
+// hypersparse.  The same conditions on C, M, and accum as dot4 apply.
+
+static inline bool GB_AxB_outer_control
+(
+    const bool C_out_iso,       // true if C is iso on output; must be false
+    const GrB_Matrix C_in,      // must be present and as-if-full
+    const GrB_Matrix M,         // must be NULL
+    const GrB_BinaryOp accum,   // accum must match the monoid
+    const GrB_Matrix A,         // must be sparse or hypersparse
+    const GrB_Matrix B,         // must be sparse or hypersparse
+    const GrB_Semiring semiring
+)
+{
+    return (GB_AxB_dot4_control (C_out_iso, C_in, M, false, accum, semiring)
+        && (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        && (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B))
+        && semiring->add->op->opcode != GB_ANY_binop_code) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_bitmap_in_place_control: determine if a bitmap C can be done in-place
+//------------------------------------------------------------------------------
+
+// C<#M> += A*B or C<#M> += A'*B where C is bitmap, and modified in-place by
+// GB_AxB_saxbit or GB_AxB_dot2.  Entries already present in C are combined
+// with the new results via the monoid, and new entries are added to the bitmap
+// of C.  If C is full on input, it is first converted to bitmap.  GB_AxB_meta
+// has already checked that the mask (if present) can be applied in-place
+// (C_replace is false).  GB_AxB_dot2 also requires M to be NULL.
+
+static inline bool GB_AxB_bitmap_in_place_control
+(
+    const bool C_out_iso,       // true if C is iso on output; must be false
+    const GrB_Matrix C_in,      // must be present, and bitmap or full
+    const GrB_BinaryOp accum,   // accum must match the monoid
+    const GrB_Semiring semiring
+)
+{
+    return (!C_out_iso                  // C must not be iso on output
+        && (GB_IS_BITMAP (C_in) || GB_IS_FULL (C_in))
+        && (accum != NULL)              // accum must be present
+        && (accum == semiring->add->op)     // accum must match the monoid
+        && (C_in->type == accum->ztype)     // ctype must match ztype
+        && semiring->add->op->opcode != GB_ANY_binop_code) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_dot3_control: determine if the dot3 method should be used
 //------------------------------------------------------------------------------
@@ -298,6 +364,7 @@ void GB_AxB_meta_adotb_control
 #define GB_USE_COLSCALE 1
 #define GB_USE_DOT      2
 #define GB_USE_SAXPY    3
+#define GB_USE_OUTER    4
 
 #endif
 
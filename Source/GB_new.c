@@ -159,6 +159,8 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->p = NULL ; A->p_shallow = false ; A->p_size = 0 ;
     A->h = NULL ; A->h_shallow = false ; A->h_size = 0 ;
     A->Y = NULL ; A->Y_shallow = false ;
+    A->saxpy3_schedule = NULL ;
+    A->ek_slice_cache = NULL ;
     A->b = NULL ; A->b_shallow = false ; A->b_size = 0 ;
     A->i = NULL ; A->i_shallow = false ; A->i_size = 0 ;
     A->x = NULL ; A->x_shallow = false ; A->x_size = 0 ;
@@ -168,6 +170,7 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->jumbled = false ;
     A->Pending = NULL ;
     A->iso = false ;            // OK: if iso, burble in the caller
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // Allocate A->p and A->h if requested
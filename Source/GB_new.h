@@ -83,6 +83,22 @@ void GB_hyper_hash_free         // free the A->Y hyper_hash of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_AxB_saxpy3_schedule_free    // free A->saxpy3_schedule of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+) ;
+
+void GB_ek_slice_cache_free     // free A->ek_slice_cache of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+) ;
+
+// GB_PATTERN_CHANGED: give A a new A->pattern_version
+#define GB_PATTERN_CHANGED(A)                                       \
+{                                                                   \
+    (A)->pattern_version = GB_Global_pattern_version_next ( ) ;     \
+}
+
 void GB_phybix_free             // free all content of a matrix
 (
     GrB_Matrix A                // matrix with content to free
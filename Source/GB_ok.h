@@ -107,6 +107,10 @@
         fast_import = false ;                                               \
     }
 
+#define GB_GET_DESCRIPTOR_DESERIALIZE(desc,shallow)                         \
+    /* default is to copy the blob into the deserialized matrix */          \
+    bool shallow = (desc != NULL && desc->shallow_deserialize) ;
+
 //------------------------------------------------------------------------------
 // GB_VECTOR_OK, GB_SCALAR_OK: check if typecast from GrB_Matrix is OK
 //------------------------------------------------------------------------------
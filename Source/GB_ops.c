@@ -79,7 +79,8 @@ GB_TYPEDEF (GxB, FC64  , GxB_FC64_t, "GxB_FC64_t") ;
         o,                          /* default: axb */                      \
         0,                          /* default compression */               \
         0,                          /* no sort */                           \
-        0                           /* import */                            \
+        0,                          /* import */                            \
+        false                       /* no shallow deserialize */            \
     } ;                                                                     \
     GrB_Descriptor GRB (DESC_ ## name) = & GB_OPAQUE (desc_ ## name) ;
 
@@ -1026,6 +1027,10 @@ struct GB_Context_opaque GB_OPAQUE (CONTEXT_WORLD) =
     (double) GB_CHUNK_DEFAULT,      // chunk
     1,                              // nthreads_max
     -1,                             // gpu_id
+    NULL, 0, 0,                     // no Werk arena yet
+    GB_WERK_ARENA_DEFAULT,          // werk_arena_max
+    0,                              // werk_arena_busy
+    NULL,                           // werk_arena_owner
 } ;
 
 GxB_Context GxB_CONTEXT_WORLD = & GB_OPAQUE (CONTEXT_WORLD) ;
@@ -56,6 +56,9 @@ void GB_phy_free                // free A->p, A->h, and A->Y of a matrix
     A->nvec_nonempty = 0 ;
 
     GB_hyper_hash_free (A) ;
+    GB_AxB_saxpy3_schedule_free (A) ;
+    GB_ek_slice_cache_free (A) ;
+    GB_PATTERN_CHANGED (A) ;
 
     //--------------------------------------------------------------------------
     // set the status to invalid
@@ -0,0 +1,332 @@
+//------------------------------------------------------------------------------
+// GB_radix_sort: sort (j,i,k) or (i,k) tuples with a parallel radix sort
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A parallel least-significant-digit radix sort, used by GB_builder as an
+// alternative to GB_msort_[123].  The row index i (in the range 0 to 2^ibits
+// - 1) and the column index j (in the range 0 to 2^jbits - 1) are packed into
+// a single 64-bit key, (j << ibits) | i, held in the I array during the sort.
+// The key is then sorted GB_RADIX_BITS bits at a time.  Each pass is stable,
+// so the optional K array (with K [k] = k on input) is permuted exactly as
+// GB_msort_3 or GB_msort_2 would, and the results of the two methods are
+// identical.
+
+// Each pass takes O(n/p) time per thread, with ceil ((ibits+jbits)/8) passes
+// in total.  Passes whose digit is the same for all keys are skipped.  The J
+// array (if present) is used as the workspace for the keys; otherwise
+// workspace of size n is allocated for the keys.  If K is present, another
+// workspace of size n is allocated for it.
+
+#include "GB_sort.h"
+
+#define GB_RADIX_BITS 8
+#define GB_RADIX (1 << GB_RADIX_BITS)
+#define GB_DIGIT(key) (((key) >> shift) & (GB_RADIX-1))
+
+// GB_RADIX_SORT_MIN: smallest problem for which the radix sort is considered
+#define GB_RADIX_SORT_MIN (64 * 1024)
+
+#undef  GB_FREE_ALL
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&Count, Count_size) ;     \
+    GB_FREE_WORK (&Key2, Key2_size) ;       \
+    GB_FREE_WORK (&K2, K2_size) ;           \
+}
+
+//------------------------------------------------------------------------------
+// GB_radix_sort_select: determine if the radix sort should be used
+//------------------------------------------------------------------------------
+
+// Returns true if GB_builder should use GB_radix_sort, and the # of bits
+// required to hold the row and column indices.  The decision can be forced by
+// GB_Global_sort_set, for testing and benchmarking: 0 selects the method
+// automatically (the default), 1 always uses the merge sort, and 2 uses the
+// radix sort whenever the packed (j,i) keys fit in 64 bits.
+
+bool GB_radix_sort_select       // true if the radix sort should be used
+(
+    // output:
+    int *ibits,                 // # of bits for the row indices
+    int *jbits,                 // # of bits for the column indices
+    // input:
+    const int64_t n,            // # of tuples to sort
+    const int64_t vlen,         // row indices are in range 0:vlen-1
+    const int64_t vdim          // column indices are in range 0:vdim-1
+)
+{
+
+    //--------------------------------------------------------------------------
+    // find the # of bits in the row and column indices
+    //--------------------------------------------------------------------------
+
+    int ib = 0 ;
+    while (ib < 64 && (((int64_t) 1) << ib) < vlen) ib++ ;
+    int jb = 0 ;
+    while (jb < 64 && (((int64_t) 1) << jb) < vdim) jb++ ;
+    (*ibits) = ib ;
+    (*jbits) = jb ;
+
+    //--------------------------------------------------------------------------
+    // select the method
+    //--------------------------------------------------------------------------
+
+    int method = GB_Global_sort_get ( ) ;
+    int nbits = ib + jb ;
+    if (method == 1 || nbits > 64 || n <= 1)
+    {
+        // use the merge sort
+        return (false) ;
+    }
+    if (method == 2)
+    {
+        // use the radix sort since the keys fit in 64 bits
+        return (true) ;
+    }
+
+    // The merge sort takes O(log2(n)) passes over the data (counting the
+    // qsort at the leaves); the radix sort takes one pass to pack the keys,
+    // one to unpack them, and two passes (count and scatter) per digit.  The
+    // scatter has a poor memory access pattern, so the radix sort is only
+    // used when it takes no more than about half the passes of the merge
+    // sort, and when the problem is large enough to amortize the workspace.
+    int npasses = (nbits + GB_RADIX_BITS - 1) / GB_RADIX_BITS ;
+    int logn = 0 ;
+    while (logn < 63 && (((int64_t) 1) << logn) < n) logn++ ;
+    return (n >= GB_RADIX_SORT_MIN && 4 * npasses + 2 <= logn) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_radix_sort
+//------------------------------------------------------------------------------
+
+GrB_Info GB_radix_sort      // sort (J,I,K) or (I,K) tuples
+(
+    int64_t *restrict I,    // size n array of row indices, 0 to 2^ibits-1
+    int64_t *restrict J,    // size n array of column indices, 0 to
+                            // 2^jbits-1, or NULL if only (I,K) is sorted
+    int64_t *restrict K,    // size n array, or NULL if not present
+    const int64_t n,
+    const int ibits,        // # of bits in the row indices
+    const int jbits,        // # of bits in the column indices
+    int nthreads            // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (I != NULL) ;
+    ASSERT (ibits >= 0 && jbits >= 0) ;
+    ASSERT (ibits + ((J == NULL) ? 0 : jbits) <= 64) ;
+
+    int64_t *restrict Count = NULL ; size_t Count_size = 0 ;
+    int64_t *restrict Key2  = NULL ; size_t Key2_size  = 0 ;
+    int64_t *restrict K2    = NULL ; size_t K2_size    = 0 ;
+
+    if (n <= 1)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    int nbits = ibits + ((J == NULL) ? 0 : jbits) ;
+    int npasses = (nbits + GB_RADIX_BITS - 1) / GB_RADIX_BITS ;
+    nthreads = GB_IMIN (nthreads, (int) GB_IMAX (1, n / GB_RADIX)) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+    int ntasks = nthreads ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    Count = GB_MALLOC_WORK (ntasks * GB_RADIX, int64_t, &Count_size) ;
+    if (J == NULL)
+    {
+        Key2 = GB_MALLOC_WORK (n, int64_t, &Key2_size) ;
+    }
+    if (K != NULL)
+    {
+        K2 = GB_MALLOC_WORK (n, int64_t, &K2_size) ;
+    }
+    if (Count == NULL || (J == NULL && Key2 == NULL)
+        || (K != NULL && K2 == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the (j,i) pairs into a single key
+    //--------------------------------------------------------------------------
+
+    // The keys are held in X, and Y is used as workspace for each pass.
+    uint64_t *X = (uint64_t *) I ;
+    uint64_t *Y = (uint64_t *) ((J == NULL) ? Key2 : J) ;
+    int64_t *KX = K ;
+    int64_t *KY = K2 ;
+    int64_t k ;
+
+    if (J != NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            X [k] = (((uint64_t) J [k]) << ibits) | ((uint64_t) I [k]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the keys, GB_RADIX_BITS bits at a time
+    //--------------------------------------------------------------------------
+
+    for (int pass = 0 ; pass < npasses ; pass++)
+    {
+
+        //----------------------------------------------------------------------
+        // count the digits in each task
+        //----------------------------------------------------------------------
+
+        const int shift = pass * GB_RADIX_BITS ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t *restrict Count_task = Count + tid * GB_RADIX ;
+            memset (Count_task, 0, GB_RADIX * sizeof (int64_t)) ;
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, tid, ntasks) ;
+            for (int64_t p = kstart ; p < kend ; p++)
+            {
+                Count_task [GB_DIGIT (X [p])]++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // skip this pass if all the keys have the same digit
+        //----------------------------------------------------------------------
+
+        int64_t d0 = GB_DIGIT (X [0]) ;
+        int64_t n0 = 0 ;
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            n0 += Count [tid * GB_RADIX + d0] ;
+        }
+        if (n0 == n)
+        {
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // cumulative sum of the counts, in order of digit then task
+        //----------------------------------------------------------------------
+
+        int64_t s = 0 ;
+        for (int d = 0 ; d < GB_RADIX ; d++)
+        {
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t c = Count [tid * GB_RADIX + d] ;
+                Count [tid * GB_RADIX + d] = s ;
+                s += c ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // scatter the keys (and K) into their buckets
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t *restrict Count_task = Count + tid * GB_RADIX ;
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, n, tid, ntasks) ;
+            if (KX == NULL)
+            {
+                for (int64_t p = kstart ; p < kend ; p++)
+                {
+                    uint64_t key = X [p] ;
+                    int64_t pdest = Count_task [GB_DIGIT (key)]++ ;
+                    Y [pdest] = key ;
+                }
+            }
+            else
+            {
+                for (int64_t p = kstart ; p < kend ; p++)
+                {
+                    uint64_t key = X [p] ;
+                    int64_t pdest = Count_task [GB_DIGIT (key)]++ ;
+                    Y [pdest] = key ;
+                    KY [pdest] = KX [p] ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // swap the keys and workspace for the next pass
+        //----------------------------------------------------------------------
+
+        uint64_t *T = X ; X = Y ; Y = T ;
+        int64_t *KT = KX ; KX = KY ; KY = KT ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the keys back into I and J
+    //--------------------------------------------------------------------------
+
+    const uint64_t imask = (ibits >= 64) ? UINT64_MAX :
+        ((((uint64_t) 1) << ibits) - 1) ;
+
+    if (X == (uint64_t *) I)
+    {
+        // the sorted keys are in I
+        if (J != NULL)
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < n ; k++)
+            {
+                uint64_t key = X [k] ;
+                J [k] = (int64_t) (key >> ibits) ;
+                I [k] = (int64_t) (key & imask) ;
+            }
+        }
+    }
+    else if (J != NULL)
+    {
+        // the sorted keys are in J
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            uint64_t key = X [k] ;
+            I [k] = (int64_t) (key & imask) ;
+            J [k] = (int64_t) (key >> ibits) ;
+        }
+    }
+    else
+    {
+        // the sorted keys are in Key2
+        GB_memcpy (I, Key2, n * sizeof (int64_t), nthreads) ;
+    }
+
+    if (KX != K)
+    {
+        // the permuted K is in K2
+        GB_memcpy (K, K2, n * sizeof (int64_t), nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
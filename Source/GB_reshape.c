@@ -209,6 +209,9 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
             // Remove T->i and T->x from T; these become I_work and S_work
             //------------------------------------------------------------------
 
+            // T is modified in place, so it cannot have shallow components
+            GB_OK (GB_unshallow (T)) ;
+
             // remove T->i from T; it becomes I_work
             I_work = T->i ; I_work_size = T->i_size ;
             T->i = NULL   ; T->i_size = 0 ;
@@ -65,6 +65,9 @@ GrB_Info GB_resize              // change the size of a matrix
         return (GrB_SUCCESS) ;
     }
 
+    // A is modified in place, so it cannot have any shallow components
+    GB_OK (GB_unshallow (A)) ;
+
     //--------------------------------------------------------------------------
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
@@ -251,6 +254,7 @@ GrB_Info GB_resize              // change the size of a matrix
 
         // A->Y will be invalidated, so free it
         GB_hyper_hash_free (A) ;
+        GB_PATTERN_CHANGED (A) ;
 
         // resize the number of sparse vectors
         int64_t *restrict Ah = A->h ;
@@ -292,7 +296,8 @@ GrB_Info GB_resize              // change the size of a matrix
             struct GB_Scalar_opaque Thunk_header ;
             int64_t k = vlen_new - 1 ;
             GrB_Scalar Thunk = GB_Scalar_wrap (&Thunk_header, GrB_INT64, &k) ;
-            GB_OK (GB_selector (NULL, GrB_ROWLE, false, A, Thunk, Werk)) ;
+            GB_OK (GB_selector (NULL, GrB_ROWLE, false, A, Thunk, NULL,
+                false, false, Werk)) ;
         }
 
         //----------------------------------------------------------------------
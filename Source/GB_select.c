@@ -383,8 +383,11 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     }
     else
     { 
-        // T = select (A, Thunk)
-        GB_OK (GB_selector (T, op, flipij, A, Thunk2, Werk)) ;
+        // T = select (A, Thunk), which may exploit the mask M if T, M, and C
+        // all have the same CSR/CSC format
+        bool use_mask = (M != NULL && M->is_csc == A_csc && C->is_csc == A_csc);
+        GB_OK (GB_selector (T, op, flipij, A, Thunk2, use_mask ? M : NULL,
+            Mask_comp, Mask_struct, Werk)) ;
     }
 
     T->is_csc = A_csc ;
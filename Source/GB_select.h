@@ -34,6 +34,9 @@ GrB_Info GB_selector
     const bool flipij,          // if true, flip i and j for user operator
     GrB_Matrix A,               // input matrix
     const GrB_Scalar Thunk,
+    const GrB_Matrix M,         // optional mask for C, may be NULL
+    const bool Mask_comp,       // if true, use !M
+    const bool Mask_struct,     // if true, use the only structure of M
     GB_Werk Werk
 ) ;
 
@@ -84,6 +87,22 @@ GrB_Info GB_select_bitmap
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_select_masked
+(
+    GrB_Matrix C,               // output matrix, static header
+    const bool C_iso,           // if true, C is iso
+    const GrB_IndexUnaryOp op,
+    const bool flipij,          // if true, flip i and j for user operator
+    const GrB_Matrix M,         // mask matrix, not NULL
+    const bool Mask_comp,       // if true, use !M
+    const bool Mask_struct,     // if true, use the only structure of M
+    const GrB_Matrix A,         // input matrix
+    const int64_t ithunk,       // (int64_t) Thunk, if Thunk is NULL
+    const GB_void *restrict athunk,     // (A->type) Thunk
+    const GB_void *restrict ythunk,     // (op->ytype) Thunk
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_selectop_to_idxunop
 (
     // output:
@@ -176,6 +195,35 @@ GrB_Info GB_select_generic_bitmap
     const int nthreads
 ) ;
 
+GrB_Info GB_select_positional_masked
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const int64_t ithunk,
+    const GrB_IndexUnaryOp op,
+    const int64_t *C_ek_slicing,
+    const int C_ntasks,
+    const int C_nthreads
+) ;
+
+GrB_Info GB_select_generic_masked
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GrB_IndexUnaryOp op,
+    const int64_t *C_ek_slicing,
+    const int C_ntasks,
+    const int C_nthreads
+) ;
+
 //------------------------------------------------------------------------------
 // GB_select_iso: assign the iso value of C for GB_*selector
 //------------------------------------------------------------------------------
@@ -0,0 +1,201 @@
+//------------------------------------------------------------------------------
+// GB_select_masked:  select entries from a matrix, via the mask
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: done.
+
+// C<M>=select(A,thunk) is computed, where C is sparse or hypersparse, with
+// zombies for entries that are not kept.  The mask is applied, but it must
+// still be passed to GB_accum_mask, which deletes the zombies and computes
+// C_final<M>=accum(C_final,C).
+
+// If M is sparse or hypersparse, it must not be complemented.  C has the same
+// pattern as M, and the work is proportional to nnz(M) (times a binary search
+// in A(:,j) if A is sparse or hypersparse).  This case is used when M has far
+// fewer entries than A, so that the entries of select(A,thunk) outside of M
+// are never computed.
+
+// If M is bitmap or full, it may be complemented, and A must be sparse or
+// hypersparse.  C has the same pattern as A.  In both cases, A and M have the
+// same CSR/CSC orientation.
+
+#include "GB_select.h"
+#include "GB_ek_slice.h"
+#include "GB_stringify.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (C_ek_slicing, int64_t) ;   \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phybix_free (C) ;                    \
+}
+
+GrB_Info GB_select_masked
+(
+    GrB_Matrix C,               // output matrix, static header
+    const bool C_iso,           // if true, C is iso
+    const GrB_IndexUnaryOp op,
+    const bool flipij,          // if true, flip i and j for user operator
+    const GrB_Matrix M,         // mask matrix, not NULL
+    const bool Mask_comp,       // if true, use !M
+    const bool Mask_struct,     // if true, use the only structure of M
+    const GrB_Matrix A,         // input matrix
+    const int64_t ithunk,       // (int64_t) Thunk, if Thunk is NULL
+    const GB_void *restrict athunk,     // (A->type) Thunk
+    const GB_void *restrict ythunk,     // (op->ytype) Thunk
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_WERK_DECLARE (C_ek_slicing, int64_t) ;
+    ASSERT_MATRIX_OK (A, "A for masked selector", GB0) ;
+    ASSERT_MATRIX_OK (M, "M for masked selector", GB0) ;
+    ASSERT_INDEXUNARYOP_OK (op, "idxunop for masked selector", GB0) ;
+    ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+    GB_Opcode opcode = op->opcode ;
+    ASSERT (opcode != GB_NONZOMBIE_idxunop_code) ;
+    ASSERT (A->vlen == M->vlen && A->vdim == M->vdim) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (M)) ;
+
+    const bool M_is_sparse_or_hyper = GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M);
+    ASSERT (GB_IMPLIES (M_is_sparse_or_hyper, !Mask_comp)) ;
+    ASSERT (GB_IMPLIES (!M_is_sparse_or_hyper,
+        GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))) ;
+
+    //--------------------------------------------------------------------------
+    // allocate C, with the pattern of M or A
+    //--------------------------------------------------------------------------
+
+    // P is the matrix whose pattern is copied into C
+    GrB_Matrix P = M_is_sparse_or_hyper ? M : A ;
+    const bool P_is_hyper = GB_IS_HYPERSPARSE (P) ;
+    const int64_t pnz = GB_nnz (P) ;
+    const int64_t pnvec = P->nvec ;
+    const size_t asize = A->type->size ;
+
+    // set C->iso = C_iso   OK
+    GB_OK (GB_new_bix (&C, // sparse or hyper (from P), existing header
+        A->type, P->vlen, P->vdim, GB_Ap_malloc, true,
+        P_is_hyper ? GxB_HYPERSPARSE : GxB_SPARSE, true, P->hyper_switch,
+        pnvec, pnz, true, C_iso)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (pnvec, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // copy Pp and Ph into C
+    //--------------------------------------------------------------------------
+
+    GB_memcpy (C->p, P->p, (pnvec+1) * sizeof (int64_t), nthreads) ;
+    if (P_is_hyper)
+    {
+        GB_memcpy (C->h, P->h, pnvec * sizeof (int64_t), nthreads) ;
+    }
+    C->nvec_nonempty = P->nvec_nonempty ;
+    C->nvec = pnvec ;
+    C->nvals = pnz ;
+    C->magic = GB_MAGIC ;
+
+    if (C_iso)
+    {
+        // Cx [0] = Ax [0] or (A->type) thunk
+        GB_select_iso (C->x, opcode, athunk, A->x, asize) ;
+    }
+
+    if (pnz == 0)
+    {
+        // quick return: C has no entries
+        ASSERT_MATRIX_OK (C, "C from masked selector (empty)", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the hyper hash of A, if needed, and slice C
+    //--------------------------------------------------------------------------
+
+    if (M_is_sparse_or_hyper)
+    {
+        GB_OK (GB_hyper_hash_build (A, Werk)) ;
+    }
+
+    int C_ntasks, C_nthreads ;
+    GB_SLICE_MATRIX (C, 8) ;
+
+    //--------------------------------------------------------------------------
+    // C<M>=select(A,thunk), with zombies
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(%s masked select) ", GB_sparsity_char_matrix (M)) ;
+
+    if (GB_IS_INDEXUNARYOP_CODE_POSITIONAL (opcode))
+    {
+
+        //----------------------------------------------------------------------
+        // masked selector for positional ops
+        //----------------------------------------------------------------------
+
+        info = GB_select_positional_masked (C, M, Mask_comp, Mask_struct, A,
+            ithunk, op, C_ek_slicing, C_ntasks, C_nthreads) ;
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // masked selector for VALUE* and user-defined ops
+        //----------------------------------------------------------------------
+
+        // no factory kernels are provided for the masked selector
+
+        //----------------------------------------------------------------------
+        // via the JIT or PreJIT kernel
+        //----------------------------------------------------------------------
+
+        info = GB_select_masked_jit (C, M, Mask_comp, Mask_struct, A,
+            flipij, ythunk, op, C_ek_slicing, C_ntasks, C_nthreads) ;
+
+        //----------------------------------------------------------------------
+        // via the generic kernel
+        //----------------------------------------------------------------------
+
+        if (info == GrB_NO_VALUE)
+        {
+            info = GB_select_generic_masked (C, M, Mask_comp, Mask_struct, A,
+                flipij, ythunk, op, C_ek_slicing, C_ntasks, C_nthreads) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory, or other error
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C from masked selector", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// GB_select_masked_jit: select masked for the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+typedef GB_JIT_KERNEL_SELECT_MASKED_PROTO ((*GB_jit_dl_function)) ;
+
+GrB_Info GB_select_masked_jit      // select masked
+(
+    // input/output:
+    GrB_Matrix C,
+    // input:
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GrB_IndexUnaryOp op,
+    const int64_t *C_ek_slicing,
+    const int C_ntasks,
+    const int C_nthreads
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // encodify the problem
+    //--------------------------------------------------------------------------
+
+    GB_jit_encoding encoding ;
+    char *suffix ;
+    uint64_t hash = GB_encodify_select (&encoding, &suffix,
+        GB_JIT_KERNEL_SELECT_MASKED, C->iso, false, op, flipij, A,
+        M, Mask_struct, Mask_comp) ;
+
+    //--------------------------------------------------------------------------
+    // get the kernel function pointer, loading or compiling it if needed
+    //--------------------------------------------------------------------------
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function,
+        GB_jit_select_family, "select_masked",
+        hash, &encoding, suffix, NULL, NULL,
+        (GB_Operator) op, A->type, NULL, NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    //--------------------------------------------------------------------------
+    // call the jit kernel and return result
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (C, M, A, ythunk, C_ek_slicing, C_ntasks,
+        C_nthreads)) ;
+}
@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+// GB_select_positional_masked: C<M>=select(A,thunk), C with zombies
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed, but variants could be constructed for the sparsity
+// structures of M and A, and the type of M.
+
+// C is sparse or hypersparse, with the pattern of M or A.  The op is
+// positional.
+
+#include "GB_select.h"
+#include "GB_ek_slice.h"
+
+GrB_Info GB_select_positional_masked
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const int64_t ithunk,
+    const GrB_IndexUnaryOp op,
+    const int64_t *C_ek_slicing,
+    const int C_ntasks,
+    const int C_nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_Opcode opcode = op->opcode ;
+    ASSERT (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C)) ;
+    ASSERT (GB_OPCODE_IS_POSITIONAL (opcode)) ;
+
+    //--------------------------------------------------------------------------
+    // positional operators when C has the pattern of M or A
+    //--------------------------------------------------------------------------
+
+    const size_t asize = A->type->size ;
+    const bool C_iso = C->iso ;
+
+    #define GB_A_TYPE GB_void
+    #include "GB_select_shared_definitions.h"
+
+    // Cx [pC] = Ax [pA], no typecast, unless C is iso
+    #undef  GB_SELECT_ENTRY
+    #define GB_SELECT_ENTRY(Cx,pC,Ax,pA)                                    \
+    if (!C_iso)                                                             \
+    {                                                                       \
+        memcpy (Cx +((pC)*asize), Ax +((pA)*asize), asize) ;                \
+    }
+
+    switch (opcode)
+    {
+
+        case GB_TRIL_idxunop_code      : 
+            #define GB_TRIL_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_TRIU_idxunop_code      : 
+            #define GB_TRIU_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_DIAG_idxunop_code      : 
+            #define GB_DIAG_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_OFFDIAG_idxunop_code   : 
+        case GB_DIAGINDEX_idxunop_code : 
+            #define GB_OFFDIAG_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_ROWINDEX_idxunop_code  : 
+            #define GB_ROWINDEX_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_ROWLE_idxunop_code     : 
+            #define GB_ROWLE_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_ROWGT_idxunop_code     : 
+            #define GB_ROWGT_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_COLINDEX_idxunop_code  : 
+            #define GB_COLINDEX_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_COLLE_idxunop_code     : 
+            #define GB_COLLE_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        case GB_COLGT_idxunop_code     : 
+            #define GB_COLGT_SELECTOR
+            #include "GB_select_masked_template.c"
+            break ;
+
+        default: ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
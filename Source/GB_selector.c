@@ -17,9 +17,17 @@
 // input, A is modified in-place.  Otherwise, C is an uninitialized static
 // header.
 
-// TODO: GB_selector does not exploit the mask.
+// The mask M is optional, and is only passed in by GB_select.  If present,
+// it has the same dimensions and CSR/CSC orientation as A.  GB_selector may
+// use it to skip entries of A that are not in the mask (see GB_select_masked),
+// but T must still be passed to GB_accum_mask, which applies the mask.
+// There are no factory kernels for the masked selector, so built-in VALUE*
+// ops use it only if the JIT can compile a kernel.  Otherwise, they use the
+// factory kernels of the unmasked selector, which are faster than the generic
+// masked kernel.
 
 #include "GB_select.h"
+#include "GB_jitifyer.h"
 
 #define GB_FREE_ALL ;
 
@@ -30,6 +38,9 @@ GrB_Info GB_selector
     const bool flipij,          // if true, flip i and j for user operator
     GrB_Matrix A,               // input matrix
     const GrB_Scalar Thunk,
+    const GrB_Matrix M,         // optional mask, or NULL
+    const bool Mask_comp,       // if true, use !M
+    const bool Mask_struct,     // if true, use the only structure of M
     GB_Werk Werk
 )
 {
@@ -47,6 +58,7 @@ GrB_Info GB_selector
     GB_Opcode opcode = op->opcode ;
     ASSERT (GB_IMPLIES (GB_OPCODE_IS_POSITIONAL (opcode), !GB_JUMBLED (A))) ;
     ASSERT (C == NULL || (C != NULL && (C->static_header || GBNSTATIC))) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_selector", GB0) ;
 
     bool in_place_A = (C == NULL) ; // GrB_wait and GB_resize only
     const bool A_iso = A->iso ;
@@ -94,6 +106,53 @@ GrB_Info GB_selector
         GB_BURBLE_MATRIX (A, "(iso select) ") ;
     }
 
+    //--------------------------------------------------------------------------
+    // masked case
+    //--------------------------------------------------------------------------
+
+    bool use_select_masked = false ;
+    bool masked_kernel = GB_IS_INDEXUNARYOP_CODE_POSITIONAL (opcode)
+        || (opcode == GB_USER_idxunop_code)
+        || (GB_jitifyer_get_control ( ) == GxB_JIT_ON) ;
+    if (M != NULL && !in_place_A && opcode != GB_NONZOMBIE_idxunop_code
+        && masked_kernel
+        && !GB_ANY_PENDING_WORK (M) && !GB_ANY_PENDING_WORK (A))
+    {
+        ASSERT (M->vlen == A->vlen && M->vdim == A->vdim) ;
+        if (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M))
+        {
+            // M sparse/hyper and not complemented: C has the pattern of M.
+            // Use this method if the work to look up each M(i,j) in A is
+            // less than the work to examine all entries of A.
+            if (!Mask_comp)
+            { 
+                double mnz = (double) GB_nnz (M) ;
+                double anz = (double) GB_nnz_held (A) ;
+                double work = mnz ;
+                if (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+                { 
+                    // binary search of each A(:,j)
+                    double anvec = (double) GB_IMAX (A->nvec, 1) ;
+                    work *= (1 + log2 (1 + anz / anvec)) ;
+                }
+                use_select_masked = (work < anz) ;
+            }
+        }
+        else
+        { 
+            // M bitmap/full, complemented or not: C has the pattern of A,
+            // which must be sparse or hypersparse
+            use_select_masked = GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A) ;
+        }
+    }
+
+    if (use_select_masked)
+    { 
+        ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+        return (GB_select_masked (C, C_iso, op, flipij, M, Mask_comp,
+            Mask_struct, A, ithunk, athunk, ythunk, Werk)) ;
+    }
+
     //--------------------------------------------------------------------------
     // handle iso case for built-in ops that depend only on the value
     //--------------------------------------------------------------------------
@@ -13,6 +13,16 @@
 // input (for GrB_Matrix_serialize).  This method also does a dry run to
 // estimate the size of the blob for GrB_Matrix_serializeSize.
 
+// If the writer function is not NULL (for GxB_Matrix_serialize_stream), the
+// blob is not returned but written to the stream instead, in order.  The
+// compressed arrays are never held in memory all at once.  Instead, each array
+// is compressed twice by GB_serialize_stream_array: once to find the size of
+// each compressed block for the blob header, and again to write the blocks to
+// the stream after the header has been written.  The stream holds a valid
+// blob, but its compressed blocks are smaller than those of the blob that
+// GxB_Matrix_serialize would return (see GB_serialize_stream_array).  With no
+// compression, the two are identical.
+
 #include "GB.h"
 #include "GB_get_set.h"
 #include "GB_serialize.h"
@@ -51,6 +61,10 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     // input:
     const GrB_Matrix A,             // matrix to serialize
     int32_t method,                 // method to use
+    GxB_stream_write_function writer,   // if not NULL, write the blob to
+                                        // the stream, and blob_handle must
+                                        // be NULL
+    void *stream,                   // stream passed to the writer
     GB_Werk Werk
 )
 {
@@ -71,7 +85,14 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     size_t blob_size_allocated = 0 ;
     bool dryrun = false ;
     bool preallocated_blob = false ;
-    if (blob_handle == NULL)
+    bool streaming = (writer != NULL) ;
+    if (streaming)
+    { 
+        // for GxB_Matrix_serialize_stream:  the blob is written to the
+        // stream, not returned.  Only the header is allocated, below.
+        ASSERT (blob_handle == NULL) ;
+    }
+    else if (blob_handle == NULL)
     { 
         // for GrB_Matrix_serializeSize:  the blob is not provided on input,
         // and not allocated.  Just compute an upper bound only.
@@ -129,13 +150,14 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
 
     int32_t algo, level ;
     GB_serialize_method (&algo, &level, method) ;
+    bool filter = (algo != GxB_COMPRESSION_NONE && GB_FILTER (method) > 0) ;
     method = algo + level ;
-    GBURBLE ("(compression: %s%s%s%s:%d) ",
+    GBURBLE ("(compression: %s%s%s%s:%d%s) ",
         (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
         (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
         (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
         (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "",
-        level) ;
+        level, filter ? " filtered" : "") ;
 
     //--------------------------------------------------------------------------
     // get the content of the matrix
@@ -194,32 +216,84 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     // For the dryrun case, this just computes A[phbix]_compressed_size as an
     // upper bound on each array size when compressed, and A[phbix]_nblocks.
 
+    // For the streaming case, this computes A[phbix]_Sblocks and
+    // A[phbix]_compressed_size, but the compressed blocks are discarded.
+
     int32_t Ap_method, Ah_method, Ab_method, Ai_method, Ax_method ;
 
-    GB_OK (GB_serialize_array (&Ap_Blocks, &Ap_Blocks_size,
-        &Ap_Sblocks, &Ap_Sblocks_size, &Ap_nblocks, &Ap_method,
-        &Ap_compressed_size, dryrun,
-        (GB_void *) A->p, Ap_len, method, algo, level, Werk)) ;
+    // If requested, Ap, Ah, and Ai are delta encoded and byte shuffled, and
+    // Ax may be byte shuffled, before they are compressed.  Ab is not
+    // filtered.
+    int32_t pi_method = method, b_method = method, x_method = method ;
+    if (filter)
+    { 
+        pi_method += GB_FILTER_DELTA * GxB_COMPRESSION_FILTER ;
+        if (typesize > 1 && typesize <= GB_FILTER_MAX)
+        { 
+            x_method += ((int32_t) typesize) * GxB_COMPRESSION_FILTER ;
+        }
+    }
+
+    #define GB_SERIALIZE_ARRAY(X,X_method)                                  \
+    {                                                                       \
+        if (streaming)                                                      \
+        {                                                                   \
+            GB_OK (GB_serialize_stream_array (&A ## X ## _Sblocks,          \
+                &A ## X ## _Sblocks_size, &A ## X ## _nblocks,              \
+                &A ## X ## _method, &A ## X ## _compressed_size,            \
+                NULL, NULL, (GB_void *) A->X, A ## X ## _len,               \
+                X_method, algo, level, Werk)) ;                             \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            GB_OK (GB_serialize_array (&A ## X ## _Blocks,                  \
+                &A ## X ## _Blocks_size, &A ## X ## _Sblocks,               \
+                &A ## X ## _Sblocks_size, &A ## X ## _nblocks,              \
+                &A ## X ## _method, &A ## X ## _compressed_size, dryrun,    \
+                (GB_void *) A->X, A ## X ## _len, X_method, algo, level,    \
+                Werk)) ;                                                    \
+        }                                                                   \
+    }
+
 
-    GB_OK (GB_serialize_array (&Ah_Blocks, &Ah_Blocks_size,
-        &Ah_Sblocks, &Ah_Sblocks_size, &Ah_nblocks, &Ah_method,
-        &Ah_compressed_size, dryrun,
-        (GB_void *) A->h, Ah_len, method, algo, level, Werk)) ;
+    GB_SERIALIZE_ARRAY (p, pi_method) ;
 
-    GB_OK (GB_serialize_array (&Ab_Blocks, &Ab_Blocks_size,
-        &Ab_Sblocks, &Ab_Sblocks_size, &Ab_nblocks, &Ab_method,
-        &Ab_compressed_size, dryrun,
-        (GB_void *) A->b, Ab_len, method, algo, level, Werk)) ;
+    GB_SERIALIZE_ARRAY (h, pi_method) ;
 
-    GB_OK (GB_serialize_array (&Ai_Blocks, &Ai_Blocks_size,
-        &Ai_Sblocks, &Ai_Sblocks_size, &Ai_nblocks, &Ai_method,
-        &Ai_compressed_size, dryrun,
-        (GB_void *) A->i, Ai_len, method, algo, level, Werk)) ;
+    GB_SERIALIZE_ARRAY (b, b_method) ;
 
-    GB_OK (GB_serialize_array (&Ax_Blocks, &Ax_Blocks_size,
-        &Ax_Sblocks, &Ax_Sblocks_size, &Ax_nblocks, &Ax_method,
-        &Ax_compressed_size, dryrun,
-        (GB_void *) A->x, Ax_len, method, algo, level, Werk)) ;
+    GB_SERIALIZE_ARRAY (i, pi_method) ;
+
+    if (x_method != method && Ax_len >= 256 && !dryrun)
+    {
+        // The byte shuffle of Ax helps if the high bytes of its values vary
+        // slowly, but it can hurt if the values are taken from a small set.
+        // Compress one sample block at the start of Ax with and without the
+        // filter, and use the filter for all of Ax only if it makes the sample
+        // smaller.  The method for Ax in the blob header records the choice.
+        int64_t sample_len = GB_IMIN (Ax_len, GB_SERIALIZE_SAMPLE) ;
+        int32_t sample_method [2] = { x_method, method } ;
+        size_t sample_size [2] ;
+        for (int t = 0 ; t < 2 ; t++)
+        {
+            GB_blocks *S_Blocks = NULL ; size_t S_Blocks_size = 0 ;
+            int64_t *S_Sblocks = NULL  ; size_t S_Sblocks_size = 0 ;
+            int32_t S_nblocks = 0, S_method ;
+            GB_OK (GB_serialize_array (&S_Blocks, &S_Blocks_size,
+                &S_Sblocks, &S_Sblocks_size, &S_nblocks, &S_method,
+                &sample_size [t], false, (GB_void *) A->x, sample_len,
+                sample_method [t], algo, level, Werk)) ;
+            GB_FREE (&S_Sblocks, S_Sblocks_size) ;
+            GB_serialize_free_blocks (&S_Blocks, S_Blocks_size, S_nblocks) ;
+        }
+        if (sample_size [1] < sample_size [0])
+        { 
+            // compress Ax without the filter
+            x_method = method ;
+        }
+    }
+
+    GB_SERIALIZE_ARRAY (x, x_method) ;
 
     //--------------------------------------------------------------------------
     // determine the size of the blob
@@ -236,6 +310,7 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
         + Ax_nblocks * sizeof (int64_t)     // Ax_Sblocks [1:Ax_nblocks]
         // type_name for user-defined types
         + ((typecode == GB_UDT_code) ? GxB_MAX_NAME_LEN : 0) ;
+    size_t head_size = s ;
 
     // size of compressed arrays Ap, Ah, Ab, Ai, and Ax in the blob
     s += Ap_compressed_size ;
@@ -282,6 +357,18 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
             return (GrB_INSUFFICIENT_SPACE) ;
         }
     }
+    else if (streaming)
+    {
+        // GxB_Matrix_serialize_stream: allocate just the header, type_name,
+        // and Sblocks, which are written to the stream all at once.
+        blob = GB_MALLOC (head_size, GB_void, &blob_size_allocated) ;
+        if (blob == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
     else
     {
         // GxB_Matrix_serialize: allocate the block.  The memory pool may
@@ -359,6 +446,55 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     GB_BLOB_WRITES (Ab_Sblocks, Ab_nblocks) ;
     GB_BLOB_WRITES (Ai_Sblocks, Ai_nblocks) ;
     GB_BLOB_WRITES (Ax_Sblocks, Ax_nblocks) ;
+    ASSERT (s == head_size) ;
+
+    //--------------------------------------------------------------------------
+    // write the blob to the stream, for GxB_Matrix_serialize_stream
+    //--------------------------------------------------------------------------
+
+    if (streaming)
+    {
+        // write the header, type_name, and Sblocks
+        if (!writer (stream, blob, head_size))
+        { 
+            // the writer has failed
+            GB_FREE_ALL ;
+            return (GrB_INVALID_VALUE) ;
+        }
+
+        // compress each array again, and write its blocks to the stream
+        #define GB_SERIALIZE_STREAM(X,X_method)                             \
+        {                                                                   \
+            GB_OK (GB_serialize_stream_array (&A ## X ## _Sblocks,          \
+                &A ## X ## _Sblocks_size, &A ## X ## _nblocks,              \
+                &A ## X ## _method, &A ## X ## _compressed_size,            \
+                writer, stream, (GB_void *) A->X, A ## X ## _len,           \
+                X_method, algo, level, Werk)) ;                             \
+        }
+        GB_SERIALIZE_STREAM (p, pi_method) ;
+        GB_SERIALIZE_STREAM (h, pi_method) ;
+        GB_SERIALIZE_STREAM (b, b_method) ;
+        GB_SERIALIZE_STREAM (i, pi_method) ;
+        GB_SERIALIZE_STREAM (x, Ax_method) ;
+
+        // write the GrB_NAME and GrB_ELTYPE_STRING, each with a nul byte
+        const char *empty = "" ;
+        if (!writer (stream, (user_name == NULL) ? empty : user_name,
+                user_name_len + 1) ||
+            !writer (stream, (eltype_string == NULL) ? empty : eltype_string,
+                eltype_string_len + 1))
+        { 
+            // the writer has failed
+            GB_FREE_ALL ;
+            return (GrB_INVALID_VALUE) ;
+        }
+
+        // free the header and workspace, and return the # of bytes written
+        GB_FREE (&blob, blob_size_allocated) ;
+        GB_FREE_WORKSPACE ;
+        (*blob_size_handle) = blob_size_required ;
+        return (GrB_SUCCESS) ;
+    }
 
     GB_serialize_to_blob (blob, &s, Ap_Blocks, Ap_Sblocks+1, Ap_nblocks,
         nthreads_max) ;
@@ -18,6 +18,8 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     // input:
     const GrB_Matrix A,             // matrix to serialize
     int32_t method,                 // method to use
+    GxB_stream_write_function writer,   // if not NULL, write to the stream
+    void *stream,                   // stream passed to the writer
     GB_Werk Werk
 ) ;
 
@@ -37,7 +39,24 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     // input:
     GrB_Type type_expected,         // type expected (NULL for any built-in)
     const GB_void *blob,            // serialized matrix 
-    size_t blob_size                // size of the blob
+    size_t blob_size,               // size of the blob
+    bool shallow,                   // if true, C may point into the blob
+    GxB_stream_read_function reader,    // if not NULL, read from the stream
+    void *stream                    // stream passed to the reader
+) ;
+
+GrB_Info GB_deserialize_range       // deserialize a range of vectors
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *blob,            // serialized matrix
+    size_t blob_size,               // size of the blob
+    GrB_Index kfirst,               // first vector to deserialize
+    GrB_Index klast,                // last vector to deserialize
+    bool shallow,                   // if true, C may point into the blob
+    GB_Werk Werk
 ) ;
 
 typedef struct
@@ -68,6 +87,65 @@ GrB_Info GB_serialize_array
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_serialize_stream_array
+(
+    // input/output:
+    int64_t **Sblocks_handle,           // Sblocks: array of size nblocks+1
+    size_t *Sblocks_size_handle,        // size of Sblocks
+    int32_t *nblocks_handle,            // # of blocks
+    int32_t *method_used,               // method used
+    size_t *compressed_size,            // size of the compressed array
+    // input:
+    GxB_stream_write_function writer,   // NULL for the first pass
+    void *stream,                       // stream passed to the writer
+    GB_void *X,                         // input array of size len
+    int64_t len,                        // size of X, in bytes
+    int32_t method,                     // compression method requested
+    int32_t algo,                       // compression algorithm
+    int32_t level,                      // compression level
+    GB_Werk Werk
+) ;
+
+// largest uncompressed block for GB_serialize_array and
+// GB_serialize_stream_array
+#define GB_SERIALIZE_BLOCKSIZE (1024*1024)
+
+// size of the sample of Ax compressed to decide if Ax is to be filtered
+#define GB_SERIALIZE_SAMPLE (64*1024)
+
+// Each array in the blob may be filtered, block by block, before it is
+// compressed, by GB_serialize_filter.  The filter is held in the method of
+// each array, as (method / GxB_COMPRESSION_FILTER).  A filter of zero means
+// no filter, GB_FILTER_DELTA (1) is delta encoding and byte shuffle of an
+// int64_t array, and a filter from 2 to GB_FILTER_MAX is a byte shuffle of
+// an array with entries of that many bytes.
+#define GB_FILTER_DELTA 1
+#define GB_FILTER_MAX 16
+#define GB_FILTER(method) \
+    (((method) < 0) ? 0 : ((method) / GxB_COMPRESSION_FILTER))
+
+void GB_serialize_filter
+(
+    // output:
+    GB_void *restrict dst,          // filtered block, of size kend-kstart
+    // input:
+    const GB_void *restrict src,    // the block X [kstart:kend-1]
+    int64_t kstart,                 // position of the block in X
+    int64_t kend,
+    int32_t filter                  // GB_FILTER_DELTA, or 2 to 16
+) ;
+
+void GB_deserialize_unfilter
+(
+    // output:
+    GB_void *restrict dst,          // the block X [kstart:kend-1]
+    // input:
+    const GB_void *restrict src,    // filtered block, of size kend-kstart
+    int64_t kstart,                 // position of the block in X
+    int64_t kend,
+    int32_t filter                  // GB_FILTER_DELTA, or 2 to 16
+) ;
+
 void GB_serialize_free_blocks
 (
     GB_blocks **Blocks_handle,      // array of size nblocks
@@ -92,6 +170,7 @@ GrB_Info GB_deserialize_from_blob
     // output:
     GB_void **X_handle,         // uncompressed output array
     size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow,            // if true, X is a shallow pointer into blob
     // input:
     int64_t X_len,              // size of X in bytes
     const GB_void *blob,        // serialized blob of size blob_size
@@ -99,10 +178,73 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method_used,        // compression method used for each block
+    size_t shallow_align,       // required alignment of a shallow X, or 0 if
+                                // X must not be shallow
     // input/output:
     size_t *s_handle            // where to read from the blob
 ) ;
 
+GrB_Info GB_deserialize_blob_range
+(
+    // output:
+    GB_void **X_handle,         // uncompressed bytes xstart:xend-1 of array
+    size_t *X_size_handle,      // size of X as allocated
+    bool *X_shallow,            // if true, X is a shallow pointer into blob
+    // input:
+    int64_t xstart,             // first byte of the array to decompress
+    int64_t xend,               // one past the last byte to decompress
+    int64_t X_len,              // size of the entire array in bytes
+    const GB_void *blob,        // serialized blob of size blob_size
+    size_t blob_size,
+    int64_t *Sblocks,           // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    size_t shallow_align,       // required alignment of a shallow X, or 0 if
+                                // X must not be shallow
+    // input/output:
+    size_t *s_handle            // where to read from the blob
+) ;
+
+// largest chunk read from a stream by GB_deserialize_stream_read
+#define GB_STREAM_CHUNK (1024*1024)
+
+// largest ratio of the uncompressed to the compressed size of any block.
+// LZ4 encodes at most 255 bytes of a match per byte, and ZSTD at most one
+// 128KB block (run-length encoded) in 4 bytes.  A compressed block read from
+// a stream that claims a larger ratio is corrupted, and is rejected before
+// any space for its uncompressed content is allocated.
+#define GB_LZ4_MAX_RATIO 256
+#define GB_ZSTD_MAX_RATIO (32*1024)
+
+GrB_Info GB_deserialize_stream_read
+(
+    // input/output:
+    GB_void **X_handle,         // buffer, reallocated as needed
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    size_t offset,              // read into X [offset:offset+len-1]
+    size_t len,                 // # of bytes to read
+    GxB_stream_read_function reader,    // function to read from the stream
+    void *stream                // stream passed to the reader
+) ;
+
+GrB_Info GB_deserialize_from_stream
+(
+    // output:
+    GB_void **X_handle,         // uncompressed output array
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    int64_t X_len,              // size of X in bytes
+    GxB_stream_read_function reader,    // function to read from the stream
+    void *stream,               // stream passed to the reader
+    size_t blob_size,           // size of the serialized blob in the stream
+    int64_t *Sblocks,           // array of size nblocks
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    // input/output:
+    size_t *s_handle            // # of bytes read so far from the stream
+) ;
+
 #define GB_BLOB_HEADER_SIZE \
     sizeof (uint64_t)           /* blob_size                            */  \
     + 11 * sizeof (int64_t)     /* vlen, vdim, nvec, nvec_nonempty,     */  \
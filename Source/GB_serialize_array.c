@@ -18,8 +18,14 @@
 #include "GB_lz4.h"
 #include "GB_zstd.h"
 
+#define GB_FREE_WORKSPACE                                       \
+{                                                               \
+    GB_FREE_WORK (&W, W_size) ;                                 \
+}
+
 #define GB_FREE_ALL                                             \
 {                                                               \
+    GB_FREE_WORKSPACE ;                                         \
     GB_FREE (&Sblocks, Sblocks_size) ;                          \
     GB_serialize_free_blocks (&Blocks, Blocks_size, nblocks) ;  \
 }
@@ -61,6 +67,7 @@ GrB_Info GB_serialize_array
     size_t Blocks_size = 0, Sblocks_size = 0 ;
     int32_t nblocks = 0 ;
     int64_t *Sblocks = NULL ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
 
     //--------------------------------------------------------------------------
     // check for quick return
@@ -133,6 +140,10 @@ GrB_Info GB_serialize_array
     // divide the array into blocks, 4 per thread, or a single block if 1 thread
     int64_t blocksize = (nthreads == 1) ? len : GB_ICEIL (len, 4*nthreads) ;
 
+    // limit the blocksize, so that GB_deserialize_range can decompress just
+    // the part of the array it needs
+    blocksize = GB_IMIN (blocksize, GB_SERIALIZE_BLOCKSIZE) ;
+
     // ensure the blocksize does not exceed the LZ4 maximum
     // ... this is also fine for ZSTD
     ASSERT (LZ4_MAX_INPUT_SIZE < INT32_MAX) ;
@@ -210,6 +221,14 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
+    // allocate workspace for the filtered array, if needed
+    int32_t filter = GB_FILTER (method) ;
+    if (filter > 0 && ok)
+    { 
+        W = GB_MALLOC_WORK (len, GB_void, &W_size) ;
+        ok = (W != NULL) ;
+    }
+
     if (!ok)
     { 
         // out of memory
@@ -229,6 +248,12 @@ GrB_Info GB_serialize_array
         int64_t kstart, kend ;
         GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
         const char *src = (const char *) (X + kstart) ;     // source
+        if (filter > 0)
+        { 
+            // filter X [kstart:kend-1] into W [kstart:kend-1]
+            GB_serialize_filter (W + kstart, X + kstart, kstart, kend, filter);
+            src = (const char *) (W + kstart) ;
+        }
         char *dst = (char *) Blocks [blockid].p ;           // destination
         int srcSize = (int) (kend - kstart) ;               // size of source
         size_t dsize = Blocks [blockid].p_size_allocated ;  // size of dest
@@ -279,6 +304,7 @@ GrB_Info GB_serialize_array
     // free workspace return result
     //--------------------------------------------------------------------------
 
+    GB_FREE_WORKSPACE ;
     (*Blocks_handle) = Blocks ;
     (*Blocks_size_handle) = Blocks_size ;
     (*Sblocks_handle) = Sblocks ;
@@ -0,0 +1,101 @@
+//------------------------------------------------------------------------------
+// GB_serialize_filter: filter a block of an array before it is compressed
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The block X [kstart:kend-1] of an array X is copied into dst, with a filter
+// that makes it more compressible.  The filter is reversed by
+// GB_deserialize_unfilter.  Each block is filtered on its own, so the blocks
+// can still be compressed and decompressed independently, in parallel.
+
+// The entries of X are esize bytes each, where esize is the filter itself
+// (2 to 16), or 8 for GB_FILTER_DELTA.  Since kstart need not be a multiple of
+// esize, any bytes of the block before the first whole entry, and after the
+// last whole entry, are copied as-is.  The m whole entries in the block are
+// byte shuffled:  byte b of the tth entry is placed at position b*m+t, so that
+// all of the low bytes come first, then all of the next bytes, and so on.
+// This groups together bytes with similar values, such as the exponents of
+// floating-point values.
+
+// With GB_FILTER_DELTA, the whole entries are int64_t values, and each is
+// replaced with its difference from the prior entry in the block before it
+// is shuffled.  For the sorted arrays Ap and Ah, and for Ai, which is sorted
+// within each vector, the differences are small, and their high bytes are
+// mostly zero.  A difference is shuffled by shifting it, not by its bytes in
+// memory, so this filter does not depend on the byte order of the computer.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+void GB_serialize_filter
+(
+    // output:
+    GB_void *restrict dst,          // filtered block, of size kend-kstart
+    // input:
+    const GB_void *restrict src,    // the block X [kstart:kend-1]
+    int64_t kstart,                 // position of the block in X
+    int64_t kend,
+    int32_t filter                  // GB_FILTER_DELTA, or 2 to 16
+)
+{
+
+    //--------------------------------------------------------------------------
+    // find the whole entries in the block
+    //--------------------------------------------------------------------------
+
+    ASSERT (filter >= 1 && filter <= GB_FILTER_MAX) ;
+    int64_t esize = (filter == GB_FILTER_DELTA) ? sizeof (int64_t) : filter ;
+    int64_t n = kend - kstart ;
+    int64_t p0 = GB_IMIN ((esize - (kstart % esize)) % esize, n) ;
+    int64_t m = (n - p0) / esize ;
+    int64_t p1 = p0 + m * esize ;
+
+    //--------------------------------------------------------------------------
+    // copy the partial entries at the start and end of the block
+    //--------------------------------------------------------------------------
+
+    memcpy (dst, src, p0) ;
+    memcpy (dst + p1, src + p1, n - p1) ;
+
+    //--------------------------------------------------------------------------
+    // filter the whole entries
+    //--------------------------------------------------------------------------
+
+    src += p0 ;
+    dst += p0 ;
+    if (filter == GB_FILTER_DELTA)
+    {
+        // delta encoding and byte shuffle of int64_t values
+        uint64_t last = 0 ;
+        for (int64_t t = 0 ; t < m ; t++)
+        {
+            uint64_t x ;
+            memcpy (&x, src + t * sizeof (int64_t), sizeof (int64_t)) ;
+            uint64_t d = x - last ;
+            last = x ;
+            for (int b = 0 ; b < 8 ; b++)
+            {
+                dst [b * m + t] = (GB_void) (d >> (8 * b)) ;
+            }
+        }
+    }
+    else
+    {
+        // byte shuffle of entries of size esize
+        for (int64_t b = 0 ; b < esize ; b++)
+        {
+            const GB_void *restrict s = src + b ;
+            GB_void *restrict d = dst + b * m ;
+            for (int64_t t = 0 ; t < m ; t++)
+            {
+                d [t] = s [t * esize] ;
+            }
+        }
+    }
+}
@@ -33,7 +33,8 @@ void GB_serialize_method
     // compressions, at the cost of higher run times.  For all methods: a level
     // of zero, or a level setting outside the range permitted for a method,
     // means that default level for that method is used.
-    (*algo) = 1000 * (method / 1000) ;
+    // Any filter (see GB_FILTER) is ignored here.
+    (*algo) = 1000 * ((method % GxB_COMPRESSION_FILTER) / 1000) ;
     (*level) = method % 1000 ;
 
     switch (*algo)
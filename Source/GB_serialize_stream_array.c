@@ -0,0 +1,299 @@
+//------------------------------------------------------------------------------
+// GB_serialize_stream_array: serialize an array to a stream, block by block
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Streaming variant of GB_serialize_array.  The blob header holds the size of
+// each compressed block, so the blocks must be compressed before the header
+// can be written.  To avoid holding all of the compressed blocks in memory at
+// once, each array is compressed twice.  On the first pass (writer is NULL),
+// the blocks are compressed only to find their compressed sizes, which are
+// returned in Sblocks [0:nblocks] as a cumulative sum.  On the second pass
+// (writer not NULL), the blocks are compressed again, and each one is written
+// to the stream.  The workspace is a set of nthreads buffers of at most about
+// GB_SERIALIZE_BLOCKSIZE bytes each, plus another for each thread to hold its
+// filtered block, if the method has a filter.  An uncompressed array is
+// written directly from X, with no copy.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Work, Work_size) ;       \
+    GB_FREE_WORK (&W, W_size) ;             \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    if (writer == NULL)                     \
+    {                                       \
+        GB_FREE (&Sblocks, Sblocks_size) ;  \
+    }                                       \
+}
+
+GrB_Info GB_serialize_stream_array
+(
+    // input/output:
+    int64_t **Sblocks_handle,           // Sblocks: array of size nblocks+1,
+                                        // output if writer is NULL, input
+                                        // otherwise
+    size_t *Sblocks_size_handle,        // size of Sblocks
+    int32_t *nblocks_handle,            // # of blocks
+    int32_t *method_used,               // method used
+    size_t *compressed_size,            // size of the compressed array
+    // input:
+    GxB_stream_write_function writer,   // NULL for the first pass
+    void *stream,                       // stream passed to the writer
+    GB_void *X,                         // input array of size len
+    int64_t len,                        // size of X, in bytes
+    int32_t method,                     // compression method requested
+    int32_t algo,                       // compression algorithm
+    int32_t level,                      // compression level
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Sblocks_handle != NULL) ;
+    ASSERT (Sblocks_size_handle != NULL) ;
+    ASSERT (nblocks_handle != NULL) ;
+    ASSERT (method_used != NULL) ;
+    ASSERT (compressed_size != NULL) ;
+    GB_void *Work = NULL ; size_t Work_size = 0 ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    int64_t *Sblocks = NULL ; size_t Sblocks_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // second pass: write the array to the stream
+    //--------------------------------------------------------------------------
+
+    int32_t nblocks ;
+    if (writer != NULL)
+    {
+        Sblocks = (*Sblocks_handle) ;
+        nblocks = (*nblocks_handle) ;
+        if (nblocks == 0)
+        {
+            // nothing to write
+            return (GrB_SUCCESS) ;
+        }
+        if ((*method_used) == GxB_COMPRESSION_NONE)
+        {
+            // write the uncompressed array X directly to the stream
+            ASSERT (nblocks == 1 && Sblocks [1] == len) ;
+            return (writer (stream, X, len) ? GrB_SUCCESS : GrB_INVALID_VALUE) ;
+        }
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // first pass: check for quick return
+        //----------------------------------------------------------------------
+
+        (*Sblocks_handle) = NULL ;
+        (*Sblocks_size_handle) = 0 ;
+        (*nblocks_handle) = 0 ;
+        (*method_used) = GxB_COMPRESSION_NONE ;
+        (*compressed_size) = 0 ;
+        if (X == NULL || len == 0)
+        {
+            // input array is empty
+            return (GrB_SUCCESS) ;
+        }
+
+        //----------------------------------------------------------------------
+        // first pass: determine the # of blocks
+        //----------------------------------------------------------------------
+
+        if (method <= GxB_COMPRESSION_NONE || len < 256)
+        {
+            // no compression; the array is a single uncompressed block
+            nblocks = 1 ;
+        }
+        else
+        {
+            // compressed blocks of size 64KB to GB_SERIALIZE_BLOCKSIZE each
+            int nthreads_max = GB_Context_nthreads_max ( ) ;
+            int64_t blocksize = GB_ICEIL (len, 4 * nthreads_max) ;
+            blocksize = GB_IMIN (blocksize, GB_SERIALIZE_BLOCKSIZE) ;
+            blocksize = GB_IMAX (blocksize, (64*1024)) ;
+            nblocks = GB_ICEIL (len, blocksize) ;
+            (*method_used) = method ;
+        }
+
+        Sblocks = GB_CALLOC (nblocks+1, int64_t, &Sblocks_size) ;
+        if (Sblocks == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        (*nblocks_handle) = nblocks ;
+
+        if ((*method_used) == GxB_COMPRESSION_NONE)
+        {
+            // the single block is all of X, and its size is known
+            Sblocks [1] = len ;
+            (*Sblocks_handle) = Sblocks ;
+            (*Sblocks_size_handle) = Sblocks_size ;
+            (*compressed_size) = len ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace: one buffer for each thread
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    int nthreads = GB_IMIN (nthreads_max, nblocks) ;
+
+    // find the largest block, and the upper bound on its compressed size
+    int64_t maxblock = GB_ICEIL (len, nblocks) + 1 ;
+    ASSERT (maxblock < INT32_MAX) ;
+    size_t bound = (algo == GxB_COMPRESSION_ZSTD) ?
+        ZSTD_compressBound (maxblock) :
+        (size_t) LZ4_compressBound ((int) maxblock) ;
+    Work = GB_MALLOC_WORK (nthreads * bound, GB_void, &Work_size) ;
+
+    // each thread also needs a buffer for its filtered block, if any
+    int32_t filter = GB_FILTER (*method_used) ;
+    if (filter > 0)
+    {
+        W = GB_MALLOC_WORK (nthreads * maxblock, GB_void, &W_size) ;
+    }
+
+    if (Work == NULL || (filter > 0 && W == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress the blocks, nthreads blocks at a time
+    //--------------------------------------------------------------------------
+
+    bool ok = true ;
+    for (int32_t block1 = 0 ; block1 < nblocks && ok ; block1 += nthreads)
+    {
+
+        //----------------------------------------------------------------------
+        // compress blocks block1:block2-1 in parallel
+        //----------------------------------------------------------------------
+
+        int32_t block2 = GB_IMIN (block1 + nthreads, nblocks) ;
+        int32_t blockid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1) \
+            reduction(&&:ok)
+        for (blockid = block1 ; blockid < block2 ; blockid++)
+        {
+            // compress X [kstart:kend-1] into Work for this block
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
+            const char *src = (const char *) (X + kstart) ;
+            char *dst = (char *) (Work + (blockid - block1) * bound) ;
+            if (filter > 0)
+            {
+                // filter X [kstart:kend-1] into the buffer for this block
+                GB_void *Wblock = W + (blockid - block1) * maxblock ;
+                GB_serialize_filter (Wblock, X + kstart, kstart, kend, filter) ;
+                src = (const char *) Wblock ;
+            }
+            int srcSize = (int) (kend - kstart) ;
+            int dstCapacity = (int) GB_IMIN (bound, INT32_MAX) ;
+            int64_t csize = 0 ;
+            switch (algo)
+            {
+                case GxB_COMPRESSION_LZ4 :
+                    csize = LZ4_compress_default (src, dst, srcSize,
+                        dstCapacity) ;
+                    ok = ok && (csize > 0) ;
+                    break ;
+
+                case GxB_COMPRESSION_LZ4HC :
+                    csize = LZ4_compress_HC (src, dst, srcSize, dstCapacity,
+                        level) ;
+                    ok = ok && (csize > 0) ;
+                    break ;
+
+                default :
+                case GxB_COMPRESSION_ZSTD :
+                    {
+                        size_t s64 = ZSTD_compress (dst, dstCapacity, src,
+                            srcSize, level) ;
+                        ok = ok && (s64 <= dstCapacity) ;
+                        csize = (int64_t) s64 ;
+                    }
+                    break ;
+            }
+            if (writer == NULL)
+            {
+                // first pass: save the compressed size of this block
+                Sblocks [blockid+1] = csize ;
+            }
+            else
+            {
+                // second pass: the compressed size must not change
+                ok = ok && (csize == Sblocks [blockid+1] - Sblocks [blockid]) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // second pass: write the compressed blocks to the stream, in order
+        //----------------------------------------------------------------------
+
+        if (writer != NULL)
+        {
+            for (blockid = block1 ; blockid < block2 && ok ; blockid++)
+            {
+                size_t csize = Sblocks [blockid+1] - Sblocks [blockid] ;
+                ok = writer (stream, Work + (blockid - block1) * bound, csize) ;
+                if (!ok)
+                {
+                    // the writer has failed
+                    GB_FREE_ALL ;
+                    return (GrB_INVALID_VALUE) ;
+                }
+            }
+        }
+    }
+
+    if (!ok)
+    {
+        // compression failure: this can "never" occur
+        GB_FREE_ALL ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    if (writer == NULL)
+    {
+        // first pass: cumulative sum of the compressed block sizes
+        for (int32_t blockid = 0 ; blockid < nblocks ; blockid++)
+        {
+            Sblocks [blockid+1] += Sblocks [blockid] ;
+        }
+        (*Sblocks_handle) = Sblocks ;
+        (*Sblocks_size_handle) = Sblocks_size ;
+        (*compressed_size) = Sblocks [nblocks] ;
+    }
+    return (GrB_SUCCESS) ;
+}
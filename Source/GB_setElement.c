@@ -108,6 +108,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     ASSERT (GB_PENDING_OK (C)) ;
     ASSERT (GB_ZOMBIES_OK (C)) ;
 
+    // C is modified in place, so it cannot have any shallow components
+    GB_OK (GB_unshallow (C)) ;
+
     bool C_is_full = GB_IS_FULL (C) ;
 
     //--------------------------------------------------------------------------
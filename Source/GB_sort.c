@@ -346,6 +346,9 @@ GrB_Info GB_sort
         GB_OK (GB_convert_any_to_sparse (C, Werk)) ;
     }
 
+    // C is sorted in place, so it cannot have any shallow components
+    GB_OK (GB_unshallow (C)) ;
+
     //--------------------------------------------------------------------------
     // sort C in place
     //--------------------------------------------------------------------------
@@ -551,6 +554,12 @@ GrB_Info GB_sort
         GB_memcpy (C->i, P->i, cnz * sizeof (int64_t), nthreads_max) ;
     }
 
+    if (!C_is_NULL)
+    { 
+        // the row indices of C have been modified in place
+        GB_PATTERN_CHANGED (C) ;
+    }
+
     //--------------------------------------------------------------------------
     // free workspace, and comform/return result
     //--------------------------------------------------------------------------
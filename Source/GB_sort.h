@@ -104,6 +104,29 @@ GrB_Info GB_msort_3    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     int nthreads                // # of threads to use
 ) ;
 
+bool GB_radix_sort_select       // true if the radix sort should be used
+(
+    // output:
+    int *ibits,                 // # of bits for the row indices
+    int *jbits,                 // # of bits for the column indices
+    // input:
+    const int64_t n,            // # of tuples to sort
+    const int64_t vlen,         // row indices are in range 0:vlen-1
+    const int64_t vdim          // column indices are in range 0:vdim-1
+) ;
+
+GrB_Info GB_radix_sort      // sort (J,I,K) or (I,K) tuples
+(
+    int64_t *restrict I,    // size n array of row indices, 0 to 2^ibits-1
+    int64_t *restrict J,    // size n array of column indices, 0 to
+                            // 2^jbits-1, or NULL if only (I,K) is sorted
+    int64_t *restrict K,    // size n array, or NULL if not present
+    const int64_t n,
+    const int ibits,        // # of bits in the row indices
+    const int jbits,        // # of bits in the column indices
+    int nthreads            // # of threads to use
+) ;
+
 //------------------------------------------------------------------------------
 // GB_lt_1: sorting comparator function, one key
 //------------------------------------------------------------------------------
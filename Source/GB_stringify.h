@@ -325,6 +325,19 @@ GrB_Info GB_emult_bitmap_jit      // C<#M>=A.*B, emult_bitmap, via the JIT
     const int C_nthreads
 ) ;
 
+GrB_Info GB_kroner_jit          // C=kron(A,B), via the JIT
+(
+    // input/output:
+    GrB_Matrix C,
+    // input:
+    const GrB_BinaryOp binaryop,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *C_ek_slicing,
+    const int C_ntasks,
+    const int C_nthreads
+) ;
+
 GrB_Info GB_ewise_fulla_jit    // C+=A+B via the JIT
 (
     // input/output:
@@ -586,6 +599,19 @@ GrB_Info GB_AxB_dot4_jit            // C+=A'*B, dot4 method, via the JIT
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_AxB_outer_jit           // C+=A*B', outer method, via the JIT
+(
+    // input/output:
+    GrB_Matrix C,
+    // input:
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const int ntasks,
+    const int nthreads
+) ;
+
 //------------------------------------------------------------------------------
 // enumify and macrofy the mask matrix M
 //------------------------------------------------------------------------------
@@ -1215,7 +1241,10 @@ uint64_t GB_encodify_select     // encode an select problem
     const bool in_place_A,
     const GrB_IndexUnaryOp op,
     const bool flipij,
-    const GrB_Matrix A
+    const GrB_Matrix A,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp
 ) ;
 
 void GB_enumify_select      // enumerate a GrB_selectproblem
@@ -1229,7 +1258,11 @@ void GB_enumify_select      // enumerate a GrB_selectproblem
     GrB_IndexUnaryOp op,    // the index unary operator to enumify
     bool flipij,            // if true, flip i and j
     // A matrix:
-    GrB_Matrix A
+    GrB_Matrix A,
+    // mask matrix:
+    GrB_Matrix M,           // may be NULL
+    bool Mask_struct,
+    bool Mask_comp
 ) ;
 
 void GB_macrofy_select          // construct all macros for GrB_select
@@ -1257,6 +1290,23 @@ GrB_Info GB_select_bitmap_jit      // select bitmap
     const int nthreads
 ) ;
 
+GrB_Info GB_select_masked_jit      // select masked
+(
+    // input/output:
+    GrB_Matrix C,
+    // input:
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GrB_IndexUnaryOp op,
+    const int64_t *C_ek_slicing,
+    const int C_ntasks,
+    const int C_nthreads
+) ;
+
 GrB_Info GB_select_phase1_jit      // select phase1
 (
     // output:
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// GB_unshallow: ensure a matrix has no shallow components
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix deserialized with the GxB_SHALLOW_DESERIALIZE descriptor setting
+// can have components that point directly into the read-only blob owned by
+// the user application.  Any method that modifies the content of such a
+// matrix in place must first call GB_unshallow, which replaces each shallow
+// component with a deep copy.  The A->Y hyper_hash is freed if it is shallow
+// or has any shallow components; it is rebuilt when needed.  If A has no
+// shallow components, this method does nothing.
+
+// If out of memory, the components of A copied so far are kept, and the rest
+// remain shallow.  A is not restored to its prior state, but it is still a
+// valid matrix, and GB_unshallow can be called again to finish the work.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// GB_UNSHALLOW: replace one shallow component of A with a deep copy
+//------------------------------------------------------------------------------
+
+#define GB_UNSHALLOW(X,type)                                                \
+{                                                                           \
+    if (A->X ## _shallow)                                                   \
+    {                                                                       \
+        if (A->X != NULL)                                                   \
+        {                                                                   \
+            size_t X_size = A->X ## _size ;                                 \
+            Xnew = GB_MALLOC (X_size, GB_void, &Xnew_size) ;                \
+            if (Xnew == NULL)                                               \
+            {                                                               \
+                /* out of memory; A is valid but may be partly copied */    \
+                return (GrB_OUT_OF_MEMORY) ;                                \
+            }                                                               \
+            GB_memcpy (Xnew, A->X, X_size, nthreads_max) ;                  \
+            A->X = (type *) Xnew ;                                          \
+            A->X ## _size = Xnew_size ;                                     \
+            Xnew = NULL ;                                                   \
+        }                                                                   \
+        A->X ## _shallow = false ;                                          \
+    }                                                                       \
+}
+
+//------------------------------------------------------------------------------
+// GB_unshallow
+//------------------------------------------------------------------------------
+
+GrB_Info GB_unshallow           // replace all shallow components of A
+(
+    GrB_Matrix A                // matrix to modify
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (!GB_is_shallow (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GB_void *Xnew = NULL ; size_t Xnew_size = 0 ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    GBURBLE ("(unshallow) ") ;
+
+    //--------------------------------------------------------------------------
+    // free the A->Y hyper_hash if it is shallow in any way
+    //--------------------------------------------------------------------------
+
+    if (A->Y_shallow || GB_is_shallow (A->Y))
+    {
+        GB_hyper_hash_free (A) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make a deep copy of each shallow component
+    //--------------------------------------------------------------------------
+
+    GB_UNSHALLOW (p, int64_t) ;
+    GB_UNSHALLOW (h, int64_t) ;
+    GB_UNSHALLOW (b, int8_t) ;
+    GB_UNSHALLOW (i, int64_t) ;
+    GB_UNSHALLOW (x, void) ;
+
+    ASSERT (!GB_is_shallow (A)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -244,16 +244,40 @@ GrB_Info GB_wait                // finish all pending computations
     }
 
     //--------------------------------------------------------------------------
-    // delete zombies
+    // A = A+T, deleting zombies at the same time
     //--------------------------------------------------------------------------
 
     // A zombie is an entry A(i,j) in the matrix that as been marked for
     // deletion, but hasn't been deleted yet.  It is marked by "negating"
     // replacing its index i with GB_FLIP(i).
 
-    // TODO: pass tnz to GB_selector, to pad the reallocated A matrix
     ASSERT_MATRIX_OK (A, "A before zombies removed", GB0) ;
 
+    if (nzombies > 0 && npending > 0 && !A->jumbled)
+    { 
+        // Pruning the zombies would take a full pass over A, and so would
+        // both A=A+T and the incremental append of T, below.  Instead, S=A+T
+        // is computed in a single pass that also drops the zombies of A.
+        // The hyperlist of A changes, so A->Y is freed by the transplant.
+        GBURBLE ("(zombie merge) ") ;
+        GB_CLEAR_STATIC_HEADER (S, &S_header) ;
+        GB_OK (GB_wait_merge (S, A, T, Werk)) ;
+        GB_Matrix_free (&T) ;
+        GB_OK (GB_transplant_conform (A, A->type, &S, Werk)) ;
+        ASSERT (A->nvec_nonempty >= 0) ;
+        ASSERT_MATRIX_OK (A, "A after GB_wait:merge", GB0) ;
+        GB_FREE_WORKSPACE ;
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // delete zombies
+    //--------------------------------------------------------------------------
+
+    // If A has both zombies and pending tuples here, then A is jumbled, and
+    // the zombies must be pruned before A can be unjumbled.
+
     if (nzombies > 0)
     { 
         // remove all zombies from A
@@ -262,9 +286,11 @@ GrB_Info GB_wait                // finish all pending computations
         struct GB_Scalar_opaque Thunk_header ;
         int64_t k = 0 ;
         GrB_Scalar Thunk = GB_Scalar_wrap (&Thunk_header, GrB_INT64, &k) ;
-        GB_OK (GB_selector (NULL, GxB_NONZOMBIE, false, A, Thunk, Werk)) ;
+        GB_OK (GB_selector (NULL, GxB_NONZOMBIE, false, A, Thunk, NULL,
+            false, false, Werk)) ;
         ASSERT (A->nzombies == (anz_orig - GB_nnz (A))) ;
         A->nzombies = 0 ;
+        GB_PATTERN_CHANGED (A) ;
     }
 
     ASSERT_MATRIX_OK (A, "A after zombies removed", GB0) ;
@@ -384,9 +410,6 @@ GrB_Info GB_wait                // finish all pending computations
         // If anz1 is zero, or small compared to anz0, then it is faster to
         // leave A0 unmodified, and to update just A1.
 
-        // TODO: if A also had zombies, GB_selector could pad A so that
-        // GB_nnz_max (A) is equal to anz + tnz.
-
         // make sure A has enough space for the new tuples
         if (anz_new > GB_nnz_max (A))
         { 
@@ -524,6 +547,7 @@ GrB_Info GB_wait                // finish all pending computations
 
         // A->h has been modified so A->Y is now invalid
         GB_hyper_hash_free (A) ;
+        GB_PATTERN_CHANGED (A) ;
 
         ASSERT_MATRIX_OK (A, "A after GB_wait:append", GB0) ;
 
@@ -546,9 +570,6 @@ GrB_Info GB_wait                // finish all pending computations
         // into A.  The nzmax of A is tight, with no room for future
         // incremental growth.
 
-        // FUTURE:: if GB_add could tolerate zombies in A, then the initial
-        // prune of zombies can be skipped.
-
         // T->Y is not present (GB_builder does not create it).  The old A->Y
         // is still valid, if present, for the matrix A prior to added the
         // pending tuples in T.  GB_add may need A->Y to compute S, but it does
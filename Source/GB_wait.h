@@ -29,6 +29,14 @@ GrB_Info GB_unjumble        // unjumble a matrix
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_wait_merge      // S = A+T, dropping the zombies of A
+(
+    GrB_Matrix S,           // output matrix, static header
+    const GrB_Matrix A,     // matrix with zombies, not jumbled
+    const GrB_Matrix T,     // hypersparse matrix of pending tuples
+    GB_Werk Werk
+) ;
+
 // wait if condition holds
 #define GB_WAIT_IF(condition,A,name)                                    \
 {                                                                       \
@@ -0,0 +1,360 @@
+//------------------------------------------------------------------------------
+// GB_wait_merge: S = A+T, dropping the zombies of A, for GB_wait
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A is sparse or hypersparse, with zombies, and is not jumbled.  T is the
+// hypersparse matrix of pending tuples of A, with the same type, dimensions,
+// and iso property as A.  S = A+T is computed with the implicit SECOND
+// operator (T(i,j) replaces A(i,j) if both appear), and any zombies in A are
+// dropped as S is computed.  This takes a single pass over A, instead of
+// pruning the zombies from A with GB_selector and then computing S=A+T with
+// GB_add.
+
+// The work is sliced by the entries of A and T together, so a single vector
+// of A and T (a GrB_Vector, for example) is split across all the tasks.  The
+// boundaries are found with a merge-path search, so that the (j,i) indices of
+// the entries of A and T in each task are all less than those of the next
+// task.  An entry of A and an entry of T with the same (i,j) are never split
+// across two tasks.
+
+// S is returned as hypersparse, with no empty vectors, and with a static
+// header.  The caller transplants S into A, which conforms it to the desired
+// sparsity of A.
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (Work, int64_t) ;           \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phybix_free (S) ;                    \
+}
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// GB_wait_merge_find: find the vector k that holds the entry p
+//------------------------------------------------------------------------------
+
+// Returns the largest k such that Xp [k] <= p, so that Xp [k] <= p < Xp [k+1]
+// if 0 <= p < Xp [xnvec].
+
+static inline int64_t GB_wait_merge_find
+(
+    const int64_t p,
+    const int64_t *restrict Xp,
+    const int64_t xnvec
+)
+{
+    int64_t left = 0, right = xnvec - 1 ;
+    while (left < right)
+    {
+        int64_t middle = (left + right + 1) / 2 ;
+        if (Xp [middle] <= p)
+        {
+            left = middle ;
+        }
+        else
+        {
+            right = middle - 1 ;
+        }
+    }
+    return (left) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_wait_merge_compare: compare the (j,i) indices of A(pA) and T(pT)
+//------------------------------------------------------------------------------
+
+// Returns -1 if A(pA) comes first, 0 if they have the same (i,j) (the entry
+// in A may be a zombie), or 1 if T(pT) comes first.
+
+static inline int GB_wait_merge_compare
+(
+    const int64_t pA,
+    const int64_t *restrict Ap,
+    const int64_t *restrict Ah,
+    const int64_t *restrict Ai,
+    const int64_t anvec,
+    const int64_t pT,
+    const int64_t *restrict Tp,
+    const int64_t *restrict Th,
+    const int64_t *restrict Ti,
+    const int64_t tnvec
+)
+{
+    const int64_t jA = GBH (Ah, GB_wait_merge_find (pA, Ap, anvec)) ;
+    const int64_t jT = Th [GB_wait_merge_find (pT, Tp, tnvec)] ;
+    if (jA != jT) return ((jA < jT) ? (-1) : 1) ;
+    const int64_t iA = GB_UNFLIP (Ai [pA]) ;
+    const int64_t iT = Ti [pT] ;
+    if (iA != iT) return ((iA < iT) ? (-1) : 1) ;
+    return (0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_wait_merge
+//------------------------------------------------------------------------------
+
+GrB_Info GB_wait_merge      // S = A+T, dropping the zombies of A
+(
+    GrB_Matrix S,           // output matrix, static header
+    const GrB_Matrix A,     // matrix with zombies, not jumbled
+    const GrB_Matrix T,     // hypersparse matrix of pending tuples
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (S != NULL && (S->static_header || GBNSTATIC)) ;
+    ASSERT_MATRIX_OK (A, "A for wait merge", GB0) ;
+    ASSERT_MATRIX_OK (T, "T for wait merge", GB0) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (GB_IS_HYPERSPARSE (T)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (T)) ;
+    ASSERT (A->type == T->type) ;
+    ASSERT (A->vlen == T->vlen && A->vdim == T->vdim) ;
+    ASSERT (A->iso == T->iso) ;
+
+    GB_WERK_DECLARE (Work, int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // get A and T
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_nnz_held (A) ;   // includes the zombies
+
+    const int64_t *restrict Tp = T->p ;
+    const int64_t *restrict Th = T->h ;
+    const int64_t *restrict Ti = T->i ;
+    const int64_t tnvec = T->nvec ;
+    const int64_t tnz = GB_nnz (T) ;
+
+    const bool S_iso = A->iso ;
+    const size_t asize = A->type->size ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    const int64_t work = anz + tnz ;
+    int nthreads = GB_nthreads (work, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, work) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GB_WERK_PUSH (Work, 9 * (ntasks + 1), int64_t) ;
+    if (Work == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    int64_t *restrict A_slice     = Work ;
+    int64_t *restrict T_slice     = Work + (ntasks + 1) ;
+    int64_t *restrict Task_nz     = Work + (ntasks + 1) * 2 ;
+    int64_t *restrict Task_nvec   = Work + (ntasks + 1) * 3 ;
+    int64_t *restrict Task_jfirst = Work + (ntasks + 1) * 4 ;
+    int64_t *restrict Task_jlast  = Work + (ntasks + 1) * 5 ;
+    int64_t *restrict Task_jcont  = Work + (ntasks + 1) * 6 ;
+    int64_t *restrict Task_pS     = Work + (ntasks + 1) * 7 ;
+    int64_t *restrict Task_kS     = Work + (ntasks + 1) * 8 ;
+
+    //--------------------------------------------------------------------------
+    // slice the entries of A and T with a merge-path search
+    //--------------------------------------------------------------------------
+
+    A_slice [0] = 0 ;
+    T_slice [0] = 0 ;
+    A_slice [ntasks] = anz ;
+    T_slice [ntasks] = tnz ;
+    for (int tid = 1 ; tid < ntasks ; tid++)
+    {
+        // find pA + pT = w, where A [0:pA-1] and T [0:pT-1] come first
+        const int64_t w = GB_PART (tid, work, ntasks) ;
+        int64_t left  = GB_IMAX (0, w - tnz) ;
+        int64_t right = GB_IMIN (w, anz) ;
+        while (left < right)
+        {
+            int64_t middle = (left + right) / 2 ;
+            if (GB_wait_merge_compare (middle, Ap, Ah, Ai, anvec,
+                w - middle - 1, Tp, Th, Ti, tnvec) <= 0)
+            {
+                left = middle + 1 ;
+            }
+            else
+            {
+                right = middle ;
+            }
+        }
+        int64_t pA = left ;
+        int64_t pT = w - left ;
+        if (pA > 0 && pT < tnz && GB_wait_merge_compare (pA-1, Ap, Ah, Ai,
+            anvec, pT, Tp, Th, Ti, tnvec) == 0)
+        {
+            // A(pA-1) and T(pT) have the same (i,j); keep them in this task
+            pA-- ;
+        }
+        A_slice [tid] = pA ;
+        T_slice [tid] = pT ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 1: count the entries and vectors of S in each task
+    //--------------------------------------------------------------------------
+
+    #define GB_PHASE_1_OF_2
+    #include "GB_wait_merge_template.c"
+
+    //--------------------------------------------------------------------------
+    // cumulative sum of the entries and vectors of S
+    //--------------------------------------------------------------------------
+
+    // A vector of S may span several tasks.  It is owned by the first task
+    // that holds any of its entries, and continued by the next ones.
+
+    int64_t snz = 0, snvec = 0, jlast = -1 ;
+    for (int tid = 0 ; tid < ntasks ; tid++)
+    {
+        Task_pS [tid] = snz ;
+        Task_kS [tid] = snvec ;
+        Task_jcont [tid] = jlast ;
+        if (Task_nz [tid] > 0)
+        {
+            snz += Task_nz [tid] ;
+            snvec += Task_nvec [tid] - ((Task_jfirst [tid] == jlast) ? 1 : 0) ;
+            jlast = Task_jlast [tid] ;
+        }
+    }
+    Task_pS [ntasks] = snz ;
+    Task_kS [ntasks] = snvec ;
+
+    //--------------------------------------------------------------------------
+    // allocate S
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new_bix (&S, // hyper, existing header
+        A->type, A->vlen, A->vdim, GB_Ap_malloc, A->is_csc, GxB_HYPERSPARSE,
+        true, A->hyper_switch, snvec, snz, true, S_iso)) ;
+    int64_t *restrict Sp = S->p ;
+    int64_t *restrict Sh = S->h ;
+    int64_t *restrict Si = S->i ;
+
+    //--------------------------------------------------------------------------
+    // phase 2: compute the entries and vectors of S
+    //--------------------------------------------------------------------------
+
+    switch (S_iso ? 0 : asize)
+    {
+        case 0 : // iso matrices of any type; only merge the pattern
+            memcpy (S->x, A->x, asize) ;
+            #define GB_COPY(pS,Xx,pX)
+            #include "GB_wait_merge_template.c"
+            break ;
+
+        case GB_1BYTE : // bool, uint8, int8, and user defined types of size 1
+        {
+            uint8_t *restrict Sx = (uint8_t *) S->x ;
+            const uint8_t *restrict Ax = (uint8_t *) A->x ;
+            const uint8_t *restrict Tx = (uint8_t *) T->x ;
+            #define GB_COPY(pS,Xx,pX) Sx [pS] = Xx [pX]
+            #include "GB_wait_merge_template.c"
+        }
+        break ;
+
+        case GB_2BYTE : // uint16, int16, and user-defined types of size 2
+        {
+            uint16_t *restrict Sx = (uint16_t *) S->x ;
+            const uint16_t *restrict Ax = (uint16_t *) A->x ;
+            const uint16_t *restrict Tx = (uint16_t *) T->x ;
+            #define GB_COPY(pS,Xx,pX) Sx [pS] = Xx [pX]
+            #include "GB_wait_merge_template.c"
+        }
+        break ;
+
+        case GB_4BYTE : // uint32, int32, float, and 4-byte user
+        {
+            uint32_t *restrict Sx = (uint32_t *) S->x ;
+            const uint32_t *restrict Ax = (uint32_t *) A->x ;
+            const uint32_t *restrict Tx = (uint32_t *) T->x ;
+            #define GB_COPY(pS,Xx,pX) Sx [pS] = Xx [pX]
+            #include "GB_wait_merge_template.c"
+        }
+        break ;
+
+        case GB_8BYTE : // uint64, int64, double, float complex, and 8-byte user
+        {
+            uint64_t *restrict Sx = (uint64_t *) S->x ;
+            const uint64_t *restrict Ax = (uint64_t *) A->x ;
+            const uint64_t *restrict Tx = (uint64_t *) T->x ;
+            #define GB_COPY(pS,Xx,pX) Sx [pS] = Xx [pX]
+            #include "GB_wait_merge_template.c"
+        }
+        break ;
+
+        case GB_16BYTE : // double complex, and user-defined types of size 16
+        {
+            GB_blob16 *restrict Sx = (GB_blob16 *) S->x ;
+            const GB_blob16 *restrict Ax = (GB_blob16 *) A->x ;
+            const GB_blob16 *restrict Tx = (GB_blob16 *) T->x ;
+            #define GB_COPY(pS,Xx,pX) Sx [pS] = Xx [pX]
+            #include "GB_wait_merge_template.c"
+        }
+        break ;
+
+        default : // user-defined types of arbitrary size
+        {
+            GB_void *restrict Sx = (GB_void *) S->x ;
+            const GB_void *restrict Ax = (GB_void *) A->x ;
+            const GB_void *restrict Tx = (GB_void *) T->x ;
+            #define GB_COPY(pS,Xx,pX) \
+                memcpy (Sx + (pS)*asize, Xx + (pX)*asize, asize)
+            #include "GB_wait_merge_template.c"
+        }
+        break ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize S
+    //--------------------------------------------------------------------------
+
+    Sp [snvec] = snz ;
+    S->nvec = snvec ;
+    S->nvec_nonempty = snvec ;
+    S->nvals = snz ;
+    S->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (S, "S = A+T from wait merge", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
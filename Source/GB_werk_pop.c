@@ -13,7 +13,8 @@
 // the stack to free it properly.  Freeing a werkspace in the middle of the
 // Werk stack also frees everything above it.  This is not a problem if that
 // space is also being freed, but the assertion below ensures that the freeing
-// werkspace from the Werk stack is done in LIFO order, like a stack.
+// werkspace from the Werk stack is done in LIFO order, like a stack.  The
+// same holds for werkspace allocated from the Werk arena of the Context.
 
 GB_CALLBACK_WERK_POP_PROTO (GB_werk_pop)
 {
@@ -24,14 +25,22 @@ GB_CALLBACK_WERK_POP_PROTO (GB_werk_pop)
         // nothing to do
     }
     else if (on_stack)
-    { 
-        // werkspace was allocated from the Werk stack
-        ASSERT ((*size_allocated) == GB_ROUND8 (nitems * size_of_item)) ;
+    {
         ASSERT (Werk != NULL) ;
         ASSERT ((*size_allocated) % 8 == 0) ;
-        ASSERT (((GB_void *) p) + (*size_allocated) ==
-                Werk->Stack + Werk->pwerk) ;
-        Werk->pwerk = ((GB_void *) p) - Werk->Stack ;
+        GB_void *pstack = (GB_void *) p ;
+        if (pstack >= Werk->Stack && pstack < Werk->Stack + GB_WERK_SIZE)
+        { 
+            // werkspace was allocated from the Werk stack
+            ASSERT ((*size_allocated) == GB_ROUND8 (nitems * size_of_item)) ;
+            ASSERT (pstack + (*size_allocated) == Werk->Stack + Werk->pwerk) ;
+            Werk->pwerk = pstack - Werk->Stack ;
+        }
+        else
+        { 
+            // werkspace was allocated from the Werk arena of the Context
+            GB_Context_werk_pop (Werk, p) ;
+        }
         (*size_allocated) = 0 ;
     }
     else
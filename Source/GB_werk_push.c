@@ -9,8 +9,11 @@
 
 #include "GB.h"
 
-// The werkspace is allocated from the Werk static if it small enough and space
-// is available.  Otherwise it is allocated by malloc.
+// The werkspace is allocated from the Werk stack if it small enough and space
+// is available.  Otherwise it is allocated from the Werk arena of the Context
+// of this user thread, if the arena is enabled, large enough, and not in use
+// by another user thread (see GB_Context.c).  If all else fails, it is
+// allocated by malloc.
 
 GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push)
 {
@@ -59,10 +62,28 @@ GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push)
         (*size_allocated) = size ;
         return ((void *) p) ;
     }
-    else
-    { 
-        // allocate the werkspace from malloc
-        return (GB_malloc_memory (nitems, size_of_item, size_allocated)) ;
+
+    if (Werk != NULL
+        #ifdef GBCOVER
+        && (GB_Global_hack_get (1) == 0)
+        #endif
+    )
+    {
+        // try to allocate the werkspace from the Werk arena
+        if (GB_size_t_multiply (&size, nitems, size_of_item))
+        {
+            size = GB_ROUND8 (GB_IMAX (size, 8)) ;
+            void *p = GB_Context_werk_push (Werk, size) ;
+            if (p != NULL)
+            { 
+                (*on_stack) = true ;
+                (*size_allocated) = size ;
+                return (p) ;
+            }
+        }
     }
+
+    // allocate the werkspace from malloc
+    return (GB_malloc_memory (nitems, size_of_item, size_allocated)) ;
 }
 
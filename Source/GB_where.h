@@ -33,8 +33,10 @@
     /* get the pointer to where any error will be logged */         \
     Werk->logger_handle = NULL ;                                    \
     Werk->logger_size_handle = NULL ;                               \
-    /* initialize the Werk stack */                                 \
-    Werk->pwerk = 0 ;
+    /* initialize the Werk stack; no Werk arena is in use */        \
+    Werk->pwerk = 0 ;                                               \
+    Werk->arena_Context = NULL ;                                    \
+    Werk->parena = 0 ;
 
 // C is a matrix, vector, scalar, or descriptor
 #define GB_WHERE(C,where_string)                                    \
@@ -67,6 +67,12 @@ static GrB_Info GB_desc_get
             if ((*value) != GrB_DEFAULT) (*value) = GxB_SECURE_IMPORT ;
             break ;
 
+        case GxB_SHALLOW_DESERIALIZE : 
+
+            (*value) = (int32_t) ((desc == NULL) ?
+                GrB_DEFAULT : desc->shallow_deserialize) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
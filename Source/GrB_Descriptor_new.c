@@ -54,6 +54,7 @@ GrB_Info GrB_Descriptor_new     // create a new descriptor
     desc->do_sort = false ;        // do not sort in GrB_mxm and others
     desc->compression = GxB_DEFAULT ;
     desc->import = GxB_DEFAULT ;   // trust input data in GxB import/deserialize
+    desc->shallow_deserialize = false ; // always copy the blob in deserialize
     return (GrB_SUCCESS) ;
 }
 
@@ -127,6 +127,11 @@ static GrB_Info GB_desc_set
                 (value == GrB_DEFAULT) ? GxB_FAST_IMPORT : GxB_SECURE_IMPORT ;
             break ;
 
+        case GxB_SHALLOW_DESERIALIZE : 
+
+            desc->shallow_deserialize = (value != GrB_DEFAULT) ;
+            break ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
@@ -127,6 +127,11 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            (*value) = (int) GB_jitifyer_get_async ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -197,6 +202,34 @@ GrB_Info GrB_Global_get_Scalar
                     GB_INT64_code, Werk) ;
                 break ;
 
+            case GxB_MEMORY_POOL_LIMIT : 
+
+                i64 = GB_memory_pool_limit_get ( ) ;
+                info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                    GB_INT64_code, Werk) ;
+                break ;
+
+            case GxB_MEMORY_POOL_BYTES : 
+
+                GB_memory_pool_stats (&i64, NULL, NULL) ;
+                info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                    GB_INT64_code, Werk) ;
+                break ;
+
+            case GxB_MEMORY_POOL_HITS : 
+
+                GB_memory_pool_stats (NULL, &i64, NULL) ;
+                info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                    GB_INT64_code, Werk) ;
+                break ;
+
+            case GxB_MEMORY_POOL_MISSES : 
+
+                GB_memory_pool_stats (NULL, NULL, &i64) ;
+                info = GB_setElement ((GrB_Matrix) value, NULL, &i64, 0, 0,
+                    GB_INT64_code, Werk) ;
+                break ;
+
             default : 
 
                 return (GrB_INVALID_VALUE) ;
@@ -311,6 +344,11 @@ static GrB_Info GB_global_string_get (const char **value, int field)
             (*value) = GB_jitifyer_get_error_log ( ) ;
             break ;
 
+        case GxB_JIT_RECORD : 
+
+            (*value) = GB_jitifyer_get_record ( ) ;
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             (*value) = GB_jitifyer_get_cache_path ( ) ;
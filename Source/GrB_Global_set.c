@@ -66,6 +66,11 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_jitifyer_set_use_cmake ((bool) value) ;
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            GB_jitifyer_set_async ((bool) value) ;
+            break ;
+
         case GxB_JIT_C_CONTROL : 
 
             GB_jitifyer_set_control (value) ;
@@ -138,6 +143,15 @@ GrB_Info GrB_Global_set_Scalar
             }
             break ;
 
+        case GxB_MEMORY_POOL_LIMIT : 
+
+            info = GrB_Scalar_extractElement_INT64 (&i64value, value) ;
+            if (info == GrB_SUCCESS)
+            {
+                info = GB_memory_pool_limit_set (i64value) ;
+            }
+            break ;
+
         default : 
 
             info = GrB_Scalar_extractElement_INT32 (&ivalue, value) ;
@@ -206,6 +220,10 @@ GrB_Info GrB_Global_set_String
 
             return (GB_jitifyer_set_error_log (value)) ;
 
+        case GxB_JIT_RECORD : 
+
+            return (GB_jitifyer_set_record (value)) ;
+
         case GxB_JIT_CACHE_PATH : 
 
             return (GB_jitifyer_set_cache_path (value)) ;
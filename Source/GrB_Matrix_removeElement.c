@@ -222,6 +222,10 @@ GrB_Info GB_Matrix_removeElement
         return (GrB_SUCCESS) ;
     }
 
+    // C is modified in place, so it cannot have any shallow components
+    GrB_Info info ;
+    GB_OK (GB_unshallow (C)) ;
+
     // remove the entry
     if (GB_removeElement (C, i, j))
     { 
@@ -232,7 +236,6 @@ GrB_Info GB_Matrix_removeElement
     // assemble any pending tuples; zombies are OK
     if (C_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait (C, "C (removeElement:pending tuples)", Werk)) ;
         ASSERT (!GB_ZOMBIES (C)) ;
         ASSERT (!GB_JUMBLED (C)) ;
@@ -18,6 +18,8 @@
 GrB_Info GrB_finalize ( )
 { 
     GB_jitifyer_finalize ( ) ;
+    GB_memory_pool_finalize ( ) ;
+    GB_Context_werk_free (GxB_CONTEXT_WORLD) ;
     return (GrB_SUCCESS) ;
 }
 
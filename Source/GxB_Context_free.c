@@ -34,8 +34,9 @@ GrB_Info GxB_Context_free           // free a Context
         if (Context != NULL)
         {
             size_t header_size = Context->header_size ;
-            // free the Context user_name
+            // free the Context user_name and its Werk arena
             GB_FREE (&(Context->user_name), Context->user_name_size) ;
+            GB_Context_werk_free (Context) ;
             if (header_size > 0)
             { 
                 Context->magic = GB_FREED ;  // to help detect dangling pointers
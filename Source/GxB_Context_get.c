@@ -46,6 +46,11 @@ GrB_Info GxB_Context_get_INT32      // get a parameter of a Context
             (*value) = GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            (*value) = (int32_t) GB_Context_werk_size_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -146,6 +151,17 @@ GrB_Info GxB_Context_get            // get a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int *value = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (int) GB_Context_werk_size_get (Context) ;
+            }
+            break ;
+
         case GxB_CONTEXT_CHUNK :            // same as GxB_CHUNK
 
             {
@@ -56,6 +56,11 @@ GrB_Info GxB_Context_get_Scalar
             ivalue= GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            ivalue = (int32_t) GB_Context_werk_size_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -163,6 +168,11 @@ GrB_Info GxB_Context_get_INT
             (*value) = GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            (*value) = (int32_t) GB_Context_werk_size_get (Context) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
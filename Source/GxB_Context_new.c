@@ -48,6 +48,14 @@ GrB_Info GxB_Context_new            // create a new Context
     Context->nthreads_max = GB_Context_nthreads_max_get (NULL) ;
     Context->chunk = GB_Context_chunk_get (NULL) ;
     Context->gpu_id = GB_Context_gpu_id_get (NULL) ;
+    Context->werk_arena_max = GB_Context_werk_size_get (NULL) ;
+
+    // the Werk arena is allocated when first used
+    Context->werk_arena = NULL ;
+    Context->werk_arena_size = 0 ;
+    Context->werk_arena_want = 0 ;
+    Context->werk_arena_busy = 0 ;
+    Context->werk_arena_owner = NULL ;
 
     // return the result
     (*Context_handle) = Context ;
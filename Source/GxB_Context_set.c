@@ -45,6 +45,11 @@ GrB_Info GxB_Context_set_INT32      // set a parameter in a Context
             GB_Context_gpu_id_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            GB_Context_werk_size_set (Context, value) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -140,6 +145,16 @@ GrB_Info GxB_Context_set            // set a parameter in a Context
             }
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                GB_Context_werk_size_set (Context, value) ;
+                va_end (ap) ;
+            }
+            break ;
+
         case GxB_CONTEXT_CHUNK :            // same as GxB_CHUNK
 
             {
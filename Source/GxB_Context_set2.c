@@ -43,6 +43,7 @@ GrB_Info GxB_Context_set_Scalar
 
         case GxB_CONTEXT_NTHREADS :         // same as GxB_NTHREADS
         case GxB_CONTEXT_GPU_ID :           // same as GxB_GPU_ID
+        case GxB_CONTEXT_WERK_SIZE : 
             info = GrB_Scalar_extractElement_INT32 (&ivalue, value) ;
             break ;
 
@@ -74,6 +75,11 @@ GrB_Info GxB_Context_set_Scalar
             GB_Context_gpu_id_set (Context, ivalue) ;
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            GB_Context_werk_size_set (Context, ivalue) ;
+            break ;
+
         case GxB_CONTEXT_CHUNK :            // same as GxB_CHUNK
 
             GB_Context_chunk_set (Context, dvalue) ;
@@ -155,6 +161,11 @@ GrB_Info GxB_Context_set_INT
             GB_Context_gpu_id_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_WERK_SIZE : 
+
+            GB_Context_werk_size_set (Context, value) ;
+            break ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
@@ -84,6 +84,12 @@ GrB_Info GxB_Desc_get_INT32     // get a parameter from a descriptor
             if ((*value) != GxB_DEFAULT) (*value) = GxB_SECURE_IMPORT ;
             break ;
 
+        case GxB_SHALLOW_DESERIALIZE : 
+
+            (*value) = (int32_t) ((desc == NULL) ?
+                GxB_DEFAULT : desc->shallow_deserialize) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -227,6 +233,19 @@ GrB_Info GxB_Desc_get           // get a parameter from a descriptor
             }
             break ;
 
+        case GxB_SHALLOW_DESERIALIZE : 
+
+            {
+                va_start (ap, field) ;
+                int *shallow = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (shallow) ;
+                int s = (desc == NULL) ? GxB_DEFAULT :
+                    desc->shallow_deserialize ;
+                (*shallow) = s ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
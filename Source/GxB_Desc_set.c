@@ -152,6 +152,11 @@ GrB_Info GxB_Desc_set_INT32     // set a parameter in a descriptor
                 (value == GxB_DEFAULT) ? GxB_FAST_IMPORT : GxB_SECURE_IMPORT ;
             break ;
 
+        case GxB_SHALLOW_DESERIALIZE : 
+
+            desc->shallow_deserialize = (value != GxB_DEFAULT) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -345,16 +350,27 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
             }
             break ;
 
+        case GxB_SHALLOW_DESERIALIZE : 
+
+            {
+                va_start (ap, field) ;
+                desc->shallow_deserialize = (va_arg (ap, int) != GxB_DEFAULT) ;
+                va_end (ap) ;
+            }
+            break ;
+
         default : 
 
             GB_ERROR (GrB_INVALID_VALUE,
                 "invalid descriptor field [%d], must be one of:\n"
                 "GrB_OUTP [%d], GrB_MASK [%d], GrB_INP0 [%d], GrB_INP1 [%d]\n"
                 "GxB_NTHREADS [%d], GxB_CHUNK [%d], GxB_AxB_METHOD [%d]\n"
-                "GxB_SORT [%d], or GxB_COMPRESSION [%d]\n",
+                "GxB_SORT [%d], GxB_COMPRESSION [%d], GxB_IMPORT [%d],\n"
+                "or GxB_SHALLOW_DESERIALIZE [%d]\n",
                 (int) field, (int) GrB_OUTP, (int) GrB_MASK, (int) GrB_INP0,
                 (int) GrB_INP1, (int) GxB_NTHREADS, (int) GxB_CHUNK,
-                (int) GxB_AxB_METHOD, (int) GxB_SORT, (int) GxB_COMPRESSION) ;
+                (int) GxB_AxB_METHOD, (int) GxB_SORT, (int) GxB_COMPRESSION,
+                (int) GxB_IMPORT, (int) GxB_SHALLOW_DESERIALIZE) ;
     }
 
     return (GrB_SUCCESS) ;
@@ -116,6 +116,11 @@ GrB_Info GxB_Global_Option_get_INT32    // gets the current global option
             (*value) = (int32_t) GB_jitifyer_get_use_cmake ( ) ;
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            (*value) = (int32_t) GB_jitifyer_get_async ( ) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -339,6 +344,11 @@ GrB_Info GxB_Global_Option_get_CHAR     // gets the current global option
             (*value) = GB_jitifyer_get_error_log ( ) ;
             break ;
 
+        case GxB_JIT_RECORD : 
+
+            (*value) = GB_jitifyer_get_record ( ) ;
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             (*value) = GB_jitifyer_get_cache_path ( ) ;
@@ -932,6 +942,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            {
+                va_start (ap, field) ;
+                bool *async = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (async) ;
+                (*async) = GB_jitifyer_get_async ( ) ;
+            }
+            break ;
+
         case GxB_JIT_ERROR_LOG : 
 
             {
@@ -943,6 +964,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_JIT_RECORD : 
+
+            {
+                va_start (ap, field) ;
+                const char **record = va_arg (ap, const char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (record) ;
+                (*record) = GB_jitifyer_get_record ( ) ;
+            }
+            break ;
+
         case GxB_JIT_CACHE_PATH : 
 
             {
@@ -79,6 +79,11 @@ GrB_Info GxB_Global_Option_set_INT32      // set a global default option
             GB_jitifyer_set_use_cmake ((bool) value) ;
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            GB_jitifyer_set_async ((bool) value) ;
+            break ;
+
         case GxB_JIT_C_CONTROL : 
 
             GB_jitifyer_set_control ((int) value) ;
@@ -271,6 +276,10 @@ GrB_Info GxB_Global_Option_set_CHAR      // set a global default option
 
             return (GB_jitifyer_set_error_log (value)) ;
 
+        case GxB_JIT_RECORD : 
+
+            return (GB_jitifyer_set_record (value)) ;
+
         case GxB_JIT_CACHE_PATH : 
 
             return (GB_jitifyer_set_cache_path (value)) ;
@@ -554,6 +563,16 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_JIT_ASYNC : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_jitifyer_set_async ((bool) value) ;
+            }
+            break ;
+
         case GxB_JIT_C_CONTROL : 
 
             {
@@ -573,6 +592,15 @@ GrB_Info GxB_Global_Option_set      // set a global default option
                 return (GB_jitifyer_set_error_log (error_log)) ;
             }
 
+        case GxB_JIT_RECORD : 
+
+            {
+                va_start (ap, field) ;
+                char *record = va_arg (ap, char *) ;
+                va_end (ap) ;
+                return (GB_jitifyer_set_record (record)) ;
+            }
+
         case GxB_JIT_CACHE_PATH : 
 
             {
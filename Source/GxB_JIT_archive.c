@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// GxB_JIT_archive: build a single library holding the JIT kernels in a manifest
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_JIT_archive compiles each kernel listed in the manifest (in the same
+// format as GxB_JIT_compile) and links them all into a single library, the
+// JIT archive, in the lib folder of the JIT cache.  Up to ncompilers compilers
+// run at the same time.  The source of each kernel must already be in the JIT
+// cache, from a prior run of GraphBLAS.  Kernels that fail to compile are left
+// out of the archive.  Any prior archive in the JIT cache is replaced.
+
+// The archive is not loaded by this method.  It is loaded by GrB_init (or when
+// the JIT cache path is set), with a single dlopen, and all of its kernels are
+// then used just like PreJIT kernels.
+
+// Kernels are compiled only if the JIT control is GxB_JIT_ON; otherwise, this
+// method does nothing.
+
+// Error cases:
+// If manifest is NULL, GrB_NULL_POINTER is returned.
+// If the manifest cannot be read or is not valid, or if the archive cannot be
+// created, GrB_INVALID_VALUE is returned.
+// If the JIT compiles its kernels with cmake, GrB_NOT_IMPLEMENTED is returned.
+
+#include "GB.h"
+#include "GB_jitifyer.h"
+
+GrB_Info GxB_JIT_archive            // build a JIT archive
+(
+    const char *manifest,           // file with the list of kernels
+    int32_t ncompilers              // # of compilers to run at the same time
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (manifest) ;
+
+    //--------------------------------------------------------------------------
+    // build the archive
+    //--------------------------------------------------------------------------
+
+    return (GB_jitifyer_archive (manifest, ncompilers)) ;
+}
+
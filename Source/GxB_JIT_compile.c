@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// GxB_JIT_compile: compile and load the JIT kernels listed in a manifest
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_JIT_compile warms up the JIT cache.  The manifest is a text file with
+// one kernel per line: the hash of the kernel (16 hexadecimal digits) followed
+// by the kernel name, such as:
+//
+//      # comment
+//      8cf4c8b4a89b3b14 GB_jit__AxB_dot2__2c1f000bba0bbac7__plus_times_fp64
+//
+// Each kernel whose compiled library is not in the JIT cache is compiled, with
+// up to ncompilers compilers running at the same time.  The source of each
+// kernel must already be in the JIT cache, from a prior run of GraphBLAS.
+// Built-in kernels are then loaded, so they are ready for their first use.
+// User-defined kernels are compiled but loaded when they are first used.
+
+// Kernels are compiled only if the JIT control is GxB_JIT_ON, and loaded only
+// if it is GxB_JIT_LOAD or GxB_JIT_ON.  Otherwise, this method does nothing.
+// Kernels that cannot be compiled or loaded are skipped.
+
+// Error cases:
+// If manifest is NULL, GrB_NULL_POINTER is returned.
+// If the manifest cannot be read or is not valid, GrB_INVALID_VALUE is
+// returned.
+
+#include "GB.h"
+#include "GB_jitifyer.h"
+
+GrB_Info GxB_JIT_compile            // compile and load JIT kernels
+(
+    const char *manifest,           // file with the list of kernels
+    int32_t ncompilers              // # of compilers to run at the same time
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (manifest) ;
+
+    //--------------------------------------------------------------------------
+    // compile and load the kernels
+    //--------------------------------------------------------------------------
+
+    return (GB_jitifyer_compile (manifest, ncompilers)) ;
+}
+
@@ -26,7 +26,8 @@ GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
                         // type of C.
     const void *blob,       // the blob
     GrB_Index blob_size,    // size of the blob
-    const GrB_Descriptor desc       // to control # of threads used
+    const GrB_Descriptor desc       // to control # of threads used, and
+                                    // whether C may point into the blob
 )
 { 
 
@@ -39,13 +40,14 @@ GrB_Info GxB_Matrix_deserialize     // deserialize blob into a GrB_Matrix
     GB_RETURN_IF_NULL (blob) ;
     GB_RETURN_IF_NULL (C) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_DESERIALIZE (desc, shallow) ;
 
     //--------------------------------------------------------------------------
     // deserialize the blob into a matrix
     //--------------------------------------------------------------------------
 
     info = GB_deserialize (C, type, (const GB_void *) blob,
-        (size_t) blob_size) ;
+        (size_t) blob_size, shallow, NULL, NULL) ;
     GB_BURBLE_END ;
     return (info) ;
 }
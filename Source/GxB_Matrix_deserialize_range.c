@@ -0,0 +1,57 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_range: create a matrix from part of a blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates a matrix C from the vectors kfirst:klast of the matrix A held in the
+// blob: C = A (:,kfirst:klast) if A was held by column when serialized, or
+// C = A (kfirst:klast,:) if A was held by row.  Only the compressed blocks of
+// the blob that hold these vectors are decompressed.  Otherwise, this method
+// is identical to GxB_Matrix_deserialize.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_range   // deserialize part of a blob
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the blob
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the blob holds a
+                        // matrix of user-defined type.  May be NULL if blob
+                        // holds a built-in type; otherwise must match the
+                        // type of C.
+    const void *blob,       // the blob
+    GrB_Index blob_size,    // size of the blob
+    GrB_Index kfirst,       // first vector to deserialize
+    GrB_Index klast,        // last vector to deserialize
+    const GrB_Descriptor desc       // to control # of threads used, and
+                                    // whether C may point into the blob
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_range (&C, type, blob, blob_size, "
+        "kfirst, klast, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_range") ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    GB_GET_DESCRIPTOR_DESERIALIZE (desc, shallow) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the vectors kfirst:klast from the blob into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_range (C, type, (const GB_void *) blob,
+        (size_t) blob_size, kfirst, klast, shallow, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
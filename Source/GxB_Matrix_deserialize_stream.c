@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_stream: create a matrix from a stream of bytes
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a stream of bytes
+
+// Identical to GxB_Matrix_deserialize, except that the blob is read from the
+// stream by the reader function, in order and in pieces, and the complete blob
+// is never held in memory.  Each array is decompressed block by block directly
+// into the matrix C.  Exactly the bytes of one blob are read from the stream.
+// The GxB_SHALLOW_DESERIALIZE descriptor setting is ignored.  Example usage,
+// with a POSIX file descriptor:
+
+/*
+    bool my_read (void *stream, void *data, size_t size)
+    {
+        int fd = *((int *) stream) ;
+        char *p = data ;
+        while (size > 0)
+        {
+            ssize_t n = read (fd, p, size) ;
+            if (n <= 0) return (false) ;
+            p += n ;
+            size -= n ;
+        }
+        return (true) ;
+    }
+
+    int fd = open ("A.bin", O_RDONLY) ;
+    GxB_Matrix_deserialize_stream (&A, atype, my_read, &fd, NULL) ;
+    close (fd) ;
+*/
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize a stream into a matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_stream_read_function reader,    // function to read from the stream
+    void *stream,                   // stream passed to the reader
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_stream (&C, type, reader, stream, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_stream") ;
+    GB_RETURN_IF_NULL (reader) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the stream into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize (C, type, NULL, 0, false, reader, stream) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
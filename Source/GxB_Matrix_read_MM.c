@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_read_MM: read a matrix from a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reads a matrix in the Matrix Market coordinate format from a file that has
+// already been opened for reading, in parallel.  If the type is NULL, the type
+// of C is determined by the file: GrB_BOOL (pattern), GrB_INT64 (integer),
+// GrB_FP64 (real), or GxB_FC64 (complex).  Otherwise the entries are typecast
+// to the given built-in type.  The descriptor controls the # of threads used.
+// Example usage:
+
+/*
+    FILE *f = fopen ("A.mtx", "r") ;
+    GrB_Matrix A = NULL ;
+    GxB_Matrix_read_MM (&A, NULL, f, NULL) ;
+    fclose (f) ;
+*/
+
+#include "GB.h"
+#include "GB_mm.h"
+
+GrB_Info GxB_Matrix_read_MM     // read a matrix from a Matrix Market file
+(
+    // output:
+    GrB_Matrix *C,              // output matrix read from the file
+    // input:
+    GrB_Type type,              // type of C, or NULL to use the file's type
+    FILE *f,                    // file to read from, already open
+    const GrB_Descriptor desc   // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_read_MM (&C, type, f, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_read_MM") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (f) ;
+    GB_RETURN_IF_FAULTY (type) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // read the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_mm_read (C, type, f, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_stream: serialize a matrix to a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// serialize a GrB_Matrix to a stream of bytes
+
+// This method is similar to GxB_Matrix_serialize, except that the blob is not
+// returned.  Instead, it is passed to the writer function, in order and in
+// pieces, and the complete blob is never held in memory.  The bytes passed to
+// the writer form a valid blob, so the stream can be read back with
+// GxB_Matrix_deserialize_stream, or loaded into memory and deserialized with
+// GxB_Matrix_deserialize.  The descriptor
+// selects the compression method and controls the # of threads used.  Example
+// usage, with a POSIX file descriptor:
+
+/*
+    bool my_write (void *stream, const void *data, size_t size)
+    {
+        int fd = *((int *) stream) ;
+        const char *p = data ;
+        while (size > 0)
+        {
+            ssize_t n = write (fd, p, size) ;
+            if (n <= 0) return (false) ;
+            p += n ;
+            size -= n ;
+        }
+        return (true) ;
+    }
+
+    int fd = open ("A.bin", O_WRONLY | O_CREAT | O_TRUNC, 0644) ;
+    GxB_Matrix_serialize_stream (my_write, &fd, A, NULL) ;
+    close (fd) ;
+*/
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    GxB_stream_write_function writer,   // function to write to the stream
+    void *stream,                   // stream passed to the writer
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_stream (writer, stream, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_stream") ;
+    GB_RETURN_IF_NULL (writer) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix to the stream
+    //--------------------------------------------------------------------------
+
+    size_t blob_size = 0 ;
+    info = GB_serialize (NULL, &blob_size, A, method, writer, stream, Werk) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
+
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_write_MM: write a matrix to a Matrix Market file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Writes a matrix in the Matrix Market coordinate general format, to a file
+// that has already been opened for writing.  The entries are formatted in
+// parallel.  The matrix must have a built-in type.  The descriptor controls
+// the # of threads used.  Example usage:
+
+/*
+    FILE *f = fopen ("A.mtx", "w") ;
+    GxB_Matrix_write_MM (A, f, NULL) ;
+    fclose (f) ;
+*/
+
+#include "GB.h"
+#include "GB_mm.h"
+
+GrB_Info GxB_Matrix_write_MM    // write a matrix to a Matrix Market file
+(
+    GrB_Matrix A,               // matrix to write
+    FILE *f,                    // file to write to, already open
+    const GrB_Descriptor desc   // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_write_MM (A, f, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_write_MM") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL (f) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // write the matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_mm_write (A, f, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,18 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_outer.c: JIT kernel for C+=A*B' outer-product method
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C+=A*B': outer product, C is full, A and B are sparse/hyper
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_OUTER_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_AXB_OUTER_PROTO (GB_jit_kernel)
+{
+    #include "GB_AxB_outer_meta.c"
+    return (GrB_SUCCESS) ;
+}
+
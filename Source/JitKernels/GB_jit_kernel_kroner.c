@@ -0,0 +1,20 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_kroner.c: C = kron (A,B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C(iC,jC) = A(iA,jA) * B(iB,jB), where the operator is not positional
+#define GB_KRONER_OP(Cx,pC,aij,bij,iA,jA,iB,jB) \
+    GB_EWISEOP (Cx, pC, aij, bij, 0, 0)
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_KRONER_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_KRONER_PROTO (GB_jit_kernel)
+{
+    #include "GB_kroner_template.c"
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,18 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_select_masked:  select masked JIT kernel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_SELECT_MASKED_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_SELECT_MASKED_PROTO (GB_jit_kernel)
+{
+    #if GB_DEPENDS_ON_Y
+    GB_Y_TYPE y = *((GB_Y_TYPE *) ythunk) ;
+    #endif
+    #include "GB_select_masked_template.c"
+    return (GrB_SUCCESS) ;
+}
@@ -512,6 +512,29 @@ bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
 
 bool iso ;              // true if all entries have the same value
 
+//------------------------------------------------------------------------------
+// pattern version and cached saxpy3 schedule
+//------------------------------------------------------------------------------
+
+// A->pattern_version is a unique value given to A by GB_PATTERN_CHANGED each
+// time the pattern of A is allocated, freed, or modified in place.  Two
+// matrices with the same pattern_version have the same pattern.  It is never
+// zero for a matrix created by GB_new.
+
+// A->saxpy3_schedule is a list of tasks constructed by GB_AxB_saxpy3 for the
+// last C=A*B that it computed with this matrix as B.  It is reused if C=A*B
+// is computed again with no change to the patterns of A, B, and M.  It is
+// freed along with the pattern of A.
+
+// A->ek_slice_cache is the last slice of A computed by GB_ek_slice, if it had
+// many tasks.  It is reused if A is sliced again into the same number of
+// tasks with no change to its pattern, and it is freed along with the
+// pattern of A.
+
+int64_t pattern_version ;   // unique version of the pattern of A
+GB_saxpy3_schedule saxpy3_schedule ;    // cached saxpy3 tasks, or NULL
+GB_ek_slice_cache ek_slice_cache ;      // cached GB_ek_slice, or NULL
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
@@ -462,6 +462,7 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int compression ;       // compression method for GxB_Matrix_serialize
     bool do_sort ;          // if nonzero, do the sort in GrB_mxm
     int import ;            // if zero (default), trust input data
+    bool shallow_deserialize ;  // if true, deserialize may point into blob
 } ;
 
 struct GB_Context_opaque    // content of GxB_Context
@@ -478,6 +479,13 @@ struct GB_Context_opaque    // content of GxB_Context
     // GPU:
     int gpu_id ;            // if negative: use the CPU only; do not use a GPU
                             // if >= 0: then use GPU gpu_id
+    // Werk arena (see GB_Context.c):
+    GB_void *werk_arena ;   // werkspace arena, kept between calls
+    size_t werk_arena_size ;    // allocated size of werk_arena
+    size_t werk_arena_want ;    // size needed when the arena was too small
+    size_t werk_arena_max ;     // max size of werk_arena; 0 to disable it
+    int64_t werk_arena_busy ;   // nonzero if in use by a user thread
+    void *werk_arena_owner ;    // the Werk that holds the arena, if busy
 } ;
 
 //------------------------------------------------------------------------------
@@ -506,6 +514,24 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
 
 typedef struct GB_Pending_struct *GB_Pending ;
 
+//------------------------------------------------------------------------------
+// GB_saxpy3_schedule: cached tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+// The content of this struct is defined in GB_AxB_saxpy3.h.  It is not used
+// by any JIT kernel.
+
+typedef struct GB_saxpy3_schedule_struct *GB_saxpy3_schedule ;
+
+//------------------------------------------------------------------------------
+// GB_ek_slice_cache: cached slice of a matrix for GB_ek_slice
+//------------------------------------------------------------------------------
+
+// The content of this struct is defined in GB_ek_slice.h.  It is not used
+// by any JIT kernel.
+
+typedef struct GB_ek_slice_cache_struct *GB_ek_slice_cache ;
+
 //------------------------------------------------------------------------------
 // scalar, vector, and matrix types
 //------------------------------------------------------------------------------
@@ -12,6 +12,16 @@
 #include "GB_unused.h"
 #include "GB_AxB_dot_cij.h"
 
+// GB_DOT2_CIJ_UPDATE: Cx [pC] += cij, when C(i,j) is already present in C.
+// The generic kernel defines its own method.
+#ifndef GB_DOT2_CIJ_UPDATE
+    #if GB_IS_ANY_PAIR_SEMIRING
+    #define GB_DOT2_CIJ_UPDATE(Cx,pC,cij)
+    #else
+    #define GB_DOT2_CIJ_UPDATE(Cx,pC,cij) GB_UPDATE (Cx [pC], cij)
+    #endif
+#endif
+
 {
 
     //--------------------------------------------------------------------------
@@ -23,7 +33,11 @@
     // dimensions.  The C bitmap/full matrix is converted back into a sparse or
     // hypersparse matrix when done.
 
-    int64_t cnvals = 0 ;
+    // If C is bitmap and no mask is present, C may already have entries on
+    // input, for C+=A'*B computed in-place.  The new results are combined
+    // with these entries with GB_DOT2_CIJ_UPDATE.
+
+    int64_t cnvals = C->nvals ;
 
     ASSERT (GB_IS_BITMAP (C) || GB_IS_FULL (C)) ;
     int8_t *restrict Cb = C->b ;
@@ -15,7 +15,11 @@
 // If A_NOT_TRANSPOSED is #defined, then C=A*B or C<#M>=A*B is computed.
 // In this case A is bitmap or full, and B is sparse.
 
-// C is bitmap or full.
+// C is bitmap or full.  If C is bitmap and no mask is present, C may
+// already hold entries on input, and C+=A'*B is computed in-place.  The
+// bitmap Cb is then not cleared, and new results are accumulated into any
+// entry C(i,j) already present.  Otherwise, the bitmap of C has been
+// calloc'ed, or it is cleared below when the mask is present.
 
 // GB_DOT_ALWAYS_SAVE_CIJ: C(i,j) = cij
 #undef GB_DOT_ALWAYS_SAVE_CIJ
@@ -26,12 +30,20 @@
         GB_PUTC (cij, Cx, pC) ;         \
     }
 #else
-    #define GB_DOT_ALWAYS_SAVE_CIJ      \
-    {                                   \
-        /* Cx [pC] = cij */             \
-        GB_PUTC (cij, Cx, pC) ;         \
-        Cb [pC] = 1 ;                   \
-        task_cnvals++ ;                 \
+    #define GB_DOT_ALWAYS_SAVE_CIJ              \
+    {                                           \
+        if (Cb [pC])                            \
+        {                                       \
+            /* Cx [pC] += cij */                \
+            GB_DOT2_CIJ_UPDATE (Cx, pC, cij) ;  \
+        }                                       \
+        else                                    \
+        {                                       \
+            /* Cx [pC] = cij */                 \
+            GB_PUTC (cij, Cx, pC) ;             \
+            Cb [pC] = 1 ;                       \
+            task_cnvals++ ;                     \
+        }                                       \
     }
 #endif
 
@@ -55,6 +67,36 @@
 #error "mask undefined"
 #endif
 
+// The tiled method is used only if A, B, and C are all full.  If A or B are
+// bitmap, each entry A(k,i) or B(k,j) must be tested before it is used, so
+// the inner loop over a block of C can no longer be vectorized, and cij
+// must start at the first k where both entries are present.  If C is bitmap
+// (A or B bitmap, or a mask present), Cb must also be set and C may be
+// updated in-place.  The non-tiled method below handles all of those cases.
+
+// Each thread of the tiled method holds a panel of A and a block of C in
+// local arrays on its stack, so it is used only if the types of those
+// entries have at most GB_DOT2_TILE_MAXSIZE bytes, which includes all
+// built-in types.  Larger user-defined types use the non-tiled method.
+
+#undef  GB_DOT2_TILE_MAXSIZE
+#define GB_DOT2_TILE_MAXSIZE 16
+
+#if ( GB_A_IS_FULL && GB_B_IS_FULL && GB_C_IS_FULL &&      \
+      !defined ( GB_A_NOT_TRANSPOSED ) && !defined ( GB_GENERIC ) &&  \
+      !GB_A_IS_PATTERN && !GB_B_IS_PATTERN && !GB_IS_ANY_MONOID )
+if (sizeof (GB_A2TYPE) <= GB_DOT2_TILE_MAXSIZE &&
+    sizeof (GB_C_TYPE) <= GB_DOT2_TILE_MAXSIZE)
+{
+
+    //--------------------------------------------------------------------------
+    // C=A'*B where A, B, and C are all full, via tiled dot products
+    //--------------------------------------------------------------------------
+
+    #include "GB_AxB_dot2_tiled_template.c"
+}
+else
+#endif
 #if ( !GB_A_IS_HYPER && !GB_B_IS_HYPER )
 {
 
@@ -111,7 +153,10 @@
                 if (bjnz == 0)
                 { 
                     // no work to do if B(:,j) is empty, except to clear Cb
+                    // of the mask, if present
+                    #if ( !GB_NO_MASK )
                     memset (&Cb [pC_start + kA_start], 0, kA_end - kA_start) ;
+                    #endif
                     continue ;
                 }
                 #if GB_A_IS_SPARSE
@@ -177,8 +222,8 @@
 
                 #else
 
-                // C is bitmap; M is not present
-                Cb [pC] = 0 ;
+                // C is bitmap; M is not present.  Cb [pC] is already
+                // initialized, and C(i,j) may be present on input.
 
                 #endif
                 { 
@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_tiled_template:  C=A'*B via tiled dot products, all full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A'*B where A, B, and C are all full, and no mask is present.  This method
+// is used in place of GB_AxB_dot2_template for typed kernels (factory and JIT)
+// whose multiply operator uses the values of both A and B, and whose monoid is
+// not ANY.  Each task computes C(kA_start:kA_end-1,kB_start:kB_end-1), one
+// block of GB_DOT2_TILE_I rows of C at a time.
+
+// The vectors A(:,i) for the rows of the block are split into panels of
+// GB_DOT2_TILE_K entries.  Each panel is typecasted and copied into the
+// workspace Apanel, transposed so that A(k,i0:i0+ni-1) is contiguous, and
+// small enough to remain in the L1 cache while it is used for all of the
+// vectors B(:,j) of the task.  The vectors B(:,j) are taken GB_DOT2_TILE_J
+// at a time, and the block C(i0:i0+ni-1,j0:j0+nj-1) is held in the array cij
+// while the panel is used, which the compiler can keep in SIMD registers, so
+// that each entry of the panel is loaded once for all nj vectors.  The inner
+// loop over the rows of the block has no dependencies and is vectorized for
+// all built-in semirings.
+
+// Apanel and cij are local arrays on the stack of each thread.  With entries
+// of at most GB_DOT2_TILE_MAXSIZE (16) bytes, they take at most 33 KB.
+
+// Each C(i,j) is still computed in order of k, so the result is identical to
+// the non-tiled method.  The terminal value of the monoid is not exploited,
+// since it would require a test in the innermost loop.  Once reached, the
+// terminal value of a monoid does not change, so the result is the same.
+
+#ifndef GB_DOT2_TILE_I
+#define GB_DOT2_TILE_I 16
+#endif
+
+#ifndef GB_DOT2_TILE_J
+#define GB_DOT2_TILE_J 4
+#endif
+
+#ifndef GB_DOT2_TILE_K
+#define GB_DOT2_TILE_K 128
+#endif
+
+{
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        const int a_tid = tid / nbslice ;
+        const int b_tid = tid % nbslice ;
+        const int64_t kA_start = A_slice [a_tid] ;
+        const int64_t kA_end   = A_slice [a_tid+1] ;
+        const int64_t kB_start = B_slice [b_tid] ;
+        const int64_t kB_end   = B_slice [b_tid+1] ;
+
+        // workspace for a panel of A, and a block of C
+        GB_DECLAREA (Apanel [GB_DOT2_TILE_K * GB_DOT2_TILE_I]) ;
+        GB_C_TYPE cij [GB_DOT2_TILE_J][GB_DOT2_TILE_I] ;
+
+        //----------------------------------------------------------------------
+        // C(i0:i0+ni-1,kB_start:kB_end-1) = A(:,i0:i0+ni-1)'*B(:,kB...)
+        //----------------------------------------------------------------------
+
+        for (int64_t i0 = kA_start ; i0 < kA_end ; i0 += GB_DOT2_TILE_I)
+        {
+            const int64_t ni = GB_IMIN (GB_DOT2_TILE_I, kA_end - i0) ;
+
+            for (int64_t k0 = 0 ; k0 < vlen ; k0 += GB_DOT2_TILE_K)
+            {
+                const int64_t nk = GB_IMIN (GB_DOT2_TILE_K, vlen - k0) ;
+
+                //--------------------------------------------------------------
+                // Apanel = A(k0:k0+nk-1,i0:i0+ni-1)', typecasted
+                //--------------------------------------------------------------
+
+                for (int64_t ii = 0 ; ii < ni ; ii++)
+                {
+                    const int64_t pA = (i0 + ii) * vlen + k0 ;
+                    for (int64_t kk = 0 ; kk < nk ; kk++)
+                    {
+                        // Apanel [kk,ii] = A(k0+kk,i0+ii)
+                        GB_GETA (Apanel [kk * GB_DOT2_TILE_I + ii], Ax,
+                            pA + kk, A_iso) ;
+                    }
+                }
+
+                //--------------------------------------------------------------
+                // C(i0:i0+ni-1,j0:j0+nj-1) += Apanel'*B(k0:k0+nk-1,j0:...)
+                //--------------------------------------------------------------
+
+                for (int64_t j0 = kB_start ; j0 < kB_end ;
+                    j0 += GB_DOT2_TILE_J)
+                {
+                    const int64_t nj = GB_IMIN (GB_DOT2_TILE_J, kB_end - j0) ;
+                    int64_t kk = 0 ;
+                    if (k0 == 0)
+                    {
+                        // cij = A(0,i0:i0+ni-1)' * B(0,j0:j0+nj-1)
+                        for (int64_t jj = 0 ; jj < nj ; jj++)
+                        {
+                            const int64_t j = j0 + jj ;
+                            GB_DECLAREB (bkj) ;
+                            GB_GETB (bkj, Bx, j * vlen, B_iso) ;
+                            GB_PRAGMA_SIMD_VECTORIZE
+                            for (int64_t ii = 0 ; ii < ni ; ii++)
+                            {
+                                GB_MULT (cij [jj][ii], Apanel [ii], bkj,
+                                    i0+ii, 0, j) ;
+                            }
+                        }
+                        kk = 1 ;
+                    }
+                    else
+                    {
+                        // get the partial result from the prior panels
+                        for (int64_t jj = 0 ; jj < nj ; jj++)
+                        {
+                            const int64_t pC = (j0 + jj) * cvlen + i0 ;
+                            for (int64_t ii = 0 ; ii < ni ; ii++)
+                            {
+                                cij [jj][ii] = Cx [pC + ii] ;
+                            }
+                        }
+                    }
+                    for ( ; kk < nk ; kk++)
+                    {
+                        // cij += A(k,i0:i0+ni-1)' * B(k,j0:j0+nj-1),
+                        // with k = k0+kk
+                        const int64_t k = k0 + kk ;
+                        const int64_t pA = kk * GB_DOT2_TILE_I ;
+                        for (int64_t jj = 0 ; jj < nj ; jj++)
+                        {
+                            const int64_t j = j0 + jj ;
+                            GB_DECLAREB (bkj) ;
+                            GB_GETB (bkj, Bx, j * vlen + k, B_iso) ;
+                            GB_PRAGMA_SIMD_VECTORIZE
+                            for (int64_t ii = 0 ; ii < ni ; ii++)
+                            {
+                                GB_MULTADD (cij [jj][ii], Apanel [pA + ii],
+                                    bkj, i0+ii, k, j) ;
+                            }
+                        }
+                    }
+                    for (int64_t jj = 0 ; jj < nj ; jj++)
+                    {
+                        const int64_t pC = (j0 + jj) * cvlen + i0 ;
+                        for (int64_t ii = 0 ; ii < ni ; ii++)
+                        {
+                            // C(i0+ii,j0+jj) = cij [jj][ii]
+                            GB_PUTC (cij [jj][ii], Cx, pC + ii) ;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -41,7 +41,7 @@
 #endif
 
 // GB_DOT_SAVE_CIJ: C(i,j) = cij, if it exists
-#define GB_DOT_SAVE_CIJ                 \
+#define GB_DOT3_SAVE_CIJ                \
 {                                       \
     if (GB_CIJ_EXISTS)                  \
     {                                   \
@@ -50,6 +50,24 @@
         Ci [pC] = i ;                   \
     }                                   \
 }
+#define GB_DOT_SAVE_CIJ GB_DOT3_SAVE_CIJ
+
+// GB_DOT3_ULTRA_GET and GB_DOT3_ULTRA_UPDATE: sum the results of the
+// ultra-fine tasks, held in the workspace Wx.  The generic kernel defines
+// its own methods.
+#ifndef GB_DOT3_ULTRA_GET
+    #if GB_IS_ANY_PAIR_SEMIRING
+    #define GB_DOT3_ULTRA_GET(cij,Wx,t)
+    #define GB_DOT3_ULTRA_UPDATE(cij,Wx,t)
+    #else
+    #define GB_DOT3_ULTRA_GET(cij,Wx,t) cij = Wx [t]
+    #define GB_DOT3_ULTRA_UPDATE(cij,Wx,t) GB_UPDATE (cij, Wx [t])
+    #endif
+#endif
+
+#ifndef GB_C_SIZE
+#define GB_C_SIZE sizeof (GB_C_TYPE)
+#endif
 
 {
 
@@ -191,6 +209,7 @@
 
 #undef GB_DOT_ALWAYS_SAVE_CIJ
 #undef GB_DOT_SAVE_CIJ
+#undef GB_DOT3_SAVE_CIJ
 
 #undef GB_DOT3
 #undef GB_DOT3_PHASE2
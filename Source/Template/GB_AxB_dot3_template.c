@@ -10,8 +10,42 @@
 // C and M are both sparse or both hyper, and C->h is a copy of M->h.
 // M is present, and not complemented.  It may be valued or structural.
 
+// If A and B are both sparse or hyper, the TaskList may include teams of
+// ultra-fine tasks (see GB_AxB_dot3_slice), each of which computes part of a
+// single costly entry C(i,j).  Each ultra-fine task saves its result in the
+// workspace Wx [tid] and Wf [tid], and the results of each team are summed
+// after all tasks are done.  If the workspace cannot be allocated, the leader
+// of each team computes the entire entry C(i,j) itself.
+
 {
 
+    #if ((GB_A_IS_SPARSE || GB_A_IS_HYPER) && \
+         (GB_B_IS_SPARSE || GB_B_IS_HYPER))
+    int8_t *restrict Wf = NULL ; size_t Wf_size = 0 ;
+    #if !GB_IS_ANY_PAIR_SEMIRING
+    GB_C_TYPE *restrict Wx = NULL ; size_t Wx_size = 0 ;
+    #endif
+    bool has_ultra = false ;
+    for (int t = 0 ; t < ntasks && !has_ultra ; t++)
+    { 
+        has_ultra = (TaskList [t].klast < 0) ;
+    }
+    if (has_ultra)
+    { 
+        // allocate workspace for the ultra-fine tasks
+        Wf = GB_MALLOC_WORK (ntasks, int8_t, &Wf_size) ;
+        #if !GB_IS_ANY_PAIR_SEMIRING
+        Wx = (GB_C_TYPE *) GB_MALLOC_WORK (ntasks * GB_C_SIZE, GB_void,
+            &Wx_size) ;
+        if (Wx == NULL)
+        { 
+            // out of memory; the leader of each team does all the work
+            GB_FREE_WORK (&Wf, Wf_size) ;
+        }
+        #endif
+    }
+    #endif
+
     int tid ;
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
         reduction(+:nzombies)
@@ -28,6 +62,87 @@
         int64_t pC_last  = TaskList [tid].pC_end ;
         int64_t task_nzombies = 0 ;     // # of zombies found by this task
 
+        #if ((GB_A_IS_SPARSE || GB_A_IS_HYPER) && \
+             (GB_B_IS_SPARSE || GB_B_IS_HYPER))
+        if (klast < 0)
+        {
+
+            //------------------------------------------------------------------
+            // ultra-fine task: compute part of a single entry C(i,j)
+            //------------------------------------------------------------------
+
+            const int team_size = (int) TaskList [tid].len ;
+            int64_t pA = TaskList [tid].pA ;
+            int64_t pA_end = TaskList [tid].pA_end ;
+            const int64_t pB_start = TaskList [tid].pB ;
+            int64_t pB_end = TaskList [tid].pB_end ;
+            if (Wf == NULL)
+            {
+                // no workspace: the team leader computes all of C(i,j)
+                if (team_size == 0) continue ;
+                pA_end = TaskList [tid + team_size - 1].pA_end ;
+                pB_end = TaskList [tid + team_size - 1].pB_end ;
+            }
+
+            #if defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
+            const int64_t j = kfirst ;
+            #else
+            const int64_t j = GBH_C (Ch, kfirst) ;
+            #endif
+            const int64_t pC = pC_first ;
+            const int64_t i = Mi [pC] ;
+
+            bool cij_exists = false ;
+            GB_CIJ_DECLARE (cij) ;
+            #if GB_IS_PLUS_PAIR_REAL_SEMIRING
+            cij = 0 ;
+            #endif
+
+            #if !defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
+            if (GB_MCAST (Mx, pC, msize))
+            #endif
+            {
+                const int64_t ainz = pA_end - pA ;
+                const int64_t bjnz = pB_end - pB_start ;
+                if (ainz > 0 && bjnz > 0)
+                { 
+                    // cij = A(i1:i2,i)'*B(i1:i2,j) for this task's slice,
+                    // leaving the result in cij
+                    const int64_t ib_first = Bi [pB_start] ;
+                    const int64_t ib_last  = Bi [pB_end-1] ;
+                    #undef  GB_DOT_SAVE_CIJ
+                    #define GB_DOT_SAVE_CIJ ;
+                    #include "GB_AxB_dot_cij.c"
+                    #undef  GB_DOT_SAVE_CIJ
+                    #define GB_DOT_SAVE_CIJ GB_DOT3_SAVE_CIJ
+                }
+            }
+
+            if (Wf != NULL)
+            { 
+                // save the partial result for this task
+                Wf [tid] = GB_CIJ_EXISTS ;
+                if (GB_CIJ_EXISTS)
+                { 
+                    GB_PUTC (cij, Wx, tid) ;    // Wx [tid] = cij
+                }
+            }
+            else if (GB_CIJ_EXISTS)
+            { 
+                // C(i,j) = cij
+                GB_PUTC (cij, Cx, pC) ;         // Cx [pC] = cij
+                Ci [pC] = i ;
+            }
+            else
+            { 
+                // C(i,j) is a zombie
+                nzombies++ ;
+                Ci [pC] = GB_FLIP (i) ;
+            }
+            continue ;
+        }
+        #endif
+
         //----------------------------------------------------------------------
         // compute all vectors in this task
         //----------------------------------------------------------------------
@@ -166,6 +281,70 @@
         }
         nzombies += task_nzombies ;
     }
+
+    #if ((GB_A_IS_SPARSE || GB_A_IS_HYPER) && \
+         (GB_B_IS_SPARSE || GB_B_IS_HYPER))
+    if (Wf != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // sum the results of each team of ultra-fine tasks
+        //----------------------------------------------------------------------
+
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            if (TaskList [tid].klast >= 0 || TaskList [tid].len == 0)
+            { 
+                // not the leader of a team of ultra-fine tasks
+                continue ;
+            }
+            const int team_size = (int) TaskList [tid].len ;
+            const int64_t pC = TaskList [tid].pC ;
+            const int64_t i = Mi [pC] ;
+            bool cij_exists = false ;
+            GB_CIJ_DECLARE (cij) ;
+            for (int t = tid ; t < tid + team_size ; t++)
+            {
+                if (!Wf [t]) continue ;
+                if (cij_exists)
+                { 
+                    // cij += Wx [t]
+                    GB_DOT3_ULTRA_UPDATE (cij, Wx, t) ;
+                }
+                else
+                { 
+                    // cij = Wx [t]
+                    cij_exists = true ;
+                    GB_DOT3_ULTRA_GET (cij, Wx, t) ;
+                    #if GB_IS_ANY_MONOID
+                    break ;
+                    #endif
+                }
+            }
+            if (cij_exists)
+            { 
+                // C(i,j) = cij
+                GB_PUTC (cij, Cx, pC) ;         // Cx [pC] = cij
+                Ci [pC] = i ;
+            }
+            else
+            { 
+                // C(i,j) is a zombie
+                nzombies++ ;
+                Ci [pC] = GB_FLIP (i) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // free workspace
+        //----------------------------------------------------------------------
+
+        GB_FREE_WORK (&Wf, Wf_size) ;
+        #if !GB_IS_ANY_PAIR_SEMIRING
+        GB_FREE_WORK (&Wx, Wx_size) ;
+        #endif
+    }
+    #endif
 }
 
 #undef GB_A_IS_SPARSE
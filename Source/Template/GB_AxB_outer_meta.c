@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+// GB_AxB_outer_meta: C+=A*B' via outer products, where C is full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C+=A*B' where C is full and computed in-place.  The monoid of the semiring
+// matches the accum operator, and the type of C matches the ztype of accum.
+// A and B are sparse or hypersparse, and are used in their stored orientation:
+// no transpose of A or B is computed.  C is m-by-n, A is m-by-k, and B is
+// n-by-k, all held by column.  B cannot be jumbled, since a binary search is
+// used to find the entries in B(jstart:jend-1,k).  A can be jumbled.
+
+// C is computed as the sum of k outer products, C += A(:,k)*B(:,k)'.  Each
+// task owns the columns C(:,jstart:jend-1), so no atomics or workspace are
+// needed.  For each vector B(:,k), the task finds the entries B(j,k) for j in
+// the range jstart:jend-1, and then computes C(:,j) += A(:,k)*B(j,k) for each
+// of those entries.  The result does not depend on the number of tasks or
+// threads, since each C(i,j) is updated in ascending order of k.
+
+// C is not iso on input (it has been expanded if needed, in GB_AxB_outer).
+// A and/or B can be iso.
+
+// This method is not used for the generic case with memcpy's and function
+// pointers.  It is only used for JIT kernels.
+
+#if GB_IS_ANY_MONOID
+#error "outer product method not supported for ANY monoids"
+#endif
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A, B, and C
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_IS_FULL (C)) ;
+    const int64_t cvlen = C->vlen ;
+    const int64_t cvdim = C->vdim ;
+    ASSERT (C->vlen == A->vlen) ;
+    ASSERT (C->vdim == B->vlen) ;
+    ASSERT (A->vdim == B->vdim) ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t anvec = A->nvec ;
+    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
+    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
+    const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
+    const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int64_t *restrict Bi = B->i ;
+    const int64_t bnvec = B->nvec ;
+    ASSERT (!GB_JUMBLED (B)) ;
+
+    #ifdef GB_JIT_KERNEL
+    #define A_is_hyper GB_A_IS_HYPER
+    #define A_iso GB_A_ISO
+    #define B_iso GB_B_ISO
+    #else
+    const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+    const bool A_iso = A->iso ;
+    const bool B_iso = B->iso ;
+    #endif
+
+    #if !GB_A_IS_PATTERN
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    #endif
+    #if !GB_B_IS_PATTERN
+    const GB_B_TYPE *restrict Bx = (GB_B_TYPE *) B->x ;
+    #endif
+          GB_C_TYPE *restrict Cx = (GB_C_TYPE *) C->x ;
+
+    //--------------------------------------------------------------------------
+    // C += A*B'
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the columns C(:,jstart:jend-1) owned by this task
+        //----------------------------------------------------------------------
+
+        int64_t jstart, jend ;
+        GB_PARTITION (jstart, jend, cvdim, tid, ntasks) ;
+
+        //----------------------------------------------------------------------
+        // C(:,jstart:jend-1) += A*B(jstart:jend-1,:)'
+        //----------------------------------------------------------------------
+
+        for (int64_t kB = 0 ; kB < bnvec ; kB++)
+        {
+
+            //------------------------------------------------------------------
+            // get B(jstart:jend-1,k)
+            //------------------------------------------------------------------
+
+            const int64_t k = GBH_B (Bh, kB) ;
+            int64_t pB = Bp [kB] ;
+            const int64_t pB_end = Bp [kB+1] ;
+            if (pB == pB_end || Bi [pB] >= jend || Bi [pB_end-1] < jstart)
+            {
+                // B(jstart:jend-1,k) is empty
+                continue ;
+            }
+            if (Bi [pB] < jstart)
+            {
+                // find the first entry B(j,k) with j >= jstart
+                int64_t pright = pB_end - 1 ;
+                bool found ;
+                GB_SPLIT_BINARY_SEARCH (jstart, Bi, pB, pright, found) ;
+            }
+
+            //------------------------------------------------------------------
+            // get A(:,k)
+            //------------------------------------------------------------------
+
+            int64_t pA_start, pA_end ;
+            if (A_is_hyper)
+            {
+                // A is hypersparse: find A(:,k) in the A->Y hyper_hash
+                GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                    A_hash_bits, k, &pA_start, &pA_end) ;
+            }
+            else
+            {
+                // A is sparse
+                pA_start = Ap [k] ;
+                pA_end   = Ap [k+1] ;
+            }
+            if (pA_start == pA_end)
+            {
+                // A(:,k) is empty
+                continue ;
+            }
+
+            //------------------------------------------------------------------
+            // C(:,j) += A(:,k)*B(j,k) for each B(j,k), j in jstart:jend-1
+            //------------------------------------------------------------------
+
+            for ( ; pB < pB_end ; pB++)
+            {
+                const int64_t j = Bi [pB] ;
+                if (j >= jend) break ;
+                GB_DECLAREB (bjk) ;
+                GB_GETB (bjk, Bx, pB, B_iso) ;      // bjk = B(j,k)
+                GB_C_TYPE *restrict Cxj = Cx + j * cvlen ;
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    const int64_t i = Ai [pA] ;
+                    GB_DECLAREA (aik) ;
+                    GB_GETA (aik, Ax, pA, A_iso) ;  // aik = A(i,k)
+                    GB_MULTADD (Cxj [i], aik, bjk, i, k, j) ; // C(i,j)+=aik*bjk
+                }
+            }
+        }
+    }
+}
+
+#undef A_is_hyper
+#undef A_iso
+#undef B_iso
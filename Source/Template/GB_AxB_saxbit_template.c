@@ -10,8 +10,9 @@
 // GB_AxB_saxpy_sparsity determines the sparsity structure for C<M or !M>=A*B
 // or C=A*B, and this template is used when C is bitmap.
 
-// FUTURE: C could be modified in-place if the accum operator is the same as
-// the monoid.
+// C may already have entries on input, if C<#M>+=A*B is computed in-place
+// (see GB_AxB_saxbit).  The results are combined with any entries already
+// present in C, via the monoid.
 
 // C is bitmap.
 // M is anything: present or not, complemented or not, structural or valued,
@@ -33,7 +33,7 @@
     for ( ; pB < pB_end ; pB++)     // scan B(:,j)
     { 
         GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
-        GB_GET_A_k ;                // get A(:,k)
+        GB_GET_A_k_FINE ;           // get A(:,k)
         if (aknz == 0) continue ;
         GB_GET_B_kj ;               // bkj = B(k,j)
         #define GB_IKJ                                                        \
@@ -127,6 +127,9 @@
         int64_t pB     = SaxpyTasks [taskid].start ;
         int64_t pB_end = SaxpyTasks [taskid].end + 1 ;
         int64_t j = GBH_B (Bh, kk) ;
+        // A(:,k) is sliced if this is an ultra-fine task
+        const int64_t task_pA     = SaxpyTasks [taskid].pA ;
+        const int64_t task_pA_end = SaxpyTasks [taskid].pA_end ;
 
         GB_GET_T_FOR_SECONDJ ;
 
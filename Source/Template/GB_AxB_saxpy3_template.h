@@ -240,6 +240,27 @@
     }                                                                       \
     const int64_t aknz = pA_end - pA_start
 
+//------------------------------------------------------------------------------
+// GB_GET_A_k_FINE: get A(:,k) for a fine task, or A(i1:i2,k) if ultra-fine
+//------------------------------------------------------------------------------
+
+// An ultra-fine task computes A(i1:i2,k)*B(k,j) for a single entry B(k,j),
+// where the entries A(i1:i2,k) are in positions task_pA to task_pA_end-1.
+// For all other fine tasks, task_pA is -1 and all of A(:,k) is used.
+
+#define GB_GET_A_k_FINE                                                     \
+    int64_t pA_first = task_pA, pA_last = task_pA_end ;                     \
+    if (pA_first < 0)                                                       \
+    {                                                                       \
+        /* fine task: get all of A(:,k) */                                  \
+        GB_GET_A_k ;                                                        \
+        pA_first = pA_start ;                                               \
+        pA_last  = pA_start + aknz ;                                        \
+    }                                                                       \
+    const int64_t pA_start = pA_first ;                                     \
+    const int64_t pA_end   = pA_last ;                                      \
+    const int64_t aknz = pA_end - pA_start
+
 //------------------------------------------------------------------------------
 // GB_GET_M_ij: get the numeric value of M(i,j)
 //------------------------------------------------------------------------------
@@ -121,7 +121,8 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
     const GrB_Matrix B,                                                 \
     const GB_task_struct *restrict TaskList,                            \
     const int ntasks,                                                   \
-    const int nthreads                                                  \
+    const int nthreads,                                                 \
+    const GB_callback_struct *restrict my_callback                      \
 )
 
 #define GB_JIT_KERNEL_AXB_DOT4_PROTO(GB_jit_kernel_AxB_dot4)            \
@@ -139,6 +140,16 @@ GrB_Info GB_jit_kernel_AxB_dot4                                         \
     const GB_callback_struct *restrict my_callback                      \
 )
 
+#define GB_JIT_KERNEL_AXB_OUTER_PROTO(GB_jit_kernel_AxB_outer)          \
+GrB_Info GB_jit_kernel_AxB_outer                                        \
+(                                                                       \
+    GrB_Matrix C,                                                       \
+    const GrB_Matrix A,                                                 \
+    const GrB_Matrix B,                                                 \
+    const int ntasks,                                                   \
+    const int nthreads                                                  \
+)
+
 #define GB_JIT_KERNEL_AXB_SAXBIT_PROTO(GB_jit_kernel_AxB_saxbit)        \
 GrB_Info GB_jit_kernel_AxB_saxbit                                       \
 (                                                                       \
@@ -380,6 +391,17 @@ GrB_Info GB_jit_kernel_ewise_fulln                                      \
     const int nthreads                                                  \
 )
 
+#define GB_JIT_KERNEL_KRONER_PROTO(GB_jit_kernel_kroner)              \
+GrB_Info GB_jit_kernel_kroner                                           \
+(                                                                       \
+    GrB_Matrix C,                                                       \
+    const GrB_Matrix A,                                                 \
+    const GrB_Matrix B,                                                 \
+    const int64_t *restrict C_ek_slicing,                               \
+    const int C_ntasks,                                                 \
+    const int C_nthreads                                                \
+)
+
 #define GB_JIT_KERNEL_REDUCE_PROTO(GB_jit_kernel_reduce)                \
 GrB_Info GB_jit_kernel_reduce                                           \
 (                                                                       \
@@ -410,6 +432,18 @@ GrB_Info GB_jit_kernel_select_bitmap                                    \
     const int nthreads                                                  \
 )
 
+#define GB_JIT_KERNEL_SELECT_MASKED_PROTO(GB_jit_kernel_select_masked)  \
+GrB_Info GB_jit_kernel_select_masked                                    \
+(                                                                       \
+    GrB_Matrix C,                                                       \
+    const GrB_Matrix M,                                                 \
+    const GrB_Matrix A,                                                 \
+    const GB_void *restrict ythunk,                                     \
+    const int64_t *C_ek_slicing,                                        \
+    const int C_ntasks,                                                 \
+    const int C_nthreads                                                \
+)
+
 #define GB_JIT_KERNEL_SELECT_PHASE1_PROTO(GB_jit_kernel_select_phase1)  \
 GrB_Info GB_jit_kernel_select_phase1                                    \
 (                                                                       \
@@ -565,6 +599,7 @@ GrB_Info GB_jit_kernel_union                                            \
 #define JIT_DO2N(g) GB_JIT_KERNEL_AXB_DOT2N_PROTO(g) ;
 #define JIT_DOT3(g) GB_JIT_KERNEL_AXB_DOT3_PROTO(g) ;
 #define JIT_DOT4(g) GB_JIT_KERNEL_AXB_DOT4_PROTO(g) ;
+#define JIT_OUTR(g) GB_JIT_KERNEL_AXB_OUTER_PROTO(g) ;
 #define JIT_SAXB(g) GB_JIT_KERNEL_AXB_SAXBIT_PROTO(g) ;
 #define JIT_SAX3(g) GB_JIT_KERNEL_AXB_SAXPY3_PROTO(g) ;
 #define JIT_SAX4(g) GB_JIT_KERNEL_AXB_SAXPY4_PROTO(g) ;
@@ -586,9 +621,11 @@ GrB_Info GB_jit_kernel_union                                            \
 #define JIT_EMB(g)  GB_JIT_KERNEL_EMULT_BITMAP_PROTO(g) ;
 #define JIT_EWFA(g) GB_JIT_KERNEL_EWISE_FULLA_PROTO(g) ;
 #define JIT_EWFN(g) GB_JIT_KERNEL_EWISE_FULLN_PROTO(g) ;
+#define JIT_KRON(g) GB_JIT_KERNEL_KRONER_PROTO(g) ;
 #define JIT_RED(g)  GB_JIT_KERNEL_REDUCE_PROTO(g) ;
 #define JIT_ROWS(g) GB_JIT_KERNEL_ROWSCALE_PROTO(g) ;
 #define JIT_SELB(g) GB_JIT_KERNEL_SELECT_BITMAP_PROTO(g) ;
+#define JIT_SELM(g) GB_JIT_KERNEL_SELECT_MASKED_PROTO(g) ;
 #define JIT_SEL1(g) GB_JIT_KERNEL_SELECT_PHASE1_PROTO(g) ;
 #define JIT_SEL2(g) GB_JIT_KERNEL_SELECT_PHASE2_PROTO(g) ;
 #define JIT_SPB(g)  GB_JIT_KERNEL_SPLIT_BITMAP_PROTO(g) ;
@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+// GB_kroner_template: C = kron (A,B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The pattern of C (Cp and Ch) has already been computed, and the entries of
+// C have been sliced with GB_ek_slice, so the work is balanced by the number
+// of entries in C, not by the number of vectors of C.  A single vector
+// C(:,kC) = kron (A(:,kA), B(:,kB)) may be split across many tasks.  The
+// entry at position t in C(:,kC) is A(pA_start + t/bknz) times
+// B(pB_start + t%bknz), where bknz = nnz (B(:,kB)).
+
+// A and B are sparse, hypersparse, or full (not bitmap).  C is full if both A
+// and B are full; otherwise C is sparse or hypersparse.  If GB_ISO_KRONER is
+// #define'd, C is iso and only its pattern is computed.
+
+{
+
+    //--------------------------------------------------------------------------
+    // get C, A, and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Cp = C->p ;
+          int64_t *restrict Ci = C->i ;
+    #ifndef GB_ISO_KRONER
+    GB_C_TYPE *restrict Cx = (GB_C_TYPE *) C->x ;
+    #endif
+    const int64_t cvlen = C->vlen ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t avlen = A->vlen ;
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int64_t *restrict Bi = B->i ;
+    const int64_t bvlen = B->vlen ;
+    const int64_t bnvec = B->nvec ;
+
+    #ifndef GB_ISO_KRONER
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    const GB_B_TYPE *restrict Bx = (GB_B_TYPE *) B->x ;
+    #endif
+
+    #ifdef GB_JIT_KERNEL
+    #define A_iso GB_A_ISO
+    #define B_iso GB_B_ISO
+    #define C_is_full GB_C_IS_FULL
+    #else
+    const bool A_iso = A->iso ;
+    const bool B_iso = B->iso ;
+    const bool C_is_full = (Ci == NULL) ;
+    #endif
+
+    const int64_t *restrict kfirst_Cslice = C_ek_slicing ;
+    const int64_t *restrict klast_Cslice  = C_ek_slicing + C_ntasks ;
+    const int64_t *restrict pstart_Cslice = C_ek_slicing + C_ntasks * 2 ;
+
+    //--------------------------------------------------------------------------
+    // C = kron (A,B)
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(C_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < C_ntasks ; tid++)
+    {
+        int64_t kfirst = kfirst_Cslice [tid] ;
+        int64_t klast  = klast_Cslice  [tid] ;
+        for (int64_t kC = kfirst ; kC <= klast ; kC++)
+        {
+
+            //------------------------------------------------------------------
+            // find the part of C(:,kC) for this task
+            //------------------------------------------------------------------
+
+            const int64_t pC_first = GBP (Cp, kC, cvlen) ;
+            GB_GET_PA (pC_start, pC_end, tid, kC, kfirst, klast,
+                pstart_Cslice, pC_first, GBP (Cp, kC+1, cvlen)) ;
+            if (pC_start >= pC_end) continue ;
+
+            //------------------------------------------------------------------
+            // get A(:,jA) and B(:,jB), where C(:,jC) = kron (A(:,jA),B(:,jB))
+            //------------------------------------------------------------------
+
+            const int64_t kA = kC / bnvec ;
+            const int64_t kB = kC % bnvec ;
+            const int64_t jA = GBH_A (Ah, kA) ;
+            const int64_t jB = GBH_B (Bh, kB) ;
+            const int64_t pB_start = GBP_B (Bp, kB, bvlen) ;
+            const int64_t pB_end   = GBP_B (Bp, kB+1, bvlen) ;
+            const int64_t bknz = pB_end - pB_start ;
+
+            // find the first entries of A(:,jA) and B(:,jB) for this task
+            const int64_t t = pC_start - pC_first ;
+            int64_t pA = GBP_A (Ap, kA, avlen) + t / bknz ;
+            int64_t pB = pB_start + t % bknz ;
+
+            //------------------------------------------------------------------
+            // C(:,jC) = kron (A(:,jA),B(:,jB)) for entries pC_start:pC_end-1
+            //------------------------------------------------------------------
+
+            int64_t pC = pC_start ;
+            while (pC < pC_end)
+            {
+                // aij = A(iA,jA)
+                const int64_t iA = GBI_A (Ai, pA, avlen) ;
+                const int64_t iAblock = iA * bvlen ;
+                #ifndef GB_ISO_KRONER
+                GB_DECLAREA (aij) ;
+                GB_GETA (aij, Ax, pA, A_iso) ;
+                #endif
+                // C(iAblock:iAblock+bvlen-1,jC) = aij * B(:,jB)
+                const int64_t pB_last = GB_IMIN (pB_end, pB + (pC_end - pC)) ;
+                for ( ; pB < pB_last ; pB++, pC++)
+                {
+                    const int64_t iB = GBI_B (Bi, pB, bvlen) ;
+                    if (!C_is_full)
+                    {
+                        Ci [pC] = iAblock + iB ;
+                    }
+                    #ifndef GB_ISO_KRONER
+                    GB_DECLAREB (bij) ;
+                    GB_GETB (bij, Bx, pB, B_iso) ;
+                    GB_KRONER_OP (Cx, pC, aij, bij, iA, jA, iB, jB) ;
+                    #endif
+                }
+                // advance to the next entry in A(:,jA)
+                pB = pB_start ;
+                pA++ ;
+            }
+        }
+    }
+}
+
+#undef A_iso
+#undef B_iso
+#undef C_is_full
+#undef GB_ISO_KRONER
+
@@ -17,6 +17,8 @@ typedef struct
     int64_t start ;     // starting vector for coarse task, p for fine task
     int64_t end ;       // ending vector for coarse task, p for fine task
     int64_t vector ;    // -1 for coarse task, vector j for fine task
+    int64_t pA ;        // first entry of A(:,k) for ultra-fine task, or -1
+    int64_t pA_end ;    // last entry of A(:,k) is pA_end-1, or -1
     int64_t hsize ;     // size of hash table
     int64_t *Hi ;       // Hi array for hash table (coarse hash tasks only)
     GB_void *Hf ;       // Hf array for hash table (int8_t or int64_t)
@@ -0,0 +1,240 @@
+//------------------------------------------------------------------------------
+// GB_select_masked_template: C<M>=select(A,thunk), C with zombies
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is sparse or hypersparse, and its pattern has already been copied from M
+// (if M is sparse or hypersparse) or from A (if M is bitmap or full).  Ci is
+// computed here: each entry C(i,j) is either kept, or it becomes a zombie if
+// the mask, the entry A(i,j), or the select operator do not allow it.  The
+// zombies are deleted later, by GB_accum_mask.
+
+// If M is sparse or hypersparse, it is not complemented, and the work is
+// proportional to the number of entries in M.  Each entry M(i,j) is looked up
+// in A, with a binary search of A(:,j) if A is sparse or hypersparse, or in
+// O(1) time if A is bitmap or full.  The entries of M(:,j) are sorted, so the
+// search space in A(:,j) shrinks as the vector M(:,j) is traversed.
+
+// If M is bitmap or full, it may be complemented, and A is sparse or
+// hypersparse.  Each entry A(i,j) is then checked against M(i,j) in O(1)
+// time.
+
+// GB_SELECT_MASKED_TEST(keep,p): test if A(i,j) at position p is kept
+#if defined ( GB_TRIL_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (j-i <= ithunk)
+#elif defined ( GB_TRIU_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (j-i >= ithunk)
+#elif defined ( GB_DIAG_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (j-i == ithunk)
+#elif defined ( GB_OFFDIAG_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (j-i != ithunk)
+#elif defined ( GB_ROWINDEX_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (i+ithunk != 0)
+#elif defined ( GB_COLINDEX_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (j+ithunk != 0)
+#elif defined ( GB_COLLE_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (j <= ithunk)
+#elif defined ( GB_COLGT_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (j > ithunk)
+#elif defined ( GB_ROWLE_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (i <= ithunk)
+#elif defined ( GB_ROWGT_SELECTOR )
+    #define GB_SELECT_MASKED_TEST(keep,p) bool keep = (i > ithunk)
+#else
+    // VALUE* and user-defined operators
+    #define GB_SELECT_MASKED_TEST(keep,p) GB_TEST_VALUE_OF_ENTRY (keep, p)
+#endif
+
+{
+
+    //--------------------------------------------------------------------------
+    // get C, M, and A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Cp = C->p ;
+    const int64_t *restrict Ch = C->h ;
+          int64_t *restrict Ci = C->i ;
+    #if !GB_ISO_SELECT
+    GB_A_TYPE *restrict Cx = (GB_A_TYPE *) C->x ;
+    #endif
+
+    #ifdef GB_JIT_KERNEL
+    #define Mask_struct GB_MASK_STRUCT
+    #define Mask_comp   GB_MASK_COMP
+    #define M_is_sparse_or_hyper (GB_M_IS_SPARSE || GB_M_IS_HYPER)
+    #define A_is_hyper  GB_A_IS_HYPER
+    #define A_is_sparse GB_A_IS_SPARSE
+    #define A_is_bitmap GB_A_IS_BITMAP
+    #else
+    const bool M_is_sparse_or_hyper = GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M);
+    const bool A_is_hyper  = GB_IS_HYPERSPARSE (A) ;
+    const bool A_is_sparse = GB_IS_SPARSE (A) ;
+    const bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    #endif
+
+    const int64_t *restrict Mi = M->i ;
+    const int8_t  *restrict Mb = M->b ;
+    const GB_M_TYPE *restrict Mx = (GB_M_TYPE *) (Mask_struct ? NULL : (M->x)) ;
+    const size_t msize = M->type->size ;
+    const int64_t mvlen = M->vlen ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    const int64_t anvec = A->nvec ;
+    const int64_t avlen = A->vlen ;
+
+    const int64_t *restrict A_Yp = (A->Y == NULL) ? NULL : A->Y->p ;
+    const int64_t *restrict A_Yi = (A->Y == NULL) ? NULL : A->Y->i ;
+    const int64_t *restrict A_Yx = (A->Y == NULL) ? NULL : A->Y->x ;
+    const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
+
+    const int64_t *restrict kfirst_Cslice = C_ek_slicing ;
+    const int64_t *restrict klast_Cslice  = C_ek_slicing + C_ntasks ;
+    const int64_t *restrict pstart_Cslice = C_ek_slicing + C_ntasks * 2 ;
+
+    //--------------------------------------------------------------------------
+    // C<M>=select(A,thunk)
+    //--------------------------------------------------------------------------
+
+    int64_t nzombies = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(C_nthreads) schedule(dynamic,1) \
+        reduction(+:nzombies)
+    for (tid = 0 ; tid < C_ntasks ; tid++)
+    {
+
+        int64_t kfirst = kfirst_Cslice [tid] ;
+        int64_t klast  = klast_Cslice  [tid] ;
+        int64_t task_nzombies = 0 ;
+
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // find the part of C(:,k) for this task
+            //------------------------------------------------------------------
+
+            const int64_t j = GBH (Ch, k) ;
+            GB_GET_PA (pC_start, pC_end, tid, k, kfirst, klast, pstart_Cslice,
+                Cp [k], Cp [k+1]) ;
+
+            if (M_is_sparse_or_hyper)
+            {
+
+                //--------------------------------------------------------------
+                // C has the pattern of M: find each M(i,j) in A(:,j)
+                //--------------------------------------------------------------
+
+                int64_t pA_start, pA_end ;
+                if (A_is_hyper)
+                {
+                    // A is hyper: find A(:,j) using the A->Y hyper hash
+                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                        A_hash_bits, j, &pA_start, &pA_end) ;
+                }
+                else if (A_is_sparse)
+                {
+                    // A is sparse
+                    pA_start = Ap [j] ;
+                    pA_end   = Ap [j+1] ;
+                }
+                else
+                {
+                    // A is bitmap or full
+                    pA_start = j * avlen ;
+                    pA_end   = pA_start + avlen ;
+                }
+
+                for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+                {
+                    const int64_t i = Mi [pC] ;
+                    int64_t pA = -1 ;
+                    if (GB_MCAST (Mx, pC, msize))
+                    {
+                        if (A_is_hyper || A_is_sparse)
+                        {
+                            // find A(i,j) in A(:,j), and trim A(:,j)
+                            int64_t pright = pA_end - 1 ;
+                            bool found ;
+                            GB_SPLIT_BINARY_SEARCH (i, Ai, pA_start, pright,
+                                found) ;
+                            if (found) pA = pA_start ;
+                        }
+                        else
+                        {
+                            // A(i,j) is at position pA_start + i
+                            pA = pA_start + i ;
+                            if (A_is_bitmap && !Ab [pA]) pA = -1 ;
+                        }
+                    }
+                    if (pA >= 0)
+                    {
+                        GB_SELECT_MASKED_TEST (keep, pA) ;
+                        if (keep)
+                        {
+                            // C(i,j) = A(i,j)
+                            Ci [pC] = i ;
+                            GB_SELECT_ENTRY (Cx, pC, Ax, pA) ;
+                            continue ;
+                        }
+                    }
+                    // C(i,j) is a zombie
+                    task_nzombies++ ;
+                    Ci [pC] = GB_FLIP (i) ;
+                }
+
+            }
+            else
+            {
+
+                //--------------------------------------------------------------
+                // C has the pattern of A: check each A(i,j) with M(i,j)
+                //--------------------------------------------------------------
+
+                const int64_t pM_start = j * mvlen ;
+                for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+                {
+                    const int64_t i = Ai [pC] ;
+                    const int64_t pM = pM_start + i ;
+                    bool mij = GBB_M (Mb, pM) && GB_MCAST (Mx, pM, msize) ;
+                    if (mij ^ Mask_comp)
+                    {
+                        GB_SELECT_MASKED_TEST (keep, pC) ;
+                        if (keep)
+                        {
+                            // C(i,j) = A(i,j)
+                            Ci [pC] = i ;
+                            GB_SELECT_ENTRY (Cx, pC, Ax, pC) ;
+                            continue ;
+                        }
+                    }
+                    // C(i,j) is a zombie
+                    task_nzombies++ ;
+                    Ci [pC] = GB_FLIP (i) ;
+                }
+            }
+        }
+        nzombies += task_nzombies ;
+    }
+
+    C->nzombies = nzombies ;
+}
+
+#undef GB_SELECT_MASKED_TEST
+#undef GB_TRIL_SELECTOR
+#undef GB_TRIU_SELECTOR
+#undef GB_DIAG_SELECTOR
+#undef GB_OFFDIAG_SELECTOR
+#undef GB_ROWINDEX_SELECTOR
+#undef GB_COLINDEX_SELECTOR
+#undef GB_COLLE_SELECTOR
+#undef GB_COLGT_SELECTOR
+#undef GB_ROWLE_SELECTOR
+#undef GB_ROWGT_SELECTOR
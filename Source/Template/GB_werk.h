@@ -28,6 +28,12 @@
 
 #define GB_WERK_SIZE 16384
 
+// Larger werkspace is allocated from the Werk arena of the GxB_Context, if it
+// is available (see GB_Context.c).  GB_WERK_ARENA_DEFAULT is the default max
+// size of the Werk arena of each Context.
+
+#define GB_WERK_ARENA_DEFAULT (1024*1024)
+
 typedef struct
 {
     GB_void Stack [GB_WERK_SIZE] ;  // werkspace stack
@@ -35,6 +41,9 @@ typedef struct
     char **logger_handle ;          // error report
     size_t *logger_size_handle ;
     int pwerk ;                     // top of Werk stack, initially zero
+    GxB_Context arena_Context ;     // Context whose Werk arena is in use,
+                                    // or NULL if none
+    size_t parena ;                 // top of the Werk arena, initially zero
 }
 GB_Werk_struct ;
 
@@ -46,7 +55,8 @@ typedef GB_Werk_struct *GB_Werk ;
 
 // Werk->Stack is a small fixed-size array that is allocated on the stack
 // of any user-callable GraphBLAS function.  It is used for small werkspace
-// allocations.
+// allocations.  Medium-sized werkspace is allocated from the Werk arena of
+// the Context, if available.
 
 // GB_ROUND8(s) rounds up s to a multiple of 8
 #define GB_ROUND8(s) (((s) + 7) & (~0x7))
@@ -55,8 +65,9 @@ typedef GB_Werk_struct *GB_Werk ;
 // GB_werk_push: allocate werkspace from the Werk stack or malloc
 //------------------------------------------------------------------------------
 
-// The werkspace is allocated from the Werk static if it small enough and space
-// is available.  Otherwise it is allocated by malloc.
+// The werkspace is allocated from the Werk stack if it small enough and space
+// is available, or from the Werk arena of the Context.  Otherwise it is
+// allocated by malloc.
 
 // See GB_callbacks.h for the prototype.
 
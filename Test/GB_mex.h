@@ -308,6 +308,57 @@ GrB_Scalar GB_mx_get_Scalar
     const mxArray *mx_scalar
 ) ;
 
+GrB_Info GB_mx_random_typed     // create a random matrix of any type
+(
+    GrB_Matrix *A_output,   // handle of matrix to create
+    GrB_Type type,          // type of the matrix (built-in)
+    int64_t nrows,          // number of rows
+    int64_t ncols,          // number of columns
+    int64_t nz,             // number of entries to set
+    int sparsity,           // sparsity control of the matrix
+    bool iso                // if true, all entries are equal to 1
+) ;
+
+typedef struct
+{
+    uint8_t *bytes ;        // content of the stream
+    size_t len ;            // # of bytes in the stream
+    size_t size ;           // size of the bytes array
+    size_t pos ;            // position of the reader
+    size_t limit ;          // the writer fails if len would exceed limit
+    size_t maxread ;        // largest single read
+}
+GB_mx_stream ;
+
+bool GB_mx_stream_write         // append data to the stream
+(
+    void *stream,               // a GB_mx_stream
+    const void *data,           // data to write
+    size_t size                 // # of bytes to write
+) ;
+
+bool GB_mx_stream_read          // read the next data from the stream
+(
+    void *stream,               // a GB_mx_stream
+    void *data,                 // data to read
+    size_t size                 // # of bytes to read
+) ;
+
+void GB_mx_stream_clear         // free the content of the stream
+(
+    GB_mx_stream *S
+) ;
+
+void GB_mx_burble_start
+(
+    const char *pattern     // pattern to search for in the burble
+) ;
+
+bool GB_mx_burble_stop      // true if the pattern was found
+(
+    void
+) ;
+
 //------------------------------------------------------------------------------
 
 #ifdef GB_MEMDUMP
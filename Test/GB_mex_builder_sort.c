@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// GB_mex_builder_sort: get or set the sorting method used by GB_builder
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// method 0: select the merge sort or radix sort automatically (the default)
+// method 1: always use the merge sort
+// method 2: use the radix sort whenever the packed (j,i) keys fit in 64 bits
+
+#include "GB_mex.h"
+
+#define USAGE "method = GB_mex_builder_sort (method)"
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    if (nargin > 1 || nargout > 1)
+    {
+        mexErrMsgTxt ("usage: " USAGE "\n") ;
+    }
+
+    if (nargin == 1)
+    {
+        int method = (int) mxGetScalar (pargin [0]) ;
+        if (method < 0 || method > 2)
+        {
+            mexErrMsgTxt ("usage: " USAGE " where method is 0, 1, or 2\n") ;
+        }
+        GB_Global_sort_set (method) ;
+    }
+
+    pargout [0] = mxCreateDoubleScalar ((double) GB_Global_sort_get ( )) ;
+}
@@ -11,6 +11,7 @@
 #include "GB_mex_errors.h"
 #include "GB_file.h"
 #include "GB_jitifyer.h"
+#include "GB_config.h"
 
 #define USAGE "GB_mex_test11"
 
@@ -49,15 +50,18 @@ void mexFunction
 )
 {
 
-    GrB_Matrix A = NULL ;
+    GrB_Matrix A = NULL, C = NULL, Cgen = NULL ;
     GrB_Vector v = NULL ;
+    GrB_BinaryOp MyPlus = NULL ;
+    GrB_Monoid MyMonoid = NULL ;
+    GrB_Semiring MySemiring = NULL ;
     GrB_Scalar scalar = NULL ;
     const char *s = NULL, *t = NULL, *c = NULL, *cache = NULL ;
     GrB_Info info, expected ;
     bool onebased = false, iso = false ;
-    int use_cmake_int = 0, onebased_int = 1, control = 99 ;
+    int use_cmake_int = 0, onebased_int = 1, control = 99, async_int = 0 ;
     size_t mysize = 99 ;
-    bool use_cmake = false ;
+    bool use_cmake = false, async = false ;
 
     //--------------------------------------------------------------------------
     // startup GraphBLAS
@@ -194,6 +198,142 @@ if (jit_enabled)
     OK (GxB_get (GxB_JIT_USE_CMAKE, &use_cmake)) ;
     CHECK (use_cmake == false) ;
 
+    // try a background compile, in an empty cache folder, with a
+    // user-defined semiring so that the JIT is used (not a factory kernel),
+    // and record the kernels that are loaded
+    OK (GxB_get (GxB_JIT_CACHE_PATH, &cache)) ;
+    char *async_cache = mxMalloc (strlen (cache) + 2) ;
+    strcpy (async_cache, cache) ;
+    system ("rm -rf /tmp/grb_async_cache") ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, "/tmp/grb_async_cache")) ;
+    remove ("/tmp/grb_record.txt") ;
+    OK (GxB_set (GxB_JIT_RECORD, "/tmp/grb_record.txt")) ;
+    OK (GxB_BinaryOp_new (&MyPlus, (GxB_binary_function) myplus,
+        GrB_FP32, GrB_FP32, GrB_FP32, "myplus", MYPLUS_DEFN)) ;
+    OK (GrB_Monoid_new_FP32 (&MyMonoid, MyPlus, 0)) ;
+    OK (GrB_Semiring_new (&MySemiring, MyMonoid, GrB_TIMES_FP32)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP32, 4, 4)) ;
+    for (int k = 0 ; k < 10 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP32 (A, (float) (k+1), k % 4, (3*k) % 4)) ;
+    }
+    OK (GrB_Matrix_new (&C, GrB_FP32, 4, 4)) ;
+    OK (GrB_Matrix_new (&Cgen, GrB_FP32, 4, 4)) ;
+
+    // compute C = A*A with the generic kernel
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GrB_mxm (Cgen, NULL, NULL, MySemiring, A, A, NULL)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+
+    // the kernel is queued for the background thread; C = A*A is computed
+    // by the generic kernel in the meantime
+    OK (GxB_set (GxB_JIT_ASYNC, true)) ;
+    OK (GxB_get (GxB_JIT_ASYNC, &async)) ;
+    #ifndef _WIN32
+    CHECK (async == true) ;
+    #endif
+    GB_mx_burble_start ("(jit: queued for background compile)") ;
+    OK (GrB_mxm (C, NULL, NULL, MySemiring, A, A, NULL)) ;
+    bool queued = GB_mx_burble_stop ( ) ;
+    CHECK (queued == async) ;
+    CHECK (GB_mx_isequal (C, Cgen, 0)) ;
+
+    // turning off async waits for the background compile to finish
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_ASYNC, false)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_ASYNC, &async_int)) ;
+    CHECK (async_int == 0) ;
+
+    // the kernel compiled in the background is now loaded and used
+    OK (GrB_Matrix_clear (C)) ;
+    GB_mx_burble_start (async ? "(jit: load)" : "(jit: compile and load)") ;
+    OK (GrB_mxm (C, NULL, NULL, MySemiring, A, A, NULL)) ;
+    bool loaded = GB_mx_burble_stop ( ) ;
+    CHECK (loaded) ;
+    CHECK (GB_mx_isequal (C, Cgen, 0)) ;
+
+    // the record file holds the kernel just loaded
+    OK (GxB_set (GxB_JIT_RECORD, "")) ;
+    FILE *fp = fopen ("/tmp/grb_record.txt", "r") ;
+    CHECK (fp != NULL) ;
+    char line [2048], kernel_name [2048], filename [4096] ;
+    uint64_t khash = 0 ;
+    int nrecorded = 0 ;
+    bool recorded = false ;
+    while (fgets (line, 2048, fp) != NULL)
+    {
+        printf ("recorded: %s", line) ;
+        nrecorded++ ;
+        if (strstr (line, " GB_jit__AxB_") != NULL) recorded = true ;
+        CHECK (sscanf (line, "%" SCNx64 " %2047s", &khash, kernel_name) == 2) ;
+    }
+    fclose (fp) ;
+    CHECK (nrecorded == 1) ;
+    CHECK (recorded) ;
+
+    // use the record file as a manifest, to compile the kernel again
+    snprintf (filename, 4096, "/tmp/grb_async_cache/lib/%02x/%s%s%s",
+        (unsigned int) (khash & 0xFF), GB_LIB_PREFIX, kernel_name,
+        GB_LIB_SUFFIX) ;
+    remove (filename) ;
+    OK (GxB_JIT_compile ("/tmp/grb_record.txt", 2)) ;
+    fp = fopen (filename, "r") ;
+    CHECK (fp != NULL) ;
+    fclose (fp) ;
+
+    // create an archive from the manifest.  A stray file left in the build
+    // folder must not be linked into the archive.
+    system ("mkdir -p /tmp/grb_async_cache/tmp/GB_jit_archive ; "
+        "echo garbage > /tmp/grb_async_cache/tmp/GB_jit_archive/stray.o") ;
+    GB_mx_burble_start ("(jit: archive of 1 kernels created)") ;
+    OK (GxB_JIT_archive ("/tmp/grb_record.txt", 2)) ;
+    bool archived = GB_mx_burble_stop ( ) ;
+    CHECK (archived) ;
+
+    // clear the JIT hash table, and use the archive alone in a new cache
+    // folder.  The archive is loaded when the cache path is set, unless an
+    // archive has already been loaded (by a prior run of this test in the
+    // same session, for example).
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_OFF)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+    system ("rm -rf /tmp/grb_archive_cache ; "
+        "mkdir -p /tmp/grb_archive_cache/lib ; "
+        "cp /tmp/grb_async_cache/lib/" GB_LIB_PREFIX "GB_jit_archive"
+        GB_LIB_SUFFIX " /tmp/grb_archive_cache/lib") ;
+    GB_mx_burble_start ("(jit: archive of 1 kernels)") ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, "/tmp/grb_archive_cache")) ;
+    bool archive_loaded = GB_mx_burble_stop ( ) ;
+    printf ("archive loaded: %d\n", archive_loaded) ;
+
+    // the archive kernel is used even though the JIT can no longer load or
+    // compile any kernels
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_RUN)) ;
+    OK (GrB_Matrix_clear (C)) ;
+    GB_mx_burble_start ("(prejit: ok)") ;
+    OK (GrB_mxm (C, NULL, NULL, MySemiring, A, A, NULL)) ;
+    bool prejit = GB_mx_burble_stop ( ) ;
+    CHECK (prejit || !archive_loaded) ;
+    CHECK (GB_mx_isequal (C, Cgen, 0)) ;
+    OK (GxB_set (GxB_JIT_C_CONTROL, GxB_JIT_ON)) ;
+
+    OK (GrB_free (&C)) ;
+    OK (GrB_free (&Cgen)) ;
+    OK (GrB_free (&A)) ;
+    OK (GrB_free (&MySemiring)) ;
+    OK (GrB_free (&MyMonoid)) ;
+    OK (GrB_free (&MyPlus)) ;
+    OK (GxB_set (GxB_JIT_CACHE_PATH, async_cache)) ;
+    mxFree (async_cache) ;
+    async_cache = NULL ;
+
+    // try a batch compile
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_JIT_compile (NULL, 4)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_JIT_compile ("/nonexistent/manifest.txt", 4)) ;
+    ERR (GxB_JIT_archive ("/nonexistent/manifest.txt", 4)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_JIT_archive (NULL, 4)) ;
+
     OK (GxB_get (GxB_JIT_C_LINKER_FLAGS, &s)) ;
     printf ("default linker flags [%s]\n", s) ;
     OK (GxB_set (GxB_JIT_C_LINKER_FLAGS, "-shared")) ;
@@ -249,6 +389,15 @@ if (jit_enabled)
     OK (GxB_get (GxB_JIT_C_CONTROL, &control)) ;
     CHECK (control == GxB_JIT_ON) ;
 
+    OK (GxB_get (GxB_JIT_RECORD, &s)) ;
+    CHECK (MATCH (s, "")) ;
+    OK (GxB_set (GxB_JIT_RECORD, "/tmp/grb_record.txt")) ;
+    OK (GxB_Global_Option_get_CHAR (GxB_JIT_RECORD, &t)) ;
+    CHECK (MATCH (t, "/tmp/grb_record.txt")) ;
+    OK (GxB_Global_Option_set_CHAR (GxB_JIT_RECORD, NULL)) ;
+    OK (GxB_get (GxB_JIT_RECORD, &s)) ;
+    CHECK (MATCH (s, "")) ;
+
     OK (GxB_get (GxB_JIT_ERROR_LOG, &s)) ;
     printf ("default error log: [%s]\n", s) ;
     OK (GxB_set (GxB_JIT_ERROR_LOG, "/tmp/grb_error_log.txt")) ;
@@ -502,6 +651,47 @@ if (jit_enabled)
     OK (GxB_Context_set_INT32 (context1, GxB_CONTEXT_GPU_ID, 40)) ;
     OK (GxB_Context_get_INT32 (context1, GxB_CONTEXT_GPU_ID, &id1)) ;
 
+    int werk_size = 0 ;
+    OK (GxB_Context_set_INT32 (context1, GxB_CONTEXT_WERK_SIZE, 65536)) ;
+    OK (GxB_Context_get_INT32 (context1, GxB_CONTEXT_WERK_SIZE, &werk_size)) ;
+    CHECK (werk_size == 65536) ;
+    OK (GxB_Context_set (context1, GxB_CONTEXT_WERK_SIZE, 0)) ;
+    OK (GxB_Context_get (context1, GxB_CONTEXT_WERK_SIZE, &werk_size)) ;
+    CHECK (werk_size == 0) ;
+
+    // Werk arena recovery after werkspace is pushed but never popped
+    OK (GxB_Context_set (context1, GxB_CONTEXT_WERK_SIZE, 1024*1024)) ;
+    {
+        GB_WERK ("test11") ;
+        GB_WERK_DECLARE (W1, int64_t) ;
+        GB_WERK_DECLARE (W2, int64_t) ;
+        GB_WERK_DECLARE (W3, int64_t) ;
+        GB_WERK_PUSH (W1, 8192, int64_t) ;
+        CHECK (W1 != NULL && W1_on_stack) ;
+        CHECK (((GB_void *) W1) == context1->werk_arena) ;
+        CHECK (context1->werk_arena_busy) ;
+        // W1 is not popped; a new Werk at the same address takes the arena
+        Werk->pwerk = 0 ;
+        Werk->arena_Context = NULL ;
+        Werk->parena = 0 ;
+        GB_WERK_PUSH (W2, 8192, int64_t) ;
+        CHECK (W2 != NULL && W2_on_stack) ;
+        CHECK (((GB_void *) W2) == context1->werk_arena) ;
+        // a different Werk cannot use the arena while it is busy
+        GB_Werk_struct Werk2_struct = *Werk ;
+        Werk2_struct.pwerk = 0 ;
+        Werk2_struct.arena_Context = NULL ;
+        Werk2_struct.parena = 0 ;
+        W3 = GB_werk_push (&W3_size_allocated, &W3_on_stack, 8192,
+            sizeof (int64_t), &Werk2_struct) ;
+        CHECK (W3 != NULL && !W3_on_stack) ;
+        W3 = GB_werk_pop (W3, &W3_size_allocated, W3_on_stack, 8192,
+            sizeof (int64_t), &Werk2_struct) ;
+        GB_WERK_POP (W2, int64_t) ;
+        CHECK (context1->werk_arena_busy == 0) ;
+        CHECK (context1->werk_arena_owner == NULL) ;
+    }
+
     OK (GxB_Context_disengage (context1)) ;
     GrB_free (&context1) ;
     GrB_free (&context2) ;
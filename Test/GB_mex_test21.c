@@ -197,7 +197,7 @@ void mexFunction
         printf ("GB_enumify_select / GB_macrofy_select: %s\n", op->name) ;
         // GxB_print (op, 3) ;
         GB_enumify_select (&scode, /* C iso: */ false, /* inplace A: */ false,
-            op, /* flipij: */ false, A) ;
+            op, /* flipij: */ false, A, /* M: */ NULL, false, false) ;
 //      printf ("select scode: %016" PRIx64 "\n", scode) ;
         GB_macrofy_select (fp, scode, op, GrB_BOOL) ;
     }
@@ -210,7 +210,7 @@ void mexFunction
         GxB_FC32, GxB_FC32, GxB_FC32, "opi32func", OPI32_DEFN)) ;
 //  GxB_print (opi, 3) ;
     GB_enumify_select (&scode, /* C iso: */ false, /* inplace A: */ false,
-        opi, /* flipij: */ false, A) ;
+        opi, /* flipij: */ false, A, /* M: */ NULL, false, false) ;
 //  printf ("select scode: %016" PRIx64 "\n", scode) ;
     GB_macrofy_select (fp, scode, opi, GxB_FC32) ;
     GrB_free (&opi) ;
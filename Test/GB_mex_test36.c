@@ -0,0 +1,203 @@
+//------------------------------------------------------------------------------
+// GB_mex_test36: test the cached saxpy3 schedule
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_AxB_saxpy3.h"
+
+#define USAGE "GB_mex_test36"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// check_mxm: C = A*B, and compare with the product of fresh copies of A, B
+//------------------------------------------------------------------------------
+
+static GrB_Info check_mxm
+(
+    GrB_Matrix M,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Descriptor desc
+)
+{
+    GrB_Info info ;
+    GrB_Index m, n ;
+    GrB_Matrix C1 = NULL, C2 = NULL, A2 = NULL, B2 = NULL ;
+    OK (GrB_Matrix_nrows (&m, A)) ;
+    OK (GrB_Matrix_ncols (&n, B)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, m, n)) ;
+    OK (GrB_mxm (C1, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_dup (&B2, B)) ;
+    OK (GrB_mxm (C2, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A2, B2, desc)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    GrB_free (&A2) ;
+    GrB_free (&B2) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test36 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_get (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    OK (GxB_set (GxB_CHUNK, (double) 1)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_set (desc, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+    simple_rand_seed (1) ;
+
+    OK (GB_mx_random_typed (&A, GrB_FP64, 400, 350, 3000, GxB_SPARSE,
+        false)) ;
+    OK (GB_mx_random_typed (&B, GrB_FP64, 350, 300, 2000, GxB_SPARSE,
+        false)) ;
+    OK (GB_mx_random_typed (&M, GrB_FP64, 400, 300, 20000, GxB_SPARSE,
+        false)) ;
+
+    //--------------------------------------------------------------------------
+    // C=A*B caches the schedule in B
+    //--------------------------------------------------------------------------
+
+    CHECK (B->saxpy3_schedule == NULL) ;
+    OK (check_mxm (NULL, A, B, desc)) ;
+    GB_saxpy3_schedule S = B->saxpy3_schedule ;
+    CHECK (S != NULL) ;
+    CHECK (S->key.pattern [0][0] == A->pattern_version) ;
+    CHECK (S->key.pattern [1][0] == B->pattern_version) ;
+
+    //--------------------------------------------------------------------------
+    // the same C=A*B reuses the schedule
+    //--------------------------------------------------------------------------
+
+    OK (check_mxm (NULL, A, B, desc)) ;
+    CHECK (B->saxpy3_schedule == S) ;
+
+    // changing only a value of B keeps its pattern and the schedule
+    int64_t version = B->pattern_version ;
+    GrB_Index nvals1, nvals2 ;
+    OK (GrB_Matrix_nvals (&nvals1, B)) ;
+    OK (GrB_Matrix_setElement_FP64 (B, 42, B->i [0], 0)) ;
+    OK (GrB_Matrix_nvals (&nvals2, B)) ;
+    CHECK (nvals1 == nvals2) ;
+    CHECK (B->pattern_version == version) ;
+    CHECK (B->saxpy3_schedule == S) ;
+    OK (check_mxm (NULL, A, B, desc)) ;
+    CHECK (B->saxpy3_schedule == S) ;
+
+    //--------------------------------------------------------------------------
+    // a change to the pattern of B invalidates the schedule
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_setElement_FP64 (B, 1, 349, 299)) ;
+    OK (GrB_Matrix_setElement_FP64 (B, 1, 0, 299)) ;
+    OK (GrB_wait (B, GrB_MATERIALIZE)) ;
+    CHECK (B->pattern_version != version) ;
+    // the new entries are appended to B in place, so the stale schedule can
+    // still be held in B, but it no longer matches the pattern of B
+    CHECK (B->saxpy3_schedule == NULL ||
+           B->saxpy3_schedule->key.pattern [1][0] != B->pattern_version) ;
+    OK (check_mxm (NULL, A, B, desc)) ;
+    S = B->saxpy3_schedule ;
+    CHECK (S != NULL) ;
+    CHECK (S->key.pattern [1][0] == B->pattern_version) ;
+
+    //--------------------------------------------------------------------------
+    // a change to the pattern of A, or a new mask, does not use the schedule
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_removeElement (A, A->i [0], 0)) ;
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (S->key.pattern [0][0] != A->pattern_version) ;
+    OK (check_mxm (NULL, A, B, desc)) ;
+    S = B->saxpy3_schedule ;
+    CHECK (S != NULL) ;
+    CHECK (S->key.pattern [0][0] == A->pattern_version) ;
+
+    OK (check_mxm (M, A, B, desc)) ;
+    S = B->saxpy3_schedule ;
+    CHECK (S != NULL) ;
+    CHECK (S->key.pattern [2][0] == M->pattern_version) ;
+    OK (check_mxm (M, A, B, desc)) ;
+    CHECK (B->saxpy3_schedule == S) ;
+
+    //--------------------------------------------------------------------------
+    // B used by many user threads at the same time
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix C [4] = { NULL, NULL, NULL, NULL } ;
+    GrB_Info cinfo [4] ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        OK (GrB_Matrix_new (&C [k], GrB_FP64, 400, 300)) ;
+    }
+    for (int trial = 0 ; trial < 10 ; trial++)
+    {
+        #pragma omp parallel for num_threads(4) schedule(static,1)
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            // two of the user threads use M, so the cached schedule of B is
+            // replaced while the other two are looking it up
+            cinfo [k] = GrB_mxm (C [k], (k % 2) ? M : NULL, NULL,
+                GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc) ;
+        }
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            OK (cinfo [k]) ;
+        }
+        CHECK (GB_mx_isequal (C [0], C [2], 0)) ;
+        CHECK (GB_mx_isequal (C [1], C [3], 0)) ;
+    }
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        GrB_free (&C [k]) ;
+    }
+    OK (check_mxm (M, A, B, desc)) ;
+
+    // freeing B frees its schedule
+    GrB_free (&B) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_set (GxB_CHUNK, save_chunk)) ;
+    GrB_free (&A) ;
+    GrB_free (&M) ;
+    GrB_free (&desc) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test36:  all tests passed.\n\n") ;
+}
+
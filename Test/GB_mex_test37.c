@@ -0,0 +1,235 @@
+//------------------------------------------------------------------------------
+// GB_mex_test37: test ultra-fine tasks in dot3 and saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A single costly entry C(i,j) in dot3, or a single costly entry B(k,j) in
+// saxpy3, is split into a team of ultra-fine tasks.  The burble is captured
+// to check that the ultra-fine tasks are used, and the result is compared
+// with the result computed by a single thread.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test37"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// user-defined semiring, so that the generic kernel is also tested
+//------------------------------------------------------------------------------
+
+void ultra_min (double *z, const double *x, const double *y) ;
+void ultra_min (double *z, const double *x, const double *y)
+{
+    (*z) = ((*x) < (*y)) ? (*x) : (*y) ;
+}
+#define ULTRA_MIN_DEFN                                                      \
+"void ultra_min (double *z, const double *x, const double *y)           \n" \
+"{                                                                      \n" \
+"    (*z) = ((*x) < (*y)) ? (*x) : (*y) ;                               \n" \
+"}"
+
+void ultra_times (double *z, const double *x, const double *y) ;
+void ultra_times (double *z, const double *x, const double *y)
+{
+    (*z) = (*x) * (*y) ;
+}
+#define ULTRA_TIMES_DEFN                                                    \
+"void ultra_times (double *z, const double *x, const double *y)         \n" \
+"{                                                                      \n" \
+"    (*z) = (*x) * (*y) ;                                               \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// dense_vector: make A(:,j) dense
+//------------------------------------------------------------------------------
+
+static GrB_Info dense_vector
+(
+    GrB_Matrix A,
+    GrB_Index j
+)
+{
+    GrB_Info info ;
+    GrB_Index m ;
+    OK (GrB_Matrix_nrows (&m, A)) ;
+    OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 2, GrB_ALL, m, &j, 1, NULL)) ;
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_mxm: C<M>=A*B with 8 threads, and compare with 1 thread
+//------------------------------------------------------------------------------
+
+static GrB_Info check_mxm
+(
+    GrB_Matrix M,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Semiring semiring,
+    GrB_Type ctype,
+    GrB_Descriptor desc,
+    bool A_transpose
+)
+{
+    GrB_Info info ;
+    GrB_Index m, n ;
+    GrB_Matrix C1 = NULL, C2 = NULL ;
+    if (A_transpose)
+    {
+        OK (GrB_Matrix_ncols (&m, A)) ;
+    }
+    else
+    {
+        OK (GrB_Matrix_nrows (&m, A)) ;
+    }
+    OK (GrB_Matrix_ncols (&n, B)) ;
+    OK (GrB_Matrix_new (&C1, ctype, m, n)) ;
+    OK (GrB_Matrix_new (&C2, ctype, m, n)) ;
+
+    // C1 = A*B with 8 threads, capturing the burble
+    OK (GxB_set (GxB_NTHREADS, 8)) ;
+    OK (GxB_set (GxB_CHUNK, (double) 1)) ;
+    GB_mx_burble_start ("ultra-fine") ;
+    info = GrB_mxm (C1, M, NULL, semiring, A, B, desc) ;
+    bool ultra_found = GB_mx_burble_stop ( ) ;
+    OK (info) ;
+    CHECK (ultra_found) ;
+
+    // C2 = A*B with 1 thread
+    OK (GxB_set (GxB_NTHREADS, 1)) ;
+    OK (GrB_mxm (C2, M, NULL, semiring, A, B, desc)) ;
+    OK (GrB_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (C2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test37 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL ;
+    GrB_Descriptor ddot = NULL, dsax = NULL ;
+    GrB_BinaryOp umin = NULL, utimes = NULL ;
+    GrB_Monoid umonoid = NULL ;
+    GrB_Semiring usemiring = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_get (GxB_CHUNK, &save_chunk)) ;
+    simple_rand_seed (1) ;
+
+    OK (GrB_Descriptor_new (&ddot)) ;
+    OK (GxB_set (ddot, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GxB_set (ddot, GrB_INP0, GrB_TRAN)) ;
+    OK (GrB_Descriptor_new (&dsax)) ;
+    OK (GxB_set (dsax, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+
+    OK (GxB_BinaryOp_new (&umin, (GxB_binary_function) ultra_min,
+        GrB_FP64, GrB_FP64, GrB_FP64, "ultra_min", ULTRA_MIN_DEFN)) ;
+    OK (GxB_BinaryOp_new (&utimes, (GxB_binary_function) ultra_times,
+        GrB_FP64, GrB_FP64, GrB_FP64, "ultra_times", ULTRA_TIMES_DEFN)) ;
+    OK (GrB_Monoid_new_FP64 (&umonoid, umin, INFINITY)) ;
+    OK (GrB_Semiring_new (&usemiring, umonoid, utimes)) ;
+
+    #define NSEMIRINGS 5
+    GrB_Semiring semirings [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64, GxB_PLUS_PAIR_FP64, GxB_MIN_FIRSTJ_INT64,
+        usemiring } ;
+    GrB_Type ctypes [NSEMIRINGS] = { GrB_FP64, GrB_FP64, GrB_FP64, GrB_INT64,
+        GrB_FP64 } ;
+
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        int sparsity = (trial % 2 == 0) ? GxB_SPARSE : GxB_HYPERSPARSE ;
+        bool first = (trial < 2) ;
+
+        //----------------------------------------------------------------------
+        // dot3: C<M>=A'*B where C(i,j) is costly, at either end of C
+        //----------------------------------------------------------------------
+
+        int64_t k = 20000, m = 300, n = 200 ;
+        OK (GB_mx_random_typed (&A, GrB_FP64, k, m, 3000, sparsity, false)) ;
+        OK (dense_vector (A, first ? 0 : m-1)) ;
+        OK (GB_mx_random_typed (&B, GrB_FP64, k, n, 2000, sparsity, false)) ;
+        OK (dense_vector (B, first ? 0 : n-1)) ;
+        OK (GB_mx_random_typed (&M, GrB_FP64, m, n, 2000, sparsity, false)) ;
+        OK (GrB_Matrix_setElement_FP64 (M, 1, 0, 0)) ;
+        OK (GrB_Matrix_setElement_FP64 (M, 1, m-1, n-1)) ;
+        OK (GrB_wait (M, GrB_MATERIALIZE)) ;
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            OK (check_mxm (M, A, B, semirings [s], ctypes [s], ddot, true)) ;
+        }
+        GrB_free (&A) ;
+        GrB_free (&B) ;
+        GrB_free (&M) ;
+
+        //----------------------------------------------------------------------
+        // saxpy3: C=A*B where A(:,5) is dense and B(5,j) is costly
+        //----------------------------------------------------------------------
+
+        m = 20000 ; k = 300 ; n = 200 ;
+        OK (GB_mx_random_typed (&A, GrB_FP64, m, k, 3000, sparsity, false)) ;
+        OK (dense_vector (A, 5)) ;
+        OK (GB_mx_random_typed (&B, GrB_FP64, k, n, 600, sparsity, false)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, 2, 5, 7)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, 3, 5, 9)) ;
+        OK (GrB_wait (B, GrB_MATERIALIZE)) ;
+        if (!first)
+        {
+            OK (GB_mx_random_typed (&M, GrB_FP64, m, n, 20000, GxB_SPARSE,
+                false)) ;
+        }
+        for (int s = 0 ; s < NSEMIRINGS ; s++)
+        {
+            OK (check_mxm (M, A, B, semirings [s], ctypes [s], dsax, false)) ;
+        }
+        GrB_free (&A) ;
+        GrB_free (&B) ;
+        GrB_free (&M) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_set (GxB_CHUNK, save_chunk)) ;
+    GrB_free (&ddot) ;
+    GrB_free (&dsax) ;
+    GrB_free (&usemiring) ;
+    GrB_free (&umonoid) ;
+    GrB_free (&umin) ;
+    GrB_free (&utimes) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test37:  all tests passed.\n\n") ;
+}
+
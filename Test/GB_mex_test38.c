@@ -0,0 +1,252 @@
+//------------------------------------------------------------------------------
+// GB_mex_test38: test the tiled dot2 method for C=A'*B with A and B full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A'*B is computed with A and B full, which uses the tiled dot2 method for
+// built-in types, and compared with the same product computed with A and B
+// sparse, which uses the non-tiled method.  The dimensions are not multiples
+// of the tile sizes.  A user-defined type larger than GB_DOT2_TILE_MAXSIZE
+// checks that the non-tiled method is used for it.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test38"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// a large user-defined type
+//------------------------------------------------------------------------------
+
+typedef struct { double x [8] ; } big8 ;
+#define BIG8_DEFN "typedef struct { double x [8] ; } big8 ;"
+
+void big8_plus (big8 *z, const big8 *a, const big8 *b) ;
+void big8_plus (big8 *z, const big8 *a, const big8 *b)
+{
+    for (int t = 0 ; t < 8 ; t++) z->x [t] = a->x [t] + b->x [t] ;
+}
+#define BIG8_PLUS_DEFN                                                      \
+"void big8_plus (big8 *z, const big8 *a, const big8 *b)                 \n" \
+"{                                                                      \n" \
+"    for (int t = 0 ; t < 8 ; t++) z->x [t] = a->x [t] + b->x [t] ;     \n" \
+"}"
+
+void big8_times (big8 *z, const big8 *a, const big8 *b) ;
+void big8_times (big8 *z, const big8 *a, const big8 *b)
+{
+    for (int t = 0 ; t < 8 ; t++) z->x [t] = a->x [t] * b->x [t] ;
+}
+#define BIG8_TIMES_DEFN                                                     \
+"void big8_times (big8 *z, const big8 *a, const big8 *b)                \n" \
+"{                                                                      \n" \
+"    for (int t = 0 ; t < 8 ; t++) z->x [t] = a->x [t] * b->x [t] ;     \n" \
+"}"
+
+void big8_from (big8 *z, const double *x) ;
+void big8_from (big8 *z, const double *x)
+{
+    for (int t = 0 ; t < 8 ; t++) z->x [t] = (*x) + t ;
+}
+#define BIG8_FROM_DEFN                                                      \
+"void big8_from (big8 *z, const double *x)                              \n" \
+"{                                                                      \n" \
+"    for (int t = 0 ; t < 8 ; t++) z->x [t] = (*x) + t ;                \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// full_matrix: create a full matrix with small random values
+//------------------------------------------------------------------------------
+
+// If big8from is not NULL, a random double matrix is converted to big8.
+
+static GrB_Info full_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    int64_t m,
+    int64_t n,
+    bool iso,
+    GrB_UnaryOp big8from
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL, X = NULL ;
+    OK (GB_mx_random_typed (&X, (big8from == NULL) ? type : GrB_FP64, m, n,
+        m * n, GxB_FULL, iso)) ;
+    if (big8from == NULL)
+    {
+        A = X ;
+    }
+    else
+    {
+        OK (GrB_Matrix_new (&A, type, m, n)) ;
+        OK (GrB_Matrix_apply (A, NULL, NULL, big8from, X, NULL)) ;
+        OK (GxB_set (A, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
+        GrB_free (&X) ;
+    }
+    CHECK (GB_IS_FULL (A)) ;
+    (*A_handle) = A ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_dot2: C=A'*B with A and B full, and with A and B sparse
+//------------------------------------------------------------------------------
+
+static GrB_Info check_dot2
+(
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Semiring semiring,
+    GrB_Type ctype,
+    GrB_Descriptor desc
+)
+{
+    GrB_Info info ;
+    GrB_Index m, n ;
+    GrB_Matrix C1 = NULL, C2 = NULL, A2 = NULL, B2 = NULL ;
+    OK (GrB_Matrix_ncols (&m, A)) ;
+    OK (GrB_Matrix_ncols (&n, B)) ;
+    OK (GrB_Matrix_new (&C1, ctype, m, n)) ;
+    OK (GrB_Matrix_new (&C2, ctype, m, n)) ;
+
+    // C1 = A'*B with A and B full
+    OK (GrB_mxm (C1, NULL, NULL, semiring, A, B, desc)) ;
+
+    // C2 = A'*B with A and B sparse
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_dup (&B2, B)) ;
+    OK (GxB_set (A2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (B2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_IS_SPARSE (A2) && GB_IS_SPARSE (B2)) ;
+    OK (GrB_mxm (C2, NULL, NULL, semiring, A2, B2, desc)) ;
+
+    OK (GxB_set (C1, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    GrB_free (&A2) ;
+    GrB_free (&B2) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test38 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Type big8type = NULL ;
+    GrB_BinaryOp big8plus = NULL, big8times = NULL ;
+    GrB_UnaryOp big8from = NULL ;
+    GrB_Monoid big8monoid = NULL ;
+    GrB_Semiring big8semiring = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_get (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    OK (GxB_set (GxB_CHUNK, (double) 1)) ;
+    simple_rand_seed (1) ;
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GxB_set (desc, GrB_INP0, GrB_TRAN)) ;
+
+    OK (GxB_Type_new (&big8type, sizeof (big8), "big8", BIG8_DEFN)) ;
+    OK (GxB_BinaryOp_new (&big8plus, (GxB_binary_function) big8_plus,
+        big8type, big8type, big8type, "big8_plus", BIG8_PLUS_DEFN)) ;
+    OK (GxB_BinaryOp_new (&big8times, (GxB_binary_function) big8_times,
+        big8type, big8type, big8type, "big8_times", BIG8_TIMES_DEFN)) ;
+    OK (GxB_UnaryOp_new (&big8from, (GxB_unary_function) big8_from,
+        big8type, GrB_FP64, "big8_from", BIG8_FROM_DEFN)) ;
+    big8 zero ;
+    memset (&zero, 0, sizeof (big8)) ;
+    OK (GrB_Monoid_new_UDT (&big8monoid, big8plus, &zero)) ;
+    OK (GrB_Semiring_new (&big8semiring, big8monoid, big8times)) ;
+
+    //--------------------------------------------------------------------------
+    // test the semirings
+    //--------------------------------------------------------------------------
+
+    #define NSEMIRINGS 9
+    GrB_Semiring semirings [NSEMIRINGS] = {
+        GrB_PLUS_TIMES_SEMIRING_INT8,       // int8
+        GrB_MIN_PLUS_SEMIRING_INT64,        // int64
+        GrB_PLUS_TIMES_SEMIRING_FP32,       // float
+        GrB_PLUS_TIMES_SEMIRING_FP64,       // double
+        GrB_MAX_MIN_SEMIRING_FP64,          // double
+        GxB_PLUS_TIMES_FC64,                // double complex, 16 bytes
+        GrB_PLUS_TIMES_SEMIRING_FP64,       // int8 inputs typecast to double
+        GxB_PLUS_SECONDI_INT64,             // positional, but uses A
+        big8semiring } ;                    // user-defined, 64 bytes
+    GrB_Type atypes [NSEMIRINGS] = { GrB_INT8, GrB_INT64, GrB_FP32,
+        GrB_FP64, GrB_FP64, GxB_FC64, GrB_INT8, GrB_INT64, big8type } ;
+    GrB_Type ctypes [NSEMIRINGS] = { GrB_INT8, GrB_INT64, GrB_FP32,
+        GrB_FP64, GrB_FP64, GxB_FC64, GrB_FP64, GrB_INT64, big8type } ;
+
+    // dimensions: k, m, n, where C is m-by-n and A and B have k rows
+    #define NDIMS 5
+    int64_t dims [NDIMS][3] = { { 300, 37, 23 }, { 1, 17, 5 },
+        { 128, 16, 4 }, { 129, 33, 9 }, { 1000, 3, 1 } } ;
+
+    for (int s = 0 ; s < NSEMIRINGS ; s++)
+    {
+        for (int d = 0 ; d < NDIMS ; d++)
+        {
+            int64_t k = dims [d][0], m = dims [d][1], n = dims [d][2] ;
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                GrB_UnaryOp from = (atypes [s] == big8type) ? big8from : NULL ;
+                OK (full_matrix (&A, atypes [s], k, m, iso, from)) ;
+                OK (full_matrix (&B, atypes [s], k, n, false, from)) ;
+                OK (check_dot2 (A, B, semirings [s], ctypes [s], desc)) ;
+                GrB_free (&A) ;
+                GrB_free (&B) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_set (GxB_CHUNK, save_chunk)) ;
+    GrB_free (&desc) ;
+    GrB_free (&big8semiring) ;
+    GrB_free (&big8monoid) ;
+    GrB_free (&big8plus) ;
+    GrB_free (&big8times) ;
+    GrB_free (&big8from) ;
+    GrB_free (&big8type) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test38:  all tests passed.\n\n") ;
+}
+
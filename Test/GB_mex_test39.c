@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+// GB_mex_test39: test C+=A*B computed in place with C bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>+=A*B is computed with C bitmap and the accum operator equal to the
+// monoid of the semiring, so that the dot2 and saxbit methods can accumulate
+// the result into C in place.  The burble is captured to check that C is
+// computed in place, and the result is compared with T=A*B followed by
+// C<M>=C+T.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test39"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// check_in_place: C<M>+=A*B with C bitmap, and compare with C<M>=C+T
+//------------------------------------------------------------------------------
+
+static GrB_Info check_in_place
+(
+    GrB_Matrix C0,
+    GrB_Matrix M,
+    GrB_BinaryOp accum,
+    GrB_Semiring semiring,
+    GrB_Type ctype,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Descriptor desc,
+    bool *in_place
+)
+{
+    GrB_Info info ;
+    GrB_Index m, n ;
+    GrB_Matrix C1 = NULL, C2 = NULL, T = NULL ;
+    OK (GrB_Matrix_nrows (&m, C0)) ;
+    OK (GrB_Matrix_ncols (&n, C0)) ;
+    OK (GrB_Matrix_dup (&C1, C0)) ;
+    OK (GrB_Matrix_dup (&C2, C0)) ;
+    OK (GrB_Matrix_new (&T, ctype, m, n)) ;
+    OK (GxB_set (C1, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    CHECK (GB_IS_BITMAP (C1)) ;
+
+    // C1<M> += A*B, capturing the burble
+    GB_mx_burble_start ("C in place") ;
+    info = GrB_mxm (C1, M, accum, semiring, A, B, desc) ;
+    (*in_place) = GB_mx_burble_stop ( ) ;
+    OK (info) ;
+
+    // C2<M> = C2 + T where T = A*B
+    OK (GrB_mxm (T, NULL, NULL, semiring, A, B, desc)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, M, NULL, accum, C2, T, NULL)) ;
+
+    OK (GxB_set (C1, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    GrB_free (&T) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test39 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C0 = NULL, M = NULL ;
+    GrB_Descriptor ddot = NULL, dsax = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_get (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    OK (GxB_set (GxB_CHUNK, (double) 1)) ;
+    simple_rand_seed (1) ;
+
+    // C+=A'*B with the dot2 method
+    OK (GrB_Descriptor_new (&ddot)) ;
+    OK (GxB_set (ddot, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GxB_set (ddot, GrB_INP0, GrB_TRAN)) ;
+
+    // C+=A*B with the saxbit method
+    OK (GrB_Descriptor_new (&dsax)) ;
+    OK (GxB_set (dsax, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+
+    #define NSEMIRINGS 4
+    GrB_Semiring semirings [NSEMIRINGS] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64, GrB_PLUS_TIMES_SEMIRING_INT32,
+        GrB_MAX_MIN_SEMIRING_INT64 } ;
+    GrB_BinaryOp accums [NSEMIRINGS] = { GrB_PLUS_FP64, GrB_MIN_FP64,
+        GrB_PLUS_INT32, GrB_MAX_INT64 } ;
+    GrB_Type types [NSEMIRINGS] = { GrB_FP64, GrB_FP64, GrB_INT32,
+        GrB_INT64 } ;
+
+    #define NSPARSITY 3
+    int sparsity [NSPARSITY] = { GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    int64_t k = 200, m = 150, n = 40 ;
+    int ndot_in_place = 0, nsax_in_place = 0 ;
+
+    for (int s = 0 ; s < NSEMIRINGS ; s++)
+    {
+        GrB_Type type = types [s] ;
+        for (int as = 0 ; as < NSPARSITY ; as++)
+        {
+            for (int bs = 0 ; bs < NSPARSITY ; bs++)
+            {
+                int64_t anz = 2000, bnz = 1000 ;
+                OK (GB_mx_random_typed (&B, type, k, n, bnz, sparsity [bs],
+                    false)) ;
+                for (int cfull = 0 ; cfull <= 1 ; cfull++)
+                {
+                    // C0 has some entries, or all of them
+                    OK (GB_mx_random_typed (&C0, type, m, n, 1000,
+                        cfull ? GxB_FULL : GxB_BITMAP, false)) ;
+                    for (int mk = 0 ; mk <= 1 ; mk++)
+                    {
+                        if (mk)
+                        {
+                            OK (GB_mx_random_typed (&M, GrB_BOOL, m, n, 3000,
+                                GxB_BITMAP, false)) ;
+                        }
+                        bool in_place ;
+
+                        // C<M> += A'*B with the dot2 method
+                        OK (GB_mx_random_typed (&A, type, k, m, anz,
+                            sparsity [as], false)) ;
+                        OK (check_in_place (C0, M, accums [s], semirings [s],
+                            type, A, B, ddot, &in_place)) ;
+                        if (in_place) ndot_in_place++ ;
+                        GrB_free (&A) ;
+
+                        // C<M> += A*B with the saxbit method
+                        OK (GB_mx_random_typed (&A, type, m, k, anz,
+                            sparsity [as], false)) ;
+                        OK (check_in_place (C0, M, accums [s], semirings [s],
+                            type, A, B, dsax, &in_place)) ;
+                        if (in_place) nsax_in_place++ ;
+                        GrB_free (&A) ;
+                        GrB_free (&M) ;
+                    }
+                    GrB_free (&C0) ;
+                }
+                GrB_free (&B) ;
+            }
+        }
+    }
+
+    // C must be computed in place by both methods, at least some of the time
+    printf ("in place: dot2 %d saxbit %d\n", ndot_in_place, nsax_in_place) ;
+    CHECK (ndot_in_place > 0) ;
+    CHECK (nsax_in_place > 0) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_set (GxB_CHUNK, save_chunk)) ;
+    GrB_free (&ddot) ;
+    GrB_free (&dsax) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test39:  all tests passed.\n\n") ;
+}
+
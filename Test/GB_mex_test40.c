@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+// GB_mex_test40: test the masked selector, C<M>=select(A)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=select(A) is computed with the JIT on and off, and compared with
+// T=select(A) followed by C<M>=T.  The burble is captured to check that the
+// masked selector is used with the JIT on, and that built-in VALUE* ops use
+// the unmasked selector (with its factory kernels) when the JIT is off.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test40"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// user-defined index-unary operator
+//------------------------------------------------------------------------------
+
+void band_gt (bool *z, const double *x, GrB_Index i, GrB_Index j,
+    const double *y) ;
+void band_gt (bool *z, const double *x, GrB_Index i, GrB_Index j,
+    const double *y)
+{
+    (*z) = ((*x) > (*y)) && (i + 10 >= j) ;
+}
+#define BAND_GT_DEFN                                                        \
+"void band_gt (bool *z, const double *x, GrB_Index i, GrB_Index j,      \n" \
+"    const double *y)                                                   \n" \
+"{                                                                      \n" \
+"    (*z) = ((*x) > (*y)) && (i + 10 >= j) ;                            \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// check_select: C<M>=select(A), and compare with T=select(A), C<M>=T
+//------------------------------------------------------------------------------
+
+static GrB_Info check_select
+(
+    GrB_Matrix C0,
+    GrB_Matrix M,
+    GrB_IndexUnaryOp op,
+    GrB_Matrix A,
+    double thunk,
+    GrB_Descriptor desc,
+    bool *masked
+)
+{
+    GrB_Info info ;
+    GrB_Index m, n ;
+    GrB_Matrix C1 = NULL, C2 = NULL, T = NULL ;
+    OK (GrB_Matrix_nrows (&m, A)) ;
+    OK (GrB_Matrix_ncols (&n, A)) ;
+    OK (GrB_Matrix_dup (&C1, C0)) ;
+    OK (GrB_Matrix_dup (&C2, C0)) ;
+    OK (GrB_Matrix_new (&T, GrB_FP64, m, n)) ;
+
+    // C1<M> = select (A), capturing the burble
+    GB_mx_burble_start ("masked select") ;
+    info = GrB_Matrix_select_FP64 (C1, M, NULL, op, A, thunk, desc) ;
+    (*masked) = GB_mx_burble_stop ( ) ;
+    OK (info) ;
+
+    // C2<M> = T where T = select (A)
+    OK (GrB_Matrix_select_FP64 (T, NULL, NULL, op, A, thunk, NULL)) ;
+    OK (GrB_Matrix_apply (C2, M, NULL, GrB_IDENTITY_FP64, T, desc)) ;
+
+    OK (GrB_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GxB_set (C1, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    GrB_free (&T) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test40 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C0 = NULL, M = NULL ;
+    GrB_Descriptor desc [4] = { NULL, NULL, NULL, NULL } ;
+    GrB_IndexUnaryOp bandgt = NULL ;
+    int save_control ;
+    OK (GxB_get (GxB_JIT_C_CONTROL, &save_control)) ;
+    simple_rand_seed (1) ;
+
+    OK (GxB_IndexUnaryOp_new (&bandgt, (GxB_index_unary_function) band_gt,
+        GrB_BOOL, GrB_FP64, GrB_FP64, "band_gt", BAND_GT_DEFN)) ;
+
+    // desc [0]: NULL, [1]: structural, [2]: complemented, [3]: both
+    for (int d = 1 ; d < 4 ; d++)
+    {
+        OK (GrB_Descriptor_new (&desc [d])) ;
+        if (d & 1) OK (GxB_set (desc [d], GrB_MASK, GrB_STRUCTURE)) ;
+        if (d & 2) OK (GxB_set (desc [d], GrB_MASK, GrB_COMP)) ;
+    }
+
+    #define NOPS 4
+    GrB_IndexUnaryOp ops [NOPS] = { GrB_VALUEGT_FP64, GrB_VALUENE_FP64,
+        GrB_TRIL, bandgt } ;
+    bool builtin_value [NOPS] = { true, true, false, false } ;
+
+    int64_t m = 500, n = 400 ;
+
+    for (int jit = 1 ; jit >= 0 ; jit--)
+    {
+        OK (GxB_set (GxB_JIT_C_CONTROL, jit ? GxB_JIT_ON : GxB_JIT_OFF)) ;
+        for (int as = 0 ; as <= 1 ; as++)
+        {
+            int asparsity = as ? GxB_HYPERSPARSE : GxB_SPARSE ;
+            OK (GB_mx_random_typed (&A, GrB_FP64, m, n, 20000, asparsity,
+                false)) ;
+            OK (GB_mx_random_typed (&C0, GrB_FP64, m, n, 1000, GxB_SPARSE,
+                false)) ;
+            for (int ms = 0 ; ms <= 1 ; ms++)
+            {
+                // a very sparse M, or a bitmap M
+                int msparsity = ms ? GxB_BITMAP : GxB_SPARSE ;
+                OK (GB_mx_random_typed (&M, GrB_FP64, m, n, ms ? 50000 : 300,
+                    msparsity, false)) ;
+                for (int d = 0 ; d < 4 ; d++)
+                {
+                    // a complemented sparse M does not use the masked select
+                    bool comp = (d & 2) ;
+                    bool can_mask = !(comp && !ms) ;
+                    for (int k = 0 ; k < NOPS ; k++)
+                    {
+                        bool masked ;
+                        OK (check_select (C0, M, ops [k], A, 0, desc [d],
+                            &masked)) ;
+                        bool expected = can_mask &&
+                            (jit || !builtin_value [k]) ;
+                        CHECK (masked == expected) ;
+                    }
+                }
+                GrB_free (&M) ;
+            }
+            GrB_free (&A) ;
+            GrB_free (&C0) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_JIT_C_CONTROL, save_control)) ;
+    for (int d = 0 ; d < 4 ; d++)
+    {
+        GrB_free (&desc [d]) ;
+    }
+    GrB_free (&bandgt) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test40:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// GB_mex_test41: test C=A(I,:) with a large list I
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A(I,:) is computed with a list I of more than 64K entries, which is
+// inverted in parallel by GB_I_inverse.  I is sorted or unsorted, with or
+// without duplicates.  The result is compared with C=P*A, where P(k,I(k))=1.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test41"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// check_subref: C=A(I,:) with 1 and 4 threads, and compare with C=P*A
+//------------------------------------------------------------------------------
+
+static GrB_Info check_subref
+(
+    GrB_Matrix A,
+    GrB_Index *I,
+    GrB_Index nI
+)
+{
+    GrB_Info info ;
+    GrB_Index m, n ;
+    GrB_Matrix C1 = NULL, C2 = NULL, C3 = NULL, P = NULL ;
+    GrB_Scalar one = NULL ;
+    GrB_Index *K = NULL ;
+    OK (GrB_Matrix_nrows (&m, A)) ;
+    OK (GrB_Matrix_ncols (&n, A)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, nI, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, nI, n)) ;
+    OK (GrB_Matrix_new (&C3, GrB_FP64, nI, n)) ;
+
+    // C1 = A(I,:) with 4 threads, so I is inverted in parallel
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    OK (GrB_Matrix_extract (C1, NULL, NULL, A, I, nI, GrB_ALL, n, NULL)) ;
+
+    // C2 = A(I,:) with 1 thread, so I is inverted sequentially
+    OK (GxB_set (GxB_NTHREADS, 1)) ;
+    OK (GrB_Matrix_extract (C2, NULL, NULL, A, I, nI, GrB_ALL, n, NULL)) ;
+
+    // C3 = P*A where P(k,I(k)) = 1
+    K = mxMalloc (nI * sizeof (GrB_Index)) ;
+    CHECK (K != NULL) ;
+    for (int64_t k = 0 ; k < nI ; k++)
+    {
+        K [k] = k ;
+    }
+    OK (GrB_Scalar_new (&one, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (one, 1)) ;
+    OK (GrB_Matrix_new (&P, GrB_FP64, nI, m)) ;
+    OK (GxB_Matrix_build_Scalar (P, K, I, one, nI)) ;
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    OK (GrB_mxm (C3, NULL, NULL, GxB_PLUS_SECOND_FP64, P, A, NULL)) ;
+
+    OK (GrB_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (C2, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (C3, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    OK (GxB_set (C1, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C3, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_mx_isequal (C1, C3, 0)) ;
+
+    mxFree (K) ;
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    GrB_free (&C3) ;
+    GrB_free (&P) ;
+    GrB_free (&one) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test41 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_get (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_set (GxB_CHUNK, (double) 1)) ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // create A, with about 200 entries in each column
+    //--------------------------------------------------------------------------
+
+    int64_t m = 100000, n = 20, anz = 4000 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GxB_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int64_t k = 0 ; k < anz ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % m ;
+        int64_t j = simple_rand_i ( ) % n ;
+        double x = (double) (simple_rand ( ) % 9) + 1 ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+
+    GrB_Index nI = 3 * 32 * 1024 ;
+    GrB_Index *I = mxMalloc (nI * sizeof (GrB_Index)) ;
+    CHECK (I != NULL) ;
+
+    for (int hyper = 0 ; hyper <= 1 ; hyper++)
+    {
+        OK (GxB_set (A, GxB_SPARSITY_CONTROL,
+            hyper ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+
+        //----------------------------------------------------------------------
+        // I unsorted, with duplicates
+        //----------------------------------------------------------------------
+
+        for (int64_t k = 0 ; k < nI ; k++)
+        {
+            I [k] = simple_rand_i ( ) % m ;
+        }
+        OK (check_subref (A, I, nI)) ;
+
+        //----------------------------------------------------------------------
+        // I sorted, with duplicates
+        //----------------------------------------------------------------------
+
+        for (int64_t k = 0 ; k < nI ; k++)
+        {
+            I [k] = k / 2 ;
+        }
+        OK (check_subref (A, I, nI)) ;
+
+        //----------------------------------------------------------------------
+        // I unsorted, with no duplicates
+        //----------------------------------------------------------------------
+
+        // I is a random subset of 0:m-1, in random order
+        GrB_Index *Perm = mxMalloc (m * sizeof (GrB_Index)) ;
+        CHECK (Perm != NULL) ;
+        for (int64_t k = 0 ; k < m ; k++)
+        {
+            Perm [k] = k ;
+        }
+        for (int64_t k = m-1 ; k > 0 ; k--)
+        {
+            int64_t t = simple_rand_i ( ) % (k+1) ;
+            GrB_Index e = Perm [k] ; Perm [k] = Perm [t] ; Perm [t] = e ;
+        }
+        for (int64_t k = 0 ; k < nI ; k++)
+        {
+            I [k] = Perm [k] ;
+        }
+        mxFree (Perm) ;
+        OK (check_subref (A, I, nI)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_set (GxB_CHUNK, save_chunk)) ;
+    mxFree (I) ;
+    GrB_free (&A) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test41:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,215 @@
+//------------------------------------------------------------------------------
+// GB_mex_test42: test the cached slice of a matrix for GB_ek_slice
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix is sliced by GB_ek_slice into many tasks, and sliced again after
+// its values change (the cached slice is reused), after its pattern changes
+// (the cached slice is recomputed, in the same space), and with a different
+// number of tasks.  Each slice is compared with a slice computed without the
+// cache.  The time to slice A with and without the cache is printed.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_ek_slice.h"
+
+#define USAGE "GB_mex_test42"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// check_slice: slice A, and compare with the slice computed without the cache
+//------------------------------------------------------------------------------
+
+#define NTASKS_MAX 1024
+static int64_t W1 [3*NTASKS_MAX+1], W2 [3*NTASKS_MAX+1] ;
+
+static GrB_Info check_slice
+(
+    GrB_Matrix A,
+    int ntasks,
+    bool *cached
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A2 = NULL ;
+    int64_t n = 3 * ntasks + 1 ;
+
+    // W1: the slice of A, capturing the burble
+    GB_mx_burble_start ("cached slice") ;
+    GB_ek_slice (W1, A, ntasks) ;
+    (*cached) = GB_mx_burble_stop ( ) ;
+
+    // the slice of A is now cached
+    GB_ek_slice_cache S = A->ek_slice_cache ;
+    CHECK (S != NULL) ;
+    CHECK (S->key.pattern_version == A->pattern_version) ;
+    CHECK (S->key.ntasks == ntasks) ;
+    CHECK (memcmp (S->ek_slicing, W1, n * sizeof (int64_t)) == 0) ;
+
+    // W2: the slice of a copy of A, with no cached slice
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    CHECK (A2->ek_slice_cache == NULL) ;
+    GB_ek_slice (W2, A2, ntasks) ;
+    CHECK (memcmp (W1, W2, n * sizeof (int64_t)) == 0) ;
+
+    GrB_free (&A2) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test42 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    bool cached ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // create A with uneven vectors
+    //--------------------------------------------------------------------------
+
+    int64_t m = 1000, n = 100000, anz = 200000 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GxB_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    for (int64_t k = 0 ; k < anz ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % m ;
+        int64_t j = (simple_rand_i ( ) % n) ;
+        j = (j * j) / n ;
+        OK (GrB_Matrix_setElement_FP64 (A, 1, i, j)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // a slice with few tasks is not cached
+    //--------------------------------------------------------------------------
+
+    GB_ek_slice (W1, A, GB_EK_SLICE_CACHE_MIN - 1) ;
+    CHECK (A->ek_slice_cache == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // the slice is cached, and reused
+    //--------------------------------------------------------------------------
+
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (!cached) ;
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (cached) ;
+
+    // a change to the values of A keeps the cached slice
+    OK (GrB_Matrix_setElement_FP64 (A, 2, A->i [0], 0)) ;
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (cached) ;
+
+    //--------------------------------------------------------------------------
+    // a change to the pattern of A invalidates the cached slice
+    //--------------------------------------------------------------------------
+
+    // add entries to A
+    for (int64_t k = 0 ; k < 1000 ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % m ;
+        int64_t j = simple_rand_i ( ) % n ;
+        OK (GrB_Matrix_setElement_FP64 (A, 3, i, j)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (!cached) ;
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (cached) ;
+
+    // delete entries from A
+    for (int64_t k = 0 ; k < 1000 ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % m ;
+        int64_t j = simple_rand_i ( ) % n ;
+        OK (GrB_Matrix_removeElement (A, i, j)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (!cached) ;
+
+    // the space of the cache is reused for a new slice that fits in it
+    GB_ek_slice_cache S = A->ek_slice_cache ;
+    int64_t *S_ek_slicing = S->ek_slicing ;
+    S->key.pattern_version = -1 ;
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (!cached) ;
+    OK (check_slice (A, 260, &cached)) ;
+    CHECK (!cached) ;
+    CHECK (A->ek_slice_cache == S) ;
+    CHECK (S->ek_slicing == S_ek_slicing) ;
+
+    //--------------------------------------------------------------------------
+    // a different number of tasks does not use the cached slice
+    //--------------------------------------------------------------------------
+
+    OK (check_slice (A, 280, &cached)) ;
+    CHECK (!cached) ;
+    OK (check_slice (A, 280, &cached)) ;
+    CHECK (cached) ;
+    OK (check_slice (A, 300, &cached)) ;
+    CHECK (!cached) ;
+    OK (check_slice (A, NTASKS_MAX, &cached)) ;
+    CHECK (!cached) ;
+    OK (check_slice (A, NTASKS_MAX, &cached)) ;
+    CHECK (cached) ;
+
+    //--------------------------------------------------------------------------
+    // time the slice of A with and without the cache
+    //--------------------------------------------------------------------------
+
+    int ntrials = 1000 ;
+    double t_hit = GB_omp_get_wtime ( ) ;
+    for (int trial = 0 ; trial < ntrials ; trial++)
+    {
+        GB_ek_slice (W1, A, NTASKS_MAX) ;
+    }
+    t_hit = GB_omp_get_wtime ( ) - t_hit ;
+
+    double t_miss = GB_omp_get_wtime ( ) ;
+    for (int trial = 0 ; trial < ntrials ; trial++)
+    {
+        // invalidate the cached slice, as if the pattern of A had changed
+        A->ek_slice_cache->key.pattern_version = -1 ;
+        GB_ek_slice (W1, A, NTASKS_MAX) ;
+    }
+    t_miss = GB_omp_get_wtime ( ) - t_miss ;
+
+    printf ("ek_slice of A, %d tasks: cached %g usec, not cached %g usec\n",
+        NTASKS_MAX, 1e6 * t_hit / ntrials, 1e6 * t_miss / ntrials) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    // freeing A frees its cached slice
+    GrB_free (&A) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test42:  all tests passed.\n\n") ;
+}
+
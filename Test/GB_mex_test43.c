@@ -0,0 +1,232 @@
+//------------------------------------------------------------------------------
+// GB_mex_test43: test GB_wait_merge, with many threads
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Entries are deleted from a matrix (creating zombies) and new entries are
+// added (creating pending tuples), so that GrB_wait computes S=A+T and drops
+// the zombies of A in a single pass, with GB_wait_merge.  This is done with 4
+// threads, so that the entries of A and T are sliced across many tasks, and
+// the result is compared with the same matrix finished with GrB_wait after
+// the deletions and again after the insertions, which does not use
+// GB_wait_merge.  Matrices and vectors of each size of entry are tested,
+// including iso and user-defined types.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test43"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// a user-defined type of size 24
+//------------------------------------------------------------------------------
+
+typedef struct { double x [3] ; } triple ;
+#define TRIPLE_DEFN "typedef struct { double x [3] ; } triple ;"
+
+//------------------------------------------------------------------------------
+// set_entry: A(i,j) = x
+//------------------------------------------------------------------------------
+
+static GrB_Info set_entry
+(
+    GrB_Matrix A,
+    double x,
+    int64_t i,
+    int64_t j
+)
+{
+    GrB_Info info ;
+    if (A->type->code == GB_UDT_code)
+    {
+        triple t = { { x, 2*x, 3*x } } ;
+        OK (GrB_Matrix_setElement_UDT (A, &t, i, j)) ;
+    }
+    else
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_merge: delete and add entries to A, and finish it with GB_wait_merge
+//------------------------------------------------------------------------------
+
+static GrB_Info check_merge
+(
+    GrB_Type type,
+    int64_t m,
+    int64_t n,
+    int64_t anz,            // # of entries to add to A at the start
+    int64_t ndel,           // # of entries to delete
+    int64_t nadd,           // # of entries to add
+    int sparsity,
+    bool iso
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL ;
+
+    // create A and B, with the same entries
+    OK (GrB_Matrix_new (&A, type, m, n)) ;
+    OK (GxB_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+    for (int64_t k = 0 ; k < anz ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % m ;
+        int64_t j = simple_rand_i ( ) % n ;
+        double x = iso ? 1 : ((double) (simple_rand ( ) % 100) + 1) ;
+        OK (set_entry (A, x, i, j)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_dup (&B, A)) ;
+    CHECK (A->iso == iso) ;
+
+    // delete entries from A and B
+    for (int64_t k = 0 ; k < ndel ; k++)
+    {
+        // delete an entry that is likely to be present
+        int64_t p = simple_rand_i ( ) % anz ;
+        p = GB_IMIN (p, GB_nnz (A) - 1) ;
+        int64_t i = A->i [p] ;
+        if (i < 0) continue ;   // A(i,j) is already a zombie
+        int64_t j = -1 ;
+        for (int64_t kA = 0 ; kA < A->nvec ; kA++)
+        {
+            if (A->p [kA] <= p && p < A->p [kA+1])
+            {
+                j = GBH (A->h, kA) ;
+                break ;
+            }
+        }
+        CHECK (j >= 0) ;
+        OK (GrB_Matrix_removeElement (A, i, j)) ;
+        OK (GrB_Matrix_removeElement (B, i, j)) ;
+    }
+    CHECK (GB_ZOMBIES (A)) ;
+
+    // finish B, so that it has no zombies
+    OK (GrB_wait (B, GrB_MATERIALIZE)) ;
+
+    // add new entries to A and B, until at least one is pending in A
+    for (int64_t k = 0 ; k < nadd || !GB_PENDING (A) ; k++)
+    {
+        int64_t i = simple_rand_i ( ) % m ;
+        int64_t j = simple_rand_i ( ) % n ;
+        double x = iso ? 1 : ((double) (simple_rand ( ) % 100) + 1) ;
+        OK (set_entry (A, x, i, j)) ;
+        OK (set_entry (B, x, i, j)) ;
+    }
+    CHECK (GB_ZOMBIES (A)) ;
+    CHECK (GB_PENDING (A)) ;
+
+    // finish A, with GB_wait_merge
+    GB_mx_burble_start ("zombie merge") ;
+    info = GrB_wait (A, GrB_MATERIALIZE) ;
+    bool merge_found = GB_mx_burble_stop ( ) ;
+    OK (info) ;
+    CHECK (merge_found) ;
+
+    // finish B, without GB_wait_merge
+    OK (GrB_wait (B, GrB_MATERIALIZE)) ;
+
+    // compare A and B
+    CHECK (A->iso == iso) ;
+    CHECK (!GB_ANY_PENDING_WORK (A)) ;
+    OK (GxB_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (B, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_mx_isequal (A, B, 0)) ;
+
+    GrB_free (&A) ;
+    GrB_free (&B) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test43 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Type tripletype = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_get (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    simple_rand_seed (1) ;
+
+    OK (GxB_Type_new (&tripletype, sizeof (triple), "triple", TRIPLE_DEFN)) ;
+
+    #define NTYPES 6
+    GrB_Type types [NTYPES] = { GrB_INT8, GrB_INT16, GrB_FP32, GrB_FP64,
+        GxB_FC64, tripletype } ;
+
+    //--------------------------------------------------------------------------
+    // small matrices with a chunk of 1, so that many tasks are used
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_CHUNK, (double) 1)) ;
+    for (int t = 0 ; t < NTYPES ; t++)
+    {
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            // matrices, sparse and hypersparse
+            OK (check_merge (types [t], 200, 300, 5000, 500, 700,
+                GxB_SPARSE, iso)) ;
+            OK (check_merge (types [t], 200, 30000, 5000, 500, 700,
+                GxB_HYPERSPARSE, iso)) ;
+            // a single vector, split across all the tasks
+            OK (check_merge (types [t], 100000, 1, 5000, 500, 700,
+                GxB_SPARSE, iso)) ;
+            // few zombies or few pending tuples
+            OK (check_merge (types [t], 200, 300, 5000, 1, 700,
+                GxB_SPARSE, iso)) ;
+            OK (check_merge (types [t], 200, 300, 5000, 500, 1,
+                GxB_SPARSE, iso)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // large matrices with the default chunk
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_CHUNK, save_chunk)) ;
+    OK (check_merge (GrB_FP64, 2000, 2000, 400000, 20000, 200000,
+        GxB_SPARSE, false)) ;
+    OK (check_merge (GrB_FP64, 1000000, 1, 400000, 20000, 200000,
+        GxB_SPARSE, false)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_set (GxB_CHUNK, save_chunk)) ;
+    GrB_free (&tripletype) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test43:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// GB_mex_test44: test GxB_SHALLOW_DESERIALIZE
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix is serialized with no compression, and deserialized with the
+// GxB_SHALLOW_DESERIALIZE descriptor setting, so that its components point
+// into the blob.  It is used as an input, then modified so that GB_unshallow
+// must copy it out of the blob, and then the blob is overwritten and freed.
+// The matrix must still be valid and hold the expected entries.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test44"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// modify: modify a matrix in place, in one of several ways
+//------------------------------------------------------------------------------
+
+static GrB_Info modify
+(
+    GrB_Matrix C,
+    int how
+)
+{
+    GrB_Info info ;
+    GrB_Index m, n ;
+    OK (GrB_Matrix_nrows (&m, C)) ;
+    OK (GrB_Matrix_ncols (&n, C)) ;
+    switch (how)
+    {
+        case 0 :
+            // change an entry, or add it if not present
+            OK (GrB_Matrix_setElement_FP64 (C, 42, 1, 2)) ;
+            break ;
+        case 1 :
+            // delete an entry, if present
+            OK (GrB_Matrix_removeElement (C, 3, 4)) ;
+            break ;
+        case 2 :
+            // change the size of the matrix
+            OK (GrB_Matrix_resize (C, m-1, n+1)) ;
+            break ;
+        default :
+            // C(0:2,0:2) = 7
+            {
+                GrB_Index I [2] = { 0, 2 } ;
+                OK (GrB_Matrix_assign_FP64 (C, NULL, NULL, 7, I, GxB_RANGE,
+                    I, GxB_RANGE, NULL)) ;
+            }
+            break ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_shallow: deserialize a shallow copy of A, modify it, free the blob
+//------------------------------------------------------------------------------
+
+static GrB_Info check_shallow
+(
+    GrB_Matrix A,
+    int how,
+    GrB_Descriptor dnone,       // serialize with no compression
+    GrB_Descriptor dshallow     // deserialize with GxB_SHALLOW_DESERIALIZE
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A2 = NULL, C = NULL, T = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+
+    // C is a shallow copy of A, pointing into the blob
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, dnone)) ;
+    OK (GxB_Matrix_deserialize (&C, NULL, blob, blob_size, dshallow)) ;
+    CHECK (GB_is_shallow (C)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+
+    // use C as an input, which does not copy it
+    OK (GrB_Matrix_new (&T, GrB_FP64, C->vdim, C->vdim)) ;
+    OK (GrB_mxm (T, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, C, C,
+        GrB_DESC_T0)) ;
+    CHECK (GB_is_shallow (C)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+
+    // modify C, which copies it out of the blob
+    OK (modify (C, how)) ;
+    CHECK (!GB_is_shallow (C)) ;
+
+    // overwrite and free the blob
+    memset (blob, 0xFF, blob_size) ;
+    mxFree (blob) ;
+
+    // C is unaffected
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (modify (A2, how)) ;
+    OK (GrB_wait (A2, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (C, GrB_MATERIALIZE)) ;
+    OK (GxB_set (A2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_mx_isequal (A2, C, 0)) ;
+
+    GrB_free (&A2) ;
+    GrB_free (&C) ;
+    GrB_free (&T) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test44 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Vector v = NULL, w = NULL ;
+    GrB_Descriptor dnone = NULL, dshallow = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    simple_rand_seed (1) ;
+
+    OK (GrB_Descriptor_new (&dnone)) ;
+    OK (GxB_set (dnone, GxB_COMPRESSION, GxB_COMPRESSION_NONE)) ;
+    OK (GrB_Descriptor_new (&dshallow)) ;
+    OK (GrB_Descriptor_set_INT32 (dshallow, true, GxB_SHALLOW_DESERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // shallow matrices of each sparsity, modified in several ways
+    //--------------------------------------------------------------------------
+
+    int sparsity [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            for (int how = 0 ; how < 4 ; how++)
+            {
+                int64_t n = (sparsity [s] == GxB_HYPERSPARSE) ? 2000 : 50 ;
+                OK (GB_mx_random_typed (&A, GrB_FP64, 40, n, 300,
+                    sparsity [s], iso)) ;
+                CHECK (A->iso == iso) ;
+                OK (check_shallow (A, how, dnone, dshallow)) ;
+                GrB_free (&A) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // the blob can be freed once the shallow matrix is freed
+    //--------------------------------------------------------------------------
+
+    OK (GB_mx_random_typed (&A, GrB_FP64, 40, 50, 300, GxB_SPARSE, false)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, dnone)) ;
+    OK (GxB_Matrix_deserialize (&C, NULL, blob, blob_size, dshallow)) ;
+    CHECK (GB_is_shallow (C)) ;
+    GrB_free (&C) ;
+    mxFree (blob) ;
+
+    //--------------------------------------------------------------------------
+    // a compressed blob is always copied
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, NULL)) ;
+    OK (GxB_Matrix_deserialize (&C, NULL, blob, blob_size, dshallow)) ;
+    CHECK (!GB_is_shallow (C)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+    mxFree (blob) ;
+    GrB_free (&C) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // shallow vector
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&v, GrB_FP64, 1000)) ;
+    for (int64_t k = 0 ; k < 100 ; k++)
+    {
+        OK (GrB_Vector_setElement_FP64 (v, k, simple_rand_i ( ) % 1000)) ;
+    }
+    OK (GrB_wait (v, GrB_MATERIALIZE)) ;
+    OK (GxB_Vector_serialize (&blob, &blob_size, v, dnone)) ;
+    OK (GxB_Vector_deserialize (&w, NULL, blob, blob_size, dshallow)) ;
+    CHECK (GB_is_shallow ((GrB_Matrix) w)) ;
+    OK (GrB_Vector_setElement_FP64 (w, 99, 0)) ;
+    OK (GrB_Vector_setElement_FP64 (v, 99, 0)) ;
+    CHECK (!GB_is_shallow ((GrB_Matrix) w)) ;
+    memset (blob, 0xFF, blob_size) ;
+    mxFree (blob) ;
+    OK (GrB_wait (v, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (w, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal ((GrB_Matrix) v, (GrB_Matrix) w, 0)) ;
+    GrB_free (&v) ;
+    GrB_free (&w) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&dnone) ;
+    GrB_free (&dshallow) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test44:  all tests passed.\n\n") ;
+}
+
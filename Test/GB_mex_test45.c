@@ -0,0 +1,250 @@
+//------------------------------------------------------------------------------
+// GB_mex_test45: test GxB_Matrix_serialize_stream and deserialize_stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Matrices are serialized to an in-memory stream and deserialized back, with
+// each compression method and sparsity format.  A writer that fails must
+// return GrB_INVALID_VALUE.  A truncated or corrupted stream must return
+// GrB_INVALID_OBJECT, even if its header claims sizes far larger than the
+// stream, without first allocating space for those sizes (which would fail
+// with GrB_OUT_OF_MEMORY instead).
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_serialize.h"
+
+#define USAGE "GB_mex_test45"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+// write a value into the blob held in the stream, at byte offset p
+#define SET(S,p,type,x)                                 \
+{                                                       \
+    type t = (type) (x) ;                               \
+    memcpy ((S)->bytes + (p), &t, sizeof (type)) ;      \
+}
+
+// byte offsets of the blob header fields, in the order of GB_BLOB_READ
+#define BLOB_SIZE   0
+#define CX_LEN      96
+#define CP_NBLOCKS  120
+#define CX_NBLOCKS  152
+#define CX_SBLOCKS  160     // Cx_Sblocks of a full built-in matrix
+
+//------------------------------------------------------------------------------
+// check_stream: round trip a matrix through a stream, and through a blob
+//------------------------------------------------------------------------------
+
+static GrB_Info check_stream
+(
+    GrB_Matrix A,
+    GrB_Descriptor desc,
+    GB_mx_stream *S
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+
+    // serialize A to the stream, and deserialize it back
+    GB_mx_stream_clear (S) ;
+    OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, S, A, desc)) ;
+    OK (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read, S, NULL)) ;
+    CHECK (S->pos == S->len) ;
+    CHECK (S->maxread <= GB_STREAM_CHUNK) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+    GrB_free (&C) ;
+
+    // the stream holds a valid blob
+    OK (GxB_Matrix_deserialize (&C, NULL, S->bytes, S->len, NULL)) ;
+    CHECK (GB_mx_isequal (A, C, 0)) ;
+    GrB_free (&C) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test45 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GB_mx_stream S ;
+    memset (&S, 0, sizeof (GB_mx_stream)) ;
+    GB_mx_stream_clear (&S) ;
+    simple_rand_seed (1) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // round trips with each compression method and sparsity format
+    //--------------------------------------------------------------------------
+
+    int methods [4] = { GxB_COMPRESSION_NONE, GxB_COMPRESSION_LZ4,
+        GxB_COMPRESSION_LZ4HC, GxB_COMPRESSION_ZSTD } ;
+    int sparsity [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        OK (GxB_set (desc, GxB_COMPRESSION, methods [k])) ;
+        for (int s = 0 ; s < 4 ; s++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                int64_t n = (sparsity [s] == GxB_HYPERSPARSE) ? 20000 : 500 ;
+                OK (GB_mx_random_typed (&A, GrB_FP64, 400, n, 20000,
+                    sparsity [s], iso)) ;
+                OK (check_stream (A, desc, &S)) ;
+                GrB_free (&A) ;
+            }
+        }
+    }
+
+    // a large uncompressed matrix is read in bounded chunks
+    OK (GxB_set (desc, GxB_COMPRESSION, GxB_COMPRESSION_NONE)) ;
+    OK (GB_mx_random_typed (&A, GrB_FP64, 2000, 2000, 100, GxB_FULL,
+        false)) ;
+    OK (check_stream (A, desc, &S)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // a writer that fails returns GrB_INVALID_VALUE
+    //--------------------------------------------------------------------------
+
+    OK (GB_mx_random_typed (&A, GrB_FP64, 400, 500, 20000, GxB_SPARSE,
+        false)) ;
+    OK (GrB_Matrix_dup (&C, A)) ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        OK (GxB_set (desc, GxB_COMPRESSION, methods [k])) ;
+        GB_mx_stream_clear (&S) ;
+        OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, &S, A, desc)) ;
+        size_t len = S.len ;
+        size_t limits [5] = { 0, 100, 200, len/2, len-1 } ;
+        for (int trial = 0 ; trial < 5 ; trial++)
+        {
+            GB_mx_stream_clear (&S) ;
+            S.limit = limits [trial] ;
+            expected = GrB_INVALID_VALUE ;
+            ERR (GxB_Matrix_serialize_stream (GB_mx_stream_write,
+                &S, A, desc)) ;
+            CHECK (GB_mx_isequal (A, C, 0)) ;
+        }
+    }
+    GrB_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // a truncated stream returns GrB_INVALID_OBJECT
+    //--------------------------------------------------------------------------
+
+    expected = GrB_INVALID_OBJECT ;
+    for (int k = 0 ; k < 4 ; k++)
+    {
+        OK (GxB_set (desc, GxB_COMPRESSION, methods [k])) ;
+        GB_mx_stream_clear (&S) ;
+        OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, &S, A, desc)) ;
+        size_t len = S.len ;
+        for (size_t cut = 0 ; cut < len ; cut += GB_IMAX (1, len / 200))
+        {
+            S.len = cut ;
+            S.pos = 0 ;
+            ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read, &S,
+                NULL)) ;
+            CHECK (C == NULL) ;
+        }
+        S.len = len - 1 ;
+        S.pos = 0 ;
+        ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read,
+            &S, NULL)) ;
+    }
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // corrupted streams that claim huge sizes return GrB_INVALID_OBJECT
+    //--------------------------------------------------------------------------
+
+    // A is full, so the Cx_Sblocks directly follow the 160-byte header
+    OK (GB_mx_random_typed (&A, GrB_FP64, 40, 50, 100, GxB_FULL, false)) ;
+    OK (GxB_set (desc, GxB_COMPRESSION, GxB_COMPRESSION_NONE)) ;
+    int64_t huge = ((int64_t) 1) << 42 ;
+
+    // a huge uncompressed Cx
+    GB_mx_stream_clear (&S) ;
+    OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, &S, A, desc)) ;
+    SET (&S, BLOB_SIZE, uint64_t, 2 * huge) ;
+    SET (&S, CX_LEN, int64_t, huge) ;
+    SET (&S, CX_SBLOCKS, int64_t, huge) ;
+    ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read,
+        &S, NULL)) ;
+    CHECK (S.maxread <= GB_STREAM_CHUNK) ;
+
+    // a huge number of blocks
+    S.pos = 0 ;
+    SET (&S, CX_NBLOCKS, int32_t, INT32_MAX) ;
+    ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read,
+        &S, NULL)) ;
+    CHECK (S.maxread <= GB_STREAM_CHUNK) ;
+
+    // a negative number of blocks
+    GB_mx_stream_clear (&S) ;
+    OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, &S, A, desc)) ;
+    SET (&S, CP_NBLOCKS, int32_t, -1) ;
+    ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read,
+        &S, NULL)) ;
+
+    // a huge string at the end of the blob
+    GB_mx_stream_clear (&S) ;
+    OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, &S, A, desc)) ;
+    SET (&S, BLOB_SIZE, uint64_t, huge) ;
+    ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read,
+        &S, NULL)) ;
+    CHECK (S.maxread <= GB_STREAM_CHUNK) ;
+
+    // a compressed block that claims a huge uncompressed size
+    for (int k = 1 ; k < 4 ; k++)
+    {
+        OK (GxB_set (desc, GxB_COMPRESSION, methods [k])) ;
+        GB_mx_stream_clear (&S) ;
+        OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, &S, A, desc)) ;
+        int32_t nblocks ;
+        memcpy (&nblocks, S.bytes + CX_NBLOCKS, sizeof (int32_t)) ;
+        CHECK (nblocks == 1) ;
+        SET (&S, CX_LEN, int64_t, INT32_MAX) ;
+        ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read,
+            &S, NULL)) ;
+        S.pos = 0 ;
+        SET (&S, CX_LEN, int64_t, huge) ;
+        ERR (GxB_Matrix_deserialize_stream (&C, NULL, GB_mx_stream_read,
+            &S, NULL)) ;
+    }
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GB_mx_stream_clear (&S) ;
+    GrB_free (&desc) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test45:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,392 @@
+//------------------------------------------------------------------------------
+// GB_mex_test46: test GxB_Matrix_read_MM and GxB_Matrix_write_MM
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Small Matrix Market files with the real, integer, pattern, and complex
+// fields, and general, symmetric, skew-symmetric, and Hermitian symmetry, are
+// read and compared with the matrices they hold.  Matrices of each built-in
+// type and sparsity format, including the extreme values of each integer
+// type, are written to a file and read back, with 4 threads.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test46"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// read_string: read a matrix from a Matrix Market file held in a string
+//------------------------------------------------------------------------------
+
+static GrB_Info read_string
+(
+    GrB_Matrix *C,
+    GrB_Type type,
+    const char *s
+)
+{
+    FILE *f = tmpfile ( ) ;
+    if (f == NULL) return (GrB_INVALID_VALUE) ;
+    fputs (s, f) ;
+    rewind (f) ;
+    GrB_Info info = GxB_Matrix_read_MM (C, type, f, NULL) ;
+    fclose (f) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// check_equal: check if two matrices are equal, as sparse CSC matrices
+//------------------------------------------------------------------------------
+
+static GrB_Info check_equal
+(
+    GrB_Matrix A,
+    GrB_Matrix B
+)
+{
+    GrB_Info info ;
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (B, GrB_MATERIALIZE)) ;
+    OK (GxB_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (B, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_mx_isequal (A, B, 0)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_fixture: read a Matrix Market file and compare it with A
+//------------------------------------------------------------------------------
+
+static GrB_Info check_fixture
+(
+    const char *s,      // content of the file
+    GrB_Type type,      // type to read it as, or NULL
+    GrB_Matrix A        // expected result
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    OK (read_string (&C, type, s)) ;
+    OK (check_equal (A, C)) ;
+    GrB_free (&C) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_roundtrip: write A to a file, read it back, and compare
+//------------------------------------------------------------------------------
+
+static GrB_Info check_roundtrip
+(
+    GrB_Matrix A
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL, A2 = NULL ;
+    GrB_Type type = A->type ;
+    FILE *f = tmpfile ( ) ;
+    CHECK (f != NULL) ;
+
+    // write A and read it back as the same type
+    OK (GxB_Matrix_write_MM (A, f, NULL)) ;
+    rewind (f) ;
+    OK (GxB_Matrix_read_MM (&C, type, f, NULL)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (check_equal (A2, C)) ;
+    GrB_free (&C) ;
+
+    // read it back with the type given by the field of the file
+    rewind (f) ;
+    OK (GxB_Matrix_read_MM (&C, NULL, f, NULL)) ;
+    GB_Type_code code = type->code ;
+    if (code == GB_FP32_code || code == GB_FP64_code)
+    {
+        CHECK (C->type == GrB_FP64) ;
+    }
+    else if (code == GB_FC32_code || code == GB_FC64_code)
+    {
+        CHECK (C->type == GxB_FC64) ;
+    }
+    else
+    {
+        CHECK (C->type == GrB_INT64) ;
+    }
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == GB_nnz (A)) ;
+
+    GrB_free (&C) ;
+    GrB_free (&A2) ;
+    fclose (f) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test46 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL ;
+    int save_nthreads ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    simple_rand_seed (1) ;
+
+    //--------------------------------------------------------------------------
+    // real general, with comments and a blank line
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 3, 4)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1.5, 0, 0)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, -2, 1, 2)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1e300, 2, 3)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 0.1, 0, 3)) ;
+    OK (check_fixture (
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% a comment\n"
+        "\n"
+        "3 4 4\n"
+        "1 1 1.5\n"
+        "2 3 -2\n"
+        "3 4 1e300\n"
+        "1 4 0.1\n", NULL, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // integer general, with the extreme int64 values, and no final newline
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT64, 2, 2)) ;
+    OK (GrB_Matrix_setElement_INT64 (A, INT64_MAX, 0, 0)) ;
+    OK (GrB_Matrix_setElement_INT64 (A, INT64_MIN, 1, 0)) ;
+    OK (GrB_Matrix_setElement_INT64 (A, -7, 1, 1)) ;
+    OK (check_fixture (
+        "%%MatrixMarket matrix coordinate integer general\n"
+        "2 2 3\n"
+        "1 1 9223372036854775807\n"
+        "2 1 -9223372036854775808\n"
+        "2 2 -7", NULL, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // integer general, read as uint64, with values above INT64_MAX
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_UINT64, 2, 2)) ;
+    OK (GrB_Matrix_setElement_UINT64 (A, UINT64_MAX, 0, 0)) ;
+    OK (GrB_Matrix_setElement_UINT64 (A, ((uint64_t) INT64_MAX) + 2, 1, 0)) ;
+    OK (GrB_Matrix_setElement_UINT64 (A, 3, 1, 1)) ;
+    OK (check_fixture (
+        "%%MatrixMarket matrix coordinate integer general\n"
+        "2 2 3\n"
+        "1 1 18446744073709551615\n"
+        "2 1 9223372036854775809\n"
+        "2 2 3\n", GrB_UINT64, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // pattern general, with the banner in upper case
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 4, 3)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 3, 0)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 0, 2)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 2, 2)) ;
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (A->iso) ;
+    OK (check_fixture (
+        "%%MatrixMarket MATRIX Coordinate Pattern General\n"
+        "4 3 3\n"
+        "4 1\n"
+        "1 3\n"
+        "3 3\n", NULL, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // real symmetric, read as single precision
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP32, 3, 3)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, 4, 0, 0)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, -1, 1, 0)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, -1, 0, 1)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, 0.5, 2, 1)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, 0.5, 1, 2)) ;
+    OK (GrB_Matrix_setElement_FP32 (A, 3, 2, 2)) ;
+    OK (check_fixture (
+        "%%MatrixMarket matrix coordinate real symmetric\n"
+        "3 3 4\n"
+        "1 1 4\n"
+        "2 1 -1\n"
+        "3 2 0.5\n"
+        "3 3 3\n", GrB_FP32, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // pattern symmetric
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 3, 3)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 1, 1)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 2, 0)) ;
+    OK (GrB_Matrix_setElement_BOOL (A, true, 0, 2)) ;
+    OK (check_fixture (
+        "%%MatrixMarket matrix coordinate pattern symmetric\n"
+        "3 3 2\n"
+        "2 2\n"
+        "3 1\n", NULL, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // integer skew-symmetric, read as int8 and as uint64
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT8, 3, 3)) ;
+    OK (GrB_Matrix_setElement_INT8 (A, 5, 1, 0)) ;
+    OK (GrB_Matrix_setElement_INT8 (A, -5, 0, 1)) ;
+    OK (GrB_Matrix_setElement_INT8 (A, -2, 2, 1)) ;
+    OK (GrB_Matrix_setElement_INT8 (A, 2, 1, 2)) ;
+    const char *skew =
+        "%%MatrixMarket matrix coordinate integer skew-symmetric\n"
+        "3 3 2\n"
+        "2 1 5\n"
+        "3 2 -2\n" ;
+    OK (check_fixture (skew, GrB_INT8, A)) ;
+    GrB_free (&A) ;
+
+    OK (GrB_Matrix_new (&A, GrB_UINT64, 3, 3)) ;
+    OK (GrB_Matrix_setElement_UINT64 (A, 5, 1, 0)) ;
+    OK (GrB_Matrix_setElement_UINT64 (A, -((uint64_t) 5), 0, 1)) ;
+    OK (GrB_Matrix_setElement_UINT64 (A, -((uint64_t) 2), 2, 1)) ;
+    OK (GrB_Matrix_setElement_UINT64 (A, 2, 1, 2)) ;
+    OK (check_fixture (skew, GrB_UINT64, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // complex Hermitian
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GxB_FC64, 2, 2)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (1, 0), 0, 0)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (2, 3), 1, 0)) ;
+    OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (2, -3), 0, 1)) ;
+    OK (check_fixture (
+        "%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 2 2\n"
+        "1 1 1 0\n"
+        "2 1 2 3\n", NULL, A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // invalid files
+    //--------------------------------------------------------------------------
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (read_string (&C, NULL, "")) ;
+    ERR (read_string (&C, NULL,
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n"
+        "3 1 1\n")) ;
+    ERR (read_string (&C, NULL,
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 2\n"
+        "1 1 1\n")) ;
+    ERR (read_string (&C, NULL,
+        "%%MatrixMarket matrix coordinate real symmetric\n"
+        "2 3 1\n"
+        "1 1 1\n")) ;
+    expected = GrB_NOT_IMPLEMENTED ;
+    ERR (read_string (&C, NULL,
+        "%%MatrixMarket matrix array real general\n"
+        "2 2\n"
+        "1\n2\n3\n4\n")) ;
+    CHECK (C == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // round trips of each built-in type and sparsity format
+    //--------------------------------------------------------------------------
+
+    #define NTYPES 13
+    GrB_Type types [NTYPES] = { GrB_BOOL, GrB_INT8, GrB_INT16, GrB_INT32,
+        GrB_INT64, GrB_UINT8, GrB_UINT16, GrB_UINT32, GrB_UINT64, GrB_FP32,
+        GrB_FP64, GxB_FC32, GxB_FC64 } ;
+    int sparsity [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    for (int t = 0 ; t < NTYPES ; t++)
+    {
+        for (int s = 0 ; s < 4 ; s++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                int64_t m = 50 ;
+                int64_t n = (sparsity [s] == GxB_HYPERSPARSE) ? 5000 : 60 ;
+                OK (GrB_Matrix_new (&A, types [t], m, n)) ;
+                OK (GxB_set (A, GxB_FORMAT, (s % 2) ? GxB_BY_ROW : GxB_BY_COL));
+                if (sparsity [s] == GxB_FULL)
+                {
+                    OK (GrB_Matrix_assign_INT64 (A, NULL, NULL, 1,
+                        GrB_ALL, m, GrB_ALL, n, NULL)) ;
+                }
+                for (int64_t k = 0 ; k < 1000 ; k++)
+                {
+                    int64_t i = simple_rand_i ( ) % m ;
+                    int64_t j = simple_rand_i ( ) % n ;
+                    double x = iso ? 1 : (((double) simple_rand_i ( )) /
+                        ((double) simple_rand_i ( ) + 1) - 0.3) ;
+                    if (types [t] == GrB_BOOL) x = iso ? 1 : (k % 2) ;
+                    OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                }
+                if (!iso)
+                {
+                    // the extreme values of the type
+                    OK (GrB_Matrix_setElement_INT64 (A, INT64_MIN, 0, 1)) ;
+                    OK (GrB_Matrix_setElement_INT64 (A, INT64_MAX, 1, 0)) ;
+                    OK (GrB_Matrix_setElement_UINT64 (A, UINT64_MAX, 1, 1)) ;
+                }
+                OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+                OK (GxB_set (A, GxB_SPARSITY_CONTROL, sparsity [s])) ;
+                CHECK (A->iso == iso) ;
+                OK (check_roundtrip (A)) ;
+                GrB_free (&A) ;
+            }
+        }
+    }
+
+    // an empty matrix
+    OK (GrB_Matrix_new (&A, GrB_FP64, 7, 0)) ;
+    OK (check_roundtrip (A)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test46:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,361 @@
+//------------------------------------------------------------------------------
+// GB_mex_test47: test GxB_Matrix_deserialize_range
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix is serialized, and ranges of its vectors are deserialized with
+// GxB_Matrix_deserialize_range.  Each result must equal A(:,kfirst:klast) (or
+// A(kfirst:klast,:) if A is held by row), computed by GrB_Matrix_extract, and
+// must have the same type, format, sparsity structure, and iso property as A.
+// The matrices are sparse, hypersparse, bitmap, full, and iso, the blobs are
+// compressed or not (and shallow if not), and the ranges include vectors with
+// no entries and the vectors on either side of each block boundary of each
+// array in the blob.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test47"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+// byte offsets of the array lengths and # of blocks in the blob header, in
+// the order of GB_BLOB_READ, for the arrays p, h, b, i, and x
+static const size_t len_offset [5]     = {  64,  72,  80,  88,  96 } ;
+static const size_t nblocks_offset [5] = { 120, 128, 136, 144, 152 } ;
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with a band of empty vectors
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    int64_t vlen,
+    int64_t vdim,
+    int64_t nz,
+    int sparsity,
+    bool iso,
+    bool by_col
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    GrB_Scalar one = NULL ;
+    bool full = (sparsity == GxB_FULL) ;
+    if (full) nz = vlen * vdim ;
+    GrB_Index *I = mxMalloc (nz * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc (nz * sizeof (GrB_Index)) ;
+    double *X = mxMalloc (nz * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+    int64_t band = vdim / 2 ;
+    for (int64_t k = 0 ; k < nz ; k++)
+    {
+        int64_t i = full ? (k % vlen) : (simple_rand_i ( ) % vlen) ;
+        int64_t j = full ? (k / vlen) : (simple_rand_i ( ) % vdim) ;
+        if (!full && j >= band && j < band + 10)
+        {
+            // the vectors band:band+9 have no entries
+            j = band + 10 ;
+        }
+        I [k] = by_col ? i : j ;
+        J [k] = by_col ? j : i ;
+        X [k] = (double) (simple_rand ( ) % 1000) + 1 ;
+    }
+    GrB_Index nrows = by_col ? vlen : vdim ;
+    GrB_Index ncols = by_col ? vdim : vlen ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, nrows, ncols)) ;
+    OK (GxB_set (A, GxB_FORMAT, by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+    if (iso)
+    {
+        OK (GrB_Scalar_new (&one, GrB_FP64)) ;
+        OK (GrB_Scalar_setElement_FP64 (one, 1)) ;
+        OK (GxB_Matrix_build_Scalar (A, I, J, one, nz)) ;
+    }
+    else
+    {
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_SECOND_FP64)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == iso) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    GrB_free (&one) ;
+    (*A_handle) = A ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_range: deserialize A(:,kfirst:klast) and compare with GrB_extract
+//------------------------------------------------------------------------------
+
+static GrB_Info check_range
+(
+    GrB_Matrix A,
+    const void *blob,
+    GrB_Index blob_size,
+    int64_t kfirst,
+    int64_t klast,
+    GrB_Descriptor desc
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL, C2 = NULL ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    kfirst = GB_IMAX (kfirst, 0) ;
+    klast = GB_IMIN (klast, vdim - 1) ;
+    if (kfirst > klast) return (GrB_SUCCESS) ;
+    GrB_Index range [2] = { kfirst, klast } ;
+    GrB_Index n = klast - kfirst + 1 ;
+
+    // C = A(:,kfirst:klast) from the blob
+    OK (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size, kfirst,
+        klast, desc)) ;
+    CHECK (C->type == A->type) ;
+    CHECK (C->is_csc == A->is_csc) ;
+    CHECK (GB_sparsity (C) == GB_sparsity (A)) ;
+    CHECK (C->iso == A->iso) ;
+    CHECK (C->vlen == vlen && C->vdim == n) ;
+
+    // C2 = A(:,kfirst:klast) with GrB_extract
+    if (A->is_csc)
+    {
+        OK (GrB_Matrix_new (&C2, A->type, vlen, n)) ;
+        OK (GrB_Matrix_extract (C2, NULL, NULL, A, GrB_ALL, vlen, range,
+            GxB_RANGE, NULL)) ;
+    }
+    else
+    {
+        OK (GrB_Matrix_new (&C2, A->type, n, vlen)) ;
+        OK (GrB_Matrix_extract (C2, NULL, NULL, A, range, GxB_RANGE,
+            GrB_ALL, vlen, NULL)) ;
+    }
+
+    // compare C and C2
+    OK (GxB_set (C2, GxB_FORMAT, A->is_csc ? GxB_BY_COL : GxB_BY_ROW)) ;
+    OK (GxB_set (C, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (C2, GrB_MATERIALIZE)) ;
+    if (A->iso)
+    {
+        // C2 may not be iso if it has no entries
+        CHECK (GB_nnz (C) == GB_nnz (C2)) ;
+        if (GB_nnz (C) > 0) CHECK (GB_mx_isequal (C, C2, 0)) ;
+    }
+    else
+    {
+        CHECK (GB_mx_isequal (C, C2, 0)) ;
+    }
+
+    GrB_free (&C) ;
+    GrB_free (&C2) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// find_vector: find the vector of A that holds entry p
+//------------------------------------------------------------------------------
+
+static int64_t find_vector
+(
+    GrB_Matrix A,
+    int64_t p
+)
+{
+    if (A->p == NULL)
+    {
+        // A is bitmap or full
+        return (p / A->vlen) ;
+    }
+    // A is sparse or hypersparse
+    int64_t k = 0 ;
+    while (k < A->nvec - 1 && A->p [k+1] <= p) k++ ;
+    return (GBH (A->h, k)) ;
+}
+
+//------------------------------------------------------------------------------
+// check_blob: check many ranges of A held in a blob
+//------------------------------------------------------------------------------
+
+static GrB_Info check_blob
+(
+    GrB_Matrix A,
+    GrB_Descriptor dser,        // descriptor for serialize
+    GrB_Descriptor ddeser,      // descriptor for deserialize
+    bool multiblock             // if true, some array must have many blocks
+)
+{
+    GrB_Info info ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    int64_t vdim = A->vdim ;
+    int64_t band = vdim / 2 ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, dser)) ;
+
+    // the first, last, and all vectors, and a few ranges
+    OK (check_range (A, blob, blob_size, 0, 0, ddeser)) ;
+    OK (check_range (A, blob, blob_size, vdim-1, vdim-1, ddeser)) ;
+    OK (check_range (A, blob, blob_size, 0, vdim-1, ddeser)) ;
+    OK (check_range (A, blob, blob_size, 3, vdim/3, ddeser)) ;
+    OK (check_range (A, blob, blob_size, vdim/3, vdim-2, ddeser)) ;
+
+    // vectors with no entries, and ranges that start or end in them
+    OK (check_range (A, blob, blob_size, band, band, ddeser)) ;
+    OK (check_range (A, blob, blob_size, band, band+9, ddeser)) ;
+    OK (check_range (A, blob, blob_size, band-1, band+3, ddeser)) ;
+    OK (check_range (A, blob, blob_size, band+5, band+10, ddeser)) ;
+
+    // the vectors on either side of each block boundary of each array
+    const uint8_t *b = (const uint8_t *) blob ;
+    int64_t size [5] = { 8, 8, 1, 8, A->type->size } ;
+    int nboundaries = 0 ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        int64_t X_len ;
+        int32_t nblocks ;
+        memcpy (&X_len, b + len_offset [a], sizeof (int64_t)) ;
+        memcpy (&nblocks, b + nblocks_offset [a], sizeof (int32_t)) ;
+        if (a == 4 && A->iso) continue ;
+        for (int32_t blockid = 1 ; blockid < nblocks ; blockid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            int64_t p = kstart / size [a] ;
+            int64_t k ;
+            if (a == 0)
+            {
+                // Ap [p] is the start of vector k
+                k = GBH (A->h, GB_IMIN (p, A->nvec - 1)) ;
+            }
+            else if (a == 1)
+            {
+                // Ah [p] is the vector k
+                k = A->h [p] ;
+            }
+            else
+            {
+                // entry p is in vector k
+                k = find_vector (A, p) ;
+            }
+            OK (check_range (A, blob, blob_size, k-1, k-1, ddeser)) ;
+            OK (check_range (A, blob, blob_size, k, k, ddeser)) ;
+            OK (check_range (A, blob, blob_size, k-1, k, ddeser)) ;
+            OK (check_range (A, blob, blob_size, k-2, k+2, ddeser)) ;
+            nboundaries++ ;
+        }
+    }
+
+    // an iso full matrix has no arrays to split into blocks
+    CHECK (nboundaries > 0 || !multiblock || (A->iso && GB_IS_FULL (A))) ;
+
+    // the range must be valid
+    GrB_Info expected = GrB_INVALID_INDEX ;
+    GrB_Matrix C = NULL ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size, 2, 1,
+        ddeser)) ;
+    ERR (GxB_Matrix_deserialize_range (&C, NULL, blob, blob_size, 0, vdim,
+        ddeser)) ;
+    CHECK (C == NULL) ;
+
+    mxFree (blob) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test47 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Descriptor dnone = NULL, dlz4 = NULL, dshallow = NULL ;
+    int save_nthreads ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    simple_rand_seed (1) ;
+
+    OK (GrB_Descriptor_new (&dnone)) ;
+    OK (GxB_set (dnone, GxB_COMPRESSION, GxB_COMPRESSION_NONE)) ;
+    OK (GrB_Descriptor_new (&dlz4)) ;
+    OK (GxB_set (dlz4, GxB_COMPRESSION, GxB_COMPRESSION_LZ4)) ;
+    OK (GrB_Descriptor_new (&dshallow)) ;
+    OK (GrB_Descriptor_set_INT32 (dshallow, true, GxB_SHALLOW_DESERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // matrices of each sparsity, held by column or by row, iso or not
+    //--------------------------------------------------------------------------
+
+    // With 4 threads, each array of more than 64KB is serialized in many
+    // blocks, of at most 1MB each.
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    int sparsity [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            for (int by_col = 0 ; by_col <= 1 ; by_col++)
+            {
+                int64_t vlen = 400, vdim = 500, nz = 100000 ;
+                if (sparsity [s] == GxB_HYPERSPARSE)
+                {
+                    vlen = 100 ;
+                    vdim = 1000000 ;
+                    nz = 50000 ;
+                }
+                OK (random_matrix (&A, vlen, vdim, nz, sparsity [s], iso,
+                    by_col)) ;
+                // compressed with ZSTD (the default) and LZ4
+                OK (check_blob (A, NULL, NULL, true)) ;
+                OK (check_blob (A, dlz4, NULL, true)) ;
+                // not compressed, and deserialized with or without shallow
+                OK (check_blob (A, dnone, NULL, false)) ;
+                OK (check_blob (A, dnone, dshallow, false)) ;
+                GrB_free (&A) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // a single thread, so each array is serialized in blocks of 1MB
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, 1)) ;
+    OK (random_matrix (&A, 1000, 600, 0, GxB_FULL, false, true)) ;
+    OK (check_blob (A, NULL, NULL, true)) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    GrB_free (&dnone) ;
+    GrB_free (&dlz4) ;
+    GrB_free (&dshallow) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test47:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,398 @@
+//------------------------------------------------------------------------------
+// GB_mex_test48: test GxB_COMPRESSION_FILTER
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Matrices are serialized with GxB_COMPRESSION_FILTER added to the LZ4 and
+// ZSTD methods, and deserialized from a blob, from a stream, and by ranges of
+// vectors.  The types have sizes of 1 (not shuffled), 2 to 16 (shuffled if
+// this makes Ax smaller), and 24 bytes (a user-defined type, not shuffled).
+// With 4 threads, the arrays are split into blocks whose boundaries are not
+// multiples of the size of the entries, so the filter must handle the partial
+// entries at the start and end of each block.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_serialize.h"
+
+#define USAGE "GB_mex_test48"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+// a user-defined type of 24 bytes, larger than GB_FILTER_MAX
+typedef struct { double x ; int64_t k ; float y [2] ; } wild24 ;
+#define WILD24_DEFN \
+"typedef struct { double x ; int64_t k ; float y [2] ; } wild24 ;"
+
+// byte offsets of the array lengths, # of blocks, and methods in the blob
+// header, in the order of GB_BLOB_READ, for the arrays p, h, b, i, and x
+static const size_t len_offset [5]     = {  64,  72,  80,  88,  96 } ;
+static const size_t nblocks_offset [5] = { 120, 128, 136, 144, 152 } ;
+static const size_t method_offset [5]  = { 124, 132, 140, 148, 156 } ;
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix of any type
+//------------------------------------------------------------------------------
+
+// The values vary slowly, like the samples of a smooth function, so that the
+// byte shuffle of Ax typically makes it smaller.
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A_handle,
+    GrB_Type type,
+    int64_t m,
+    int64_t n,
+    int sparsity,
+    bool iso
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    GrB_Scalar one = NULL ;
+    bool full = (sparsity == GxB_FULL) ;
+    int64_t nz = m * n ;
+    GrB_Index *I = mxMalloc (nz * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc (nz * sizeof (GrB_Index)) ;
+    double *X = mxMalloc (nz * sizeof (double)) ;
+    wild24 *W = mxMalloc (nz * sizeof (wild24)) ;
+    CHECK (I != NULL && J != NULL && X != NULL && W != NULL) ;
+    int64_t e = 0 ;
+    for (int64_t k = 0 ; k < m * n ; k++)
+    {
+        // keep all entries if full, or about 1 in 4 otherwise
+        if (!full && simple_rand_i ( ) % 4 != 0) continue ;
+        I [e] = k % m ;
+        J [e] = k / m ;
+        X [e] = (double) (k % 100) + 1e-4 * (double) k ;
+        W [e].x = X [e] ;
+        W [e].k = k ;
+        W [e].y [0] = (float) (k % 7) ;
+        W [e].y [1] = (float) (k % 13) ;
+        e++ ;
+    }
+    OK (GrB_Matrix_new (&A, type, m, n)) ;
+    OK (GxB_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    if (iso)
+    {
+        OK (GrB_Scalar_new (&one, type)) ;
+        if (type->code == GB_UDT_code)
+        {
+            OK (GrB_Scalar_setElement_UDT (one, W)) ;
+        }
+        else
+        {
+            OK (GrB_Scalar_setElement_FP64 (one, 1)) ;
+        }
+        OK (GxB_Matrix_build_Scalar (A, I, J, one, e)) ;
+    }
+    else if (type->code == GB_UDT_code)
+    {
+        OK (GrB_Matrix_build_UDT (A, I, J, W, e, NULL)) ;
+    }
+    else
+    {
+        OK (GrB_Matrix_build_FP64 (A, I, J, X, e, NULL)) ;
+    }
+    OK (GrB_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+    CHECK (GB_sparsity (A) == sparsity) ;
+    CHECK (A->iso == iso) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    mxFree (W) ;
+    GrB_free (&one) ;
+    (*A_handle) = A ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_equal: check if A and C are equal
+//------------------------------------------------------------------------------
+
+static GrB_Info check_equal
+(
+    GrB_Matrix A,
+    GrB_Matrix C,
+    bool same_sparsity
+)
+{
+    GrB_Info info ;
+    GrB_Matrix A2 = NULL ;
+    CHECK (C->type == A->type) ;
+    CHECK (C->is_csc == A->is_csc) ;
+    if (same_sparsity)
+    {
+        CHECK (GB_sparsity (C) == GB_sparsity (A)) ;
+        CHECK (C->iso == A->iso) ;
+    }
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GxB_set (A2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_set (C, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_wait (A2, GrB_MATERIALIZE)) ;
+    OK (GrB_wait (C, GrB_MATERIALIZE)) ;
+    if (A->iso)
+    {
+        // C may not be iso if it has no entries
+        CHECK (GB_nnz (C) == GB_nnz (A2)) ;
+        if (GB_nnz (C) > 0) CHECK (GB_mx_isequal (A2, C, 0)) ;
+    }
+    else
+    {
+        CHECK (GB_mx_isequal (A2, C, 0)) ;
+    }
+    GrB_free (&A2) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_range: deserialize A(:,kfirst:klast) and compare with GrB_extract
+//------------------------------------------------------------------------------
+
+static GrB_Info check_range
+(
+    GrB_Matrix A,
+    const void *blob,
+    GrB_Index blob_size,
+    int64_t kfirst,
+    int64_t klast
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL, C2 = NULL ;
+    int64_t vlen = A->vlen ;
+    kfirst = GB_IMAX (kfirst, 0) ;
+    klast = GB_IMIN (klast, A->vdim - 1) ;
+    if (kfirst > klast) return (GrB_SUCCESS) ;
+    GrB_Index range [2] = { kfirst, klast } ;
+    GrB_Index n = klast - kfirst + 1 ;
+    OK (GxB_Matrix_deserialize_range (&C, A->type, blob, blob_size, kfirst,
+        klast, NULL)) ;
+    CHECK (GB_sparsity (C) == GB_sparsity (A)) ;
+    CHECK (C->iso == A->iso) ;
+    CHECK (C->vlen == vlen && C->vdim == n) ;
+    OK (GrB_Matrix_new (&C2, A->type, vlen, n)) ;
+    OK (GrB_Matrix_extract (C2, NULL, NULL, A, GrB_ALL, vlen, range,
+        GxB_RANGE, NULL)) ;
+    OK (GxB_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (check_equal (C2, C, false)) ;
+    GrB_free (&C) ;
+    GrB_free (&C2) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// check_filter: round trip A through a filtered blob, a stream, and ranges
+//------------------------------------------------------------------------------
+
+// Returns the # of filtered arrays in the blob with a block boundary that is
+// not a multiple of the size of the entries of the array.
+
+static GrB_Info check_filter
+(
+    GrB_Matrix A,
+    GrB_Descriptor desc,
+    int64_t *nmisaligned
+)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    GB_mx_stream S ;
+    memset (&S, 0, sizeof (GB_mx_stream)) ;
+    GB_mx_stream_clear (&S) ;
+    int64_t typesize = A->type->size ;
+    int64_t vdim = A->vdim ;
+
+    //--------------------------------------------------------------------------
+    // round trip through a blob
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+    OK (GxB_Matrix_deserialize (&C, A->type, blob, blob_size, NULL)) ;
+    OK (check_equal (A, C, true)) ;
+    GrB_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // check the filter of each array in the blob header
+    //--------------------------------------------------------------------------
+
+    const uint8_t *b = (const uint8_t *) blob ;
+    int64_t esize [5] = { 8, 8, 1, 8, typesize } ;
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        int64_t X_len ;
+        int32_t nblocks, method ;
+        memcpy (&X_len, b + len_offset [a], sizeof (int64_t)) ;
+        memcpy (&nblocks, b + nblocks_offset [a], sizeof (int32_t)) ;
+        memcpy (&method, b + method_offset [a], sizeof (int32_t)) ;
+        int32_t filter = GB_FILTER (method) ;
+        if (X_len < 256 || a == 2)
+        {
+            // small arrays are not compressed, and Ab is not filtered
+            CHECK (filter == 0) ;
+        }
+        else if (a < 4)
+        {
+            // Ap, Ah, and Ai are delta encoded
+            CHECK (filter == GB_FILTER_DELTA) ;
+        }
+        else if (typesize == 1 || typesize > GB_FILTER_MAX)
+        {
+            // Ax is not shuffled
+            CHECK (filter == 0) ;
+        }
+        else
+        {
+            // Ax is shuffled if this makes a sample of it smaller
+            CHECK (filter == 0 || filter == typesize) ;
+        }
+        if (filter == 0) continue ;
+        for (int32_t blockid = 1 ; blockid < nblocks ; blockid++)
+        {
+            int64_t kstart, kend ;
+            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            if (kstart % esize [a] != 0)
+            {
+                (*nmisaligned)++ ;
+                break ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // round trip through a stream
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_serialize_stream (GB_mx_stream_write, &S, A, desc)) ;
+    // the stream makes the same choice of filter for each array
+    for (int a = 0 ; a < 5 ; a++)
+    {
+        CHECK (memcmp (S.bytes + method_offset [a], b + method_offset [a],
+            sizeof (int32_t)) == 0) ;
+    }
+    OK (GxB_Matrix_deserialize_stream (&C, A->type, GB_mx_stream_read, &S,
+        NULL)) ;
+    CHECK (S.pos == S.len) ;
+    OK (check_equal (A, C, true)) ;
+    GrB_free (&C) ;
+    GB_mx_stream_clear (&S) ;
+
+    //--------------------------------------------------------------------------
+    // ranges of vectors from the blob
+    //--------------------------------------------------------------------------
+
+    OK (check_range (A, blob, blob_size, 0, vdim-1)) ;
+    OK (check_range (A, blob, blob_size, 0, 0)) ;
+    OK (check_range (A, blob, blob_size, vdim-1, vdim-1)) ;
+    for (int trial = 0 ; trial < 8 ; trial++)
+    {
+        int64_t kfirst = simple_rand_i ( ) % vdim ;
+        int64_t klast = kfirst + simple_rand_i ( ) % 40 ;
+        OK (check_range (A, blob, blob_size, kfirst, klast)) ;
+    }
+
+    mxFree (blob) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test48 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Type Wild = NULL ;
+    GrB_Descriptor dzstd = NULL, dlz4 = NULL ;
+    int save_nthreads ;
+    OK (GxB_get (GxB_NTHREADS, &save_nthreads)) ;
+    simple_rand_seed (1) ;
+
+    OK (GxB_Type_new (&Wild, sizeof (wild24), "wild24", WILD24_DEFN)) ;
+    OK (GrB_Descriptor_new (&dzstd)) ;
+    OK (GxB_set (dzstd, GxB_COMPRESSION,
+        GxB_COMPRESSION_ZSTD + GxB_COMPRESSION_FILTER + 3)) ;
+    OK (GrB_Descriptor_new (&dlz4)) ;
+    OK (GxB_set (dlz4, GxB_COMPRESSION,
+        GxB_COMPRESSION_LZ4 + GxB_COMPRESSION_FILTER)) ;
+
+    //--------------------------------------------------------------------------
+    // matrices of each type and sparsity, iso or not
+    //--------------------------------------------------------------------------
+
+    // With 4 threads, each array of more than 64KB is serialized in many
+    // blocks.  The dimensions are odd, so the block boundaries of Ax, and of
+    // Ap and Ai, are not all multiples of the size of their entries.
+    OK (GxB_set (GxB_NTHREADS, 4)) ;
+    GrB_Type types [8] = { GrB_BOOL, GrB_INT8, GrB_INT16, GrB_FP32, GrB_INT64,
+        GrB_FP64, GxB_FC64, Wild } ;
+    int sparsity [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    for (int t = 0 ; t < 8 ; t++)
+    {
+        int64_t nmisaligned = 0 ;
+        for (int s = 0 ; s < 4 ; s++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+                int64_t m = 301, n = 303 ;
+                if (sparsity [s] == GxB_HYPERSPARSE)
+                {
+                    m = 7 ;
+                    n = 100003 ;
+                }
+                OK (random_matrix (&A, types [t], m, n, sparsity [s], iso)) ;
+                OK (check_filter (A, dzstd, &nmisaligned)) ;
+                OK (check_filter (A, dlz4, &nmisaligned)) ;
+                GrB_free (&A) ;
+            }
+        }
+        CHECK (nmisaligned > 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the shuffle is kept for smooth floating-point values
+    //--------------------------------------------------------------------------
+
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    int32_t method ;
+    OK (random_matrix (&A, GrB_FP64, 301, 303, GxB_FULL, false)) ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, dzstd)) ;
+    memcpy (&method, (uint8_t *) blob + method_offset [4], sizeof (int32_t)) ;
+    CHECK (GB_FILTER (method) == sizeof (double)) ;
+    mxFree (blob) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_set (GxB_NTHREADS, save_nthreads)) ;
+    GrB_free (&Wild) ;
+    GrB_free (&dzstd) ;
+    GrB_free (&dlz4) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test48:  all tests passed.\n\n") ;
+}
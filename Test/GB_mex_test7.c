@@ -302,6 +302,148 @@ void mexFunction
     OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_HYPER_HASH)) ;
     OK (GrB_Scalar_extractElement_INT64 (&i, s)) ;
     CHECK (i == 1024) ;
+
+    // the memory pool is bypassed when malloc tracking is enabled
+    OK (GrB_Scalar_setElement_INT64 (s, 1024*1024)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    OK (GrB_Scalar_clear (s)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&i, s)) ;
+    CHECK (i == 1024*1024) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_BYTES)) ;
+    OK (GrB_Scalar_extractElement_INT64 (&i, s)) ;
+    CHECK (i == 0) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_HITS)) ;
+    OK (GrB_Global_get_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_MISSES)) ;
+    expected = GrB_INVALID_VALUE ;
+    OK (GrB_Scalar_setElement_INT64 (s, -1)) ;
+    ERR (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    ERR (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_HITS)) ;
+    OK (GrB_Scalar_setElement_INT64 (s, 0)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+
+    //--------------------------------------------------------------------------
+    // memory pool, with malloc tracking off
+    //--------------------------------------------------------------------------
+
+    // The pool is used only if malloc tracking is off.  All of the blocks it
+    // holds are freed (by setting its limit to zero) before tracking is turned
+    // back on, so that the count of allocated blocks is not affected.
+
+    GB_Global_malloc_tracking_set (false) ;
+    int64_t limit = 4*1024*1024 ;
+    OK (GrB_Scalar_setElement_INT64 (s, limit)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    int64_t pool_bytes, hits0, misses0, hits1, misses1 ;
+    GB_memory_pool_stats (&pool_bytes, &hits0, &misses0) ;
+    CHECK (pool_bytes == 0) ;
+
+    // a request is rounded up to a power of two, and kept in the pool when
+    // freed
+    size_t psize ;
+    void *p = GB_malloc_memory (100, sizeof (char), &psize) ;
+    CHECK (p != NULL) ;
+    CHECK (psize == 128) ;
+    void *p_save = p ;
+    GB_free_memory (&p, psize) ;
+    CHECK (p == NULL) ;
+    GB_memory_pool_stats (&pool_bytes, NULL, NULL) ;
+    CHECK (pool_bytes == 128) ;
+
+    // the block is reused for a request in the same size class, and is
+    // cleared by calloc
+    p = GB_calloc_memory (120, sizeof (char), &psize) ;
+    CHECK (p == p_save) ;
+    CHECK (psize == 128) ;
+    for (int k = 0 ; k < 128 ; k++)
+    {
+        CHECK (((char *) p) [k] == 0) ;
+    }
+    GB_memory_pool_stats (&pool_bytes, &hits1, &misses1) ;
+    CHECK (pool_bytes == 0) ;
+    CHECK (hits1 == hits0 + 1) ;
+    CHECK (misses1 == misses0 + 1) ;
+    GB_free_memory (&p, psize) ;
+
+    // free more blocks than the thread cache holds, so that some spill to
+    // the global list, and then get them all back from the pool
+    #define NPOOL 16
+    void *P [NPOOL] ;
+    size_t Psize [NPOOL] ;
+    for (int k = 0 ; k < NPOOL ; k++)
+    {
+        P [k] = GB_malloc_memory (1000, sizeof (char), &(Psize [k])) ;
+        CHECK (P [k] != NULL) ;
+        CHECK (Psize [k] == 1024) ;
+    }
+    for (int k = 0 ; k < NPOOL ; k++)
+    {
+        GB_free_memory (&(P [k]), Psize [k]) ;
+    }
+    GB_memory_pool_stats (&pool_bytes, &hits0, NULL) ;
+    CHECK (pool_bytes == 128 + NPOOL * 1024) ;
+    for (int k = 0 ; k < NPOOL ; k++)
+    {
+        P [k] = GB_malloc_memory (1024, sizeof (char), &(Psize [k])) ;
+        CHECK (P [k] != NULL) ;
+    }
+    GB_memory_pool_stats (&pool_bytes, &hits1, NULL) ;
+    CHECK (pool_bytes == 128) ;
+    CHECK (hits1 == hits0 + NPOOL) ;
+    for (int k = 0 ; k < NPOOL ; k++)
+    {
+        GB_free_memory (&(P [k]), Psize [k]) ;
+    }
+
+    // a block larger than the largest size class is not rounded up, and is
+    // not kept in the pool
+    p = GB_malloc_memory (20*1024*1024 + 1, sizeof (char), &psize) ;
+    CHECK (p != NULL) ;
+    CHECK (psize == 20*1024*1024 + 1) ;
+    GB_free_memory (&p, psize) ;
+    GB_memory_pool_stats (&pool_bytes, NULL, NULL) ;
+    CHECK (pool_bytes == 128 + NPOOL * 1024) ;
+
+    // a block that would exceed the limit of the pool is not kept
+    p = GB_malloc_memory (limit, sizeof (char), &psize) ;
+    CHECK (p != NULL) ;
+    CHECK (psize == limit) ;
+    GB_free_memory (&p, psize) ;
+    GB_memory_pool_stats (&pool_bytes, NULL, NULL) ;
+    CHECK (pool_bytes == 128 + NPOOL * 1024) ;
+
+    // use the pool for GraphBLAS methods, with many threads
+    int nthreads_save ;
+    OK (GxB_Global_Option_get_INT32 (GxB_GLOBAL_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_GLOBAL_NTHREADS, 4)) ;
+    GB_memory_pool_stats (NULL, &hits0, NULL) ;
+    for (int trial = 0 ; trial < 4 ; trial++)
+    {
+        OK (GrB_Matrix_new (&C1, GrB_FP64, 2000, 2000)) ;
+        for (int k = 0 ; k < 20000 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (C1, (double) k,
+                (k * 7919) % 2000, (k * 104729) % 2000)) ;
+        }
+        OK (GrB_Matrix_new (&C2, GrB_FP64, 2000, 2000)) ;
+        OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, C1, C1,
+            NULL)) ;
+        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+    }
+    GB_memory_pool_stats (&pool_bytes, &hits1, NULL) ;
+    CHECK (hits1 > hits0) ;
+    CHECK (pool_bytes > 0 && pool_bytes <= limit) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_GLOBAL_NTHREADS, nthreads_save)) ;
+
+    // setting the limit to zero frees all blocks in the pool
+    OK (GrB_Scalar_setElement_INT64 (s, 0)) ;
+    OK (GrB_Global_set_Scalar (GrB_GLOBAL, s, GxB_MEMORY_POOL_LIMIT)) ;
+    GB_memory_pool_stats (&pool_bytes, NULL, NULL) ;
+    CHECK (pool_bytes == 0) ;
+    GB_Global_malloc_tracking_set (true) ;
+
     OK (GrB_Scalar_free (&s)) ;
     GB_mx_put_global (true) ;   
     printf ("\nGB_mex_test7: all tests passed\n\n") ;
@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Test/GB_mx_burble.c: capture the burble and search it
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_mx_burble_start turns on the burble and redirects it to a printf that
+// searches each message for a given pattern.  The burble is not printed.
+// GB_mx_burble_stop restores the burble and printf function, and returns true
+// if the pattern appeared in any message printed in between.
+
+#include "GB_mex.h"
+
+static char burble_pattern [256] ;
+static bool burble_found = false ;
+static bool burble_save = false ;
+static GB_printf_function_t burble_save_printf = NULL ;
+
+static int burble_printf (const char *restrict format, ...)
+{
+    char buf [1024] ;
+    va_list ap ;
+    va_start (ap, format) ;
+    int n = vsnprintf (buf, 1024, format, ap) ;
+    va_end (ap) ;
+    if (strstr (buf, burble_pattern) != NULL) burble_found = true ;
+    return (n) ;
+}
+
+void GB_mx_burble_start
+(
+    const char *pattern     // pattern to search for in the burble
+)
+{
+    strncpy (burble_pattern, pattern, 255) ;
+    burble_pattern [255] = '\0' ;
+    burble_found = false ;
+    burble_save = GB_Global_burble_get ( ) ;
+    burble_save_printf = GB_Global_printf_get ( ) ;
+    GB_Global_printf_set (burble_printf) ;
+    GB_Global_burble_set (true) ;
+}
+
+bool GB_mx_burble_stop      // true if the pattern was found
+(
+    void
+)
+{
+    GB_Global_burble_set (burble_save) ;
+    GB_Global_printf_set (burble_save_printf) ;
+    return (burble_found) ;
+}
+
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Test/GB_mx_random_typed.c: create a random matrix of any type
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates an nrows-by-ncols matrix of a built-in type, held by column, with
+// nz entries set by GrB_Matrix_setElement at random positions (duplicates
+// overwrite prior entries).  The values are random integers in the range -4
+// to 4, or all 1 if iso is true.  If the sparsity is GxB_FULL, all entries
+// are first set to 1.  The matrix is then finalized with GrB_wait, and given
+// the sparsity control.
+
+#include "GB_mex.h"
+
+#define OK(method)                                                          \
+{                                                                           \
+    info = method ;                                                         \
+    if (info != GrB_SUCCESS)                                                \
+    {                                                                       \
+        FREE_ALL ;                                                          \
+        return (info) ;                                                     \
+    }                                                                       \
+}
+
+#define FREE_ALL                    \
+    GrB_Matrix_free (&A) ;
+
+GrB_Info GB_mx_random_typed     // create a random matrix of any type
+(
+    GrB_Matrix *A_output,   // handle of matrix to create
+    GrB_Type type,          // type of the matrix (built-in)
+    int64_t nrows,          // number of rows
+    int64_t ncols,          // number of columns
+    int64_t nz,             // number of entries to set
+    int sparsity,           // sparsity control of the matrix
+    bool iso                // if true, all entries are equal to 1
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    (*A_output) = NULL ;
+    OK (GrB_Matrix_new (&A, type, nrows, ncols)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    if (sparsity == GxB_FULL)
+    {
+        // all entries of a full matrix are present
+        OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, 1, GrB_ALL, nrows, GrB_ALL,
+            ncols, NULL)) ;
+    }
+    for (int64_t k = 0 ; k < nz ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % nrows ;
+        GrB_Index j = simple_rand_i ( ) % ncols ;
+        double x = iso ? 1 : ((double) (simple_rand ( ) % 9) - 4) ;
+        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+    (*A_output) = A ;
+    return (GrB_SUCCESS) ;
+}
+
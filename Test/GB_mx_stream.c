@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Test/GB_mx_stream.c: an in-memory stream for serialize_stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_mx_stream_write and GB_mx_stream_read are the writer and reader
+// functions for GxB_*_serialize_stream and GxB_*_deserialize_stream, for a
+// GB_mx_stream held in memory.  The writer fails if the stream would exceed
+// S->limit bytes, and the reader fails if it would read past the end of the
+// stream.  The largest single read is kept in S->maxread.
+
+#include "GB_mex.h"
+
+bool GB_mx_stream_write         // append data to the stream
+(
+    void *stream,               // a GB_mx_stream
+    const void *data,           // data to write
+    size_t size                 // # of bytes to write
+)
+{
+    GB_mx_stream *S = (GB_mx_stream *) stream ;
+    if (S->len + size > S->limit) return (false) ;
+    if (S->len + size > S->size)
+    {
+        size_t newsize = 2 * (S->len + size) ;
+        uint8_t *p = mxMalloc (newsize) ;
+        if (p == NULL) return (false) ;
+        if (S->len > 0) memcpy (p, S->bytes, S->len) ;
+        if (S->bytes != NULL) mxFree (S->bytes) ;
+        S->bytes = p ;
+        S->size = newsize ;
+    }
+    memcpy (S->bytes + S->len, data, size) ;
+    S->len += size ;
+    return (true) ;
+}
+
+bool GB_mx_stream_read          // read the next data from the stream
+(
+    void *stream,               // a GB_mx_stream
+    void *data,                 // data to read
+    size_t size                 // # of bytes to read
+)
+{
+    GB_mx_stream *S = (GB_mx_stream *) stream ;
+    S->maxread = GB_IMAX (S->maxread, size) ;
+    if (S->pos + size > S->len) return (false) ;
+    memcpy (data, S->bytes + S->pos, size) ;
+    S->pos += size ;
+    return (true) ;
+}
+
+void GB_mx_stream_clear         // free the content of the stream
+(
+    GB_mx_stream *S
+)
+{
+    if (S->bytes != NULL) mxFree (S->bytes) ;
+    memset (S, 0, sizeof (GB_mx_stream)) ;
+    S->limit = SIZE_MAX ;
+}
+
@@ -0,0 +1,60 @@
+function test280
+%TEST280 test and benchmark the radix sort in GB_builder
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test280 --------------- radix sort in GB_builder\n') ;
+
+rng ('default') ;
+save = GB_mex_builder_sort ;
+
+% matrices with a range of key sizes, including a vector (vdim == 1), small
+% problems, and wide keys, where the automatic selection uses the merge sort.
+dims = [
+    10          10          1000
+    1000        1000        100000
+    100000      1           100000
+    100000      100000      1000000
+    2^45        1000        100000
+    ] ;
+
+for k = 1:size (dims, 1)
+
+    m  = dims (k,1) ;
+    n  = dims (k,2) ;
+    nz = dims (k,3) ;
+    I0 = uint64 (floor (rand (nz,1) * m)) ;
+    J0 = uint64 (floor (rand (nz,1) * n)) ;
+    X  = floor (100 * rand (nz,1)) ;
+
+    for iso = 0:1
+        if (iso)
+            X = pi * ones (nz,1) ;
+        end
+        for dup = {'plus', 'first', 'second'}
+            op = dup {1} ;
+            t = zeros (1,3) ;
+            for method = 0:2
+                GB_mex_builder_sort (method) ;
+                tic
+                if (n == 1)
+                    C = GB_mex_Vector_build (I0, X, m, op) ;
+                else
+                    C = GB_mex_Matrix_build (I0, J0, X, m, n, op) ;
+                end
+                t (method+1) = toc ;
+                if (method == 0)
+                    C0 = C ;
+                else
+                    assert (isequal (C0.matrix, C.matrix)) ;
+                end
+            end
+            fprintf ('%12g-by-%-12g nz %8d iso %d %6s: ', m, n, nz, iso, op) ;
+            fprintf ('auto %8.4f merge %8.4f radix %8.4f\n', t) ;
+        end
+    end
+end
+
+GB_mex_builder_sort (save) ;
+fprintf ('test280 all tests passed.\n') ;
@@ -0,0 +1,85 @@
+function test281
+%TEST281 test C+=A*B' with the outer-product method
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test281 ---C+=A*B'' when C is full, with the outer product method\n') ;
+
+rng ('default') ;
+
+m = 50 ;
+n = 40 ;
+k = 100 ;
+
+dnt = struct ('inp1', 'tran') ;
+[save_nthreads save_chunk] = nthreads_get ;
+
+semirings = { 'plus', 'times' ; 'min', 'plus' ; 'max', 'first' ; ...
+    'plus', 'secondj' ; 'plus', 'pair' } ;
+types = { 'double', 'int64', 'single' } ;
+
+for kk = 1:length (types)
+    type = types {kk} ;
+    tol = 0 ;
+    if (isequal (type, 'single'))
+        tol = 1e-5 ;
+    elseif (isequal (type, 'double'))
+        tol = 1e-12 ;
+    end
+
+    for ss = 1:size (semirings, 1)
+
+        semiring.add = semirings {ss,1} ;
+        semiring.multiply = semirings {ss,2} ;
+        semiring.class = type ;
+        [mult_op add_op id] = GB_spec_semiring (semiring) ;
+
+        for a_sparsity = [1 2]
+        for b_sparsity = [1 2]
+        for b_iso = [false true]
+        for c_iso = [false true]
+
+            A = GB_spec_random (m, k, 0.05, 10, type) ;
+            A.sparsity = a_sparsity ;
+            B = GB_spec_random (n, k, 0.05, 10, type) ;
+            B.sparsity = b_sparsity ;
+            B.iso = b_iso ;
+            if (b_iso)
+                B.matrix = 2 * spones (B.matrix) ;
+            end
+
+            C.matrix = sparse (round (10 * rand (m, n))) ;
+            if (c_iso)
+                C.matrix = sparse (3 * ones (m, n)) ;
+            end
+            C.pattern = logical (ones (m, n)) ;
+            C.sparsity = 8 ;
+            C.iso = c_iso ;
+            C.class = type ;
+
+            for nth = [1 4]
+                nthreads_set (nth, 1) ;
+                C1 = GB_spec_mxm (C, [ ], add_op, semiring, A, B, dnt) ;
+                C2 = GB_mex_mxm  (C, [ ], add_op, semiring, A, B, dnt) ;
+                GB_spec_compare (C1, C2, id, tol) ;
+            end
+
+            % C += A*A'
+            C0.matrix = sparse (round (10 * rand (m, m))) ;
+            C0.pattern = logical (ones (m, m)) ;
+            C0.sparsity = 8 ;
+            C0.class = type ;
+            C1 = GB_spec_mxm (C0, [ ], add_op, semiring, A, A, dnt) ;
+            C2 = GB_mex_mxm  (C0, [ ], add_op, semiring, A, A, dnt) ;
+            GB_spec_compare (C1, C2, id, tol) ;
+
+        end
+        end
+        end
+        end
+    end
+end
+
+nthreads_set (save_nthreads, save_chunk) ;
+fprintf ('test281: all tests passed\n') ;
@@ -0,0 +1,42 @@
+function test282
+%TEST282 test select on hypersparse matrices, with 1 and 4 threads
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test282 --------------- hypersparse select\n') ;
+
+rng ('default') ;
+
+[save_nthreads, save_chunk] = nthreads_get ;
+
+% A is hypersparse with many non-empty vectors, each with a single entry, so
+% that select leaves many empty vectors to be pruned from the hyperlist of C.
+% With a chunk size of 1, the hyperlist is pruned in parallel.
+m = 100 ;
+n = 2e4 ;
+nz = 1e4 ;
+I = floor (rand (nz,1) * m) + 1 ;
+J = floor (rand (nz,1) * n) + 1 ;
+X = rand (nz,1) ;
+A = sparse (I, J, X, m, n) ;
+
+H.matrix = A ;
+H.sparsity = 1 ;    % hypersparse
+C = sparse (m, n) ;
+
+op.opname = 'valuegt' ;
+op.optype = 'double' ;
+
+for y = [0.1 0.5 0.9]
+
+    C0 = A .* (A > y) ;
+    for nthreads = [1 4]
+        nthreads_set (nthreads, 1) ;
+        C1 = GB_mex_select_idxunop (C, [ ], [ ], op, 0, H, y, [ ]) ;
+        assert (isequal (C0, C1.matrix)) ;
+    end
+end
+
+nthreads_set (save_nthreads, save_chunk) ;
+fprintf ('test282 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test283
+%TEST283 test the cached saxpy3 schedule
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test36 ;
+fprintf ('test283 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test284
+%TEST284 test ultra-fine tasks in dot3 and saxpy3
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test37 ;
+fprintf ('test284 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test285
+%TEST285 test the tiled dot2 method for C=A'*B with A and B full
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test38 ;
+fprintf ('test285 all tests passed.\n') ;
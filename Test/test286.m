@@ -0,0 +1,8 @@
+function test286
+%TEST286 test C+=A*B computed in place with C bitmap
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test39 ;
+fprintf ('test286 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test287
+%TEST287 test the masked selector, C<M>=select(A), with the JIT on and off
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test40 ;
+fprintf ('test287 all tests passed.\n') ;
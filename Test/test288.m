@@ -0,0 +1,8 @@
+function test288
+%TEST288 test C=A(I,:) with a large list I, inverted in parallel
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test41 ;
+fprintf ('test288 all tests passed.\n') ;
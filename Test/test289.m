@@ -0,0 +1,66 @@
+function test289
+%TEST289 test parallel kron against the built-in kron
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test289 --------------- parallel kron\n') ;
+
+rng ('default') ;
+
+[save_nthreads, save_chunk] = nthreads_get ;
+
+% with a chunk of 1, the entries of C are sliced across all the threads
+nthreads_set (4, 1) ;
+
+op.opname = 'times' ;
+dnn = struct ;
+
+for optype = { 'double', 'int32' }
+    op.optype = optype {1} ;
+
+    % kron of two vectors: C is a single vector, split across the threads
+    A1 = sparse (round (10 * sprand (500, 1, 0.5))) ;
+    B1 = sparse (round (10 * sprand (300, 1, 0.5))) ;
+
+    % uneven vectors: A has one dense column and many nearly-empty ones
+    A2 = sparse (round (10 * sprand (200, 50, 0.02))) ;
+    A2 (:,7) = 1 + round (9 * rand (200, 1)) ;
+    B2 = sparse (round (10 * sprand (30, 20, 0.3))) ;
+
+    % full matrices
+    A3 = 1 + round (9 * rand (20, 10)) ;
+    B3 = 1 + round (9 * rand (10, 30)) ;
+
+    % iso matrices
+    A4 = 2 * spones (sprand (100, 40, 0.1)) ;
+    B4 = 3 * spones (sprand (50, 20, 0.1)) ;
+
+    Alist = { A1, A2, A3, A4 } ;
+    Blist = { B1, B2, B3, B4 } ;
+
+    for k = 1:length (Alist)
+        for A_sparsity = [1 2 4 8]
+            for B_sparsity = [1 2 4 8]
+
+                % C = kron (A,B)
+                clear A B
+                A.matrix = Alist {k} ;
+                A.sparsity = A_sparsity ;
+                A.class = op.optype ;
+                B.matrix = Blist {k} ;
+                B.sparsity = B_sparsity ;
+                B.class = op.optype ;
+                [am, an] = size (A.matrix) ;
+                [bm, bn] = size (B.matrix) ;
+                C = sparse (am*bm, an*bn) ;
+                C1 = GB_mex_kron (C, [ ], [ ], op, A, B, dnn) ;
+                C0 = kron (A.matrix, B.matrix) ;
+                assert (isequal (C0, double (C1.matrix))) ;
+            end
+        end
+    end
+end
+
+nthreads_set (save_nthreads, save_chunk) ;
+fprintf ('test289 all tests passed.\n') ;
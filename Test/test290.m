@@ -0,0 +1,8 @@
+function test290
+%TEST290 test the cached slice of a matrix for GB_ek_slice
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test42 ;
+fprintf ('test290 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test291
+%TEST291 test GB_wait_merge with many threads
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test43 ;
+fprintf ('test291 all tests passed.\n') ;
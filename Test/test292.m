@@ -0,0 +1,8 @@
+function test292
+%TEST292 test GxB_SHALLOW_DESERIALIZE
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test44 ;
+fprintf ('test292 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test293
+%TEST293 test serialize and deserialize with a stream
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test45 ;
+fprintf ('test293 all tests passed.\n') ;
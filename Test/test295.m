@@ -0,0 +1,8 @@
+function test295
+%TEST295 test GxB_Matrix_deserialize_range
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test47 ;
+fprintf ('test295 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test296
+%TEST296 test GxB_COMPRESSION_FILTER
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2023, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test48 ;
+fprintf ('test296 all tests passed.\n') ;
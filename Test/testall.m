@@ -100,6 +100,23 @@ malloc_debugging = stat ;
 %----------------------------------------
 
 logstat ('test250'    ,t, j44 , f10 ) ; % JIT tests, set/get, other tests
+logstat ('test296'    ,t, j0  , f1  ) ; % serialize with the delta/shuffle filter
+logstat ('test295'    ,t, j0  , f1  ) ; % deserialize a range of vectors
+logstat ('test294'    ,t, j0  , f1  ) ; % Matrix Market read/write
+logstat ('test293'    ,t, j0  , f1  ) ; % serialize/deserialize stream
+logstat ('test292'    ,t, j0  , f1  ) ; % shallow deserialize
+logstat ('test291'    ,t, j0  , f1  ) ; % parallel zombie merge in wait
+logstat ('test290'    ,t, j0  , f1  ) ; % cached ek_slice
+logstat ('test289'    ,t, j40 , f1  ) ; % parallel kron
+logstat ('test288'    ,t, j40 , f1  ) ; % C=A(I,:) with large I
+logstat ('test287'    ,t, j40 , f1  ) ; % masked select, JIT on and off
+logstat ('test286'    ,t, j40 , f1  ) ; % C+=A*B in place, C bitmap
+logstat ('test285'    ,t, j40 , f1  ) ; % tiled dot2 for C=A'*B, all full
+logstat ('test284'    ,t, j40 , f1  ) ; % ultra-fine dot3 and saxpy3 tasks
+logstat ('test283'    ,t, j0  , f1  ) ; % cached saxpy3 schedule
+logstat ('test282'    ,t, j0  , f1  ) ; % hypersparse select, 1 and 4 threads
+logstat ('test281'    ,t, j40 , f1  ) ; % C+=A*B' outer product
+logstat ('test280'    ,t, j0  , f1  ) ; % radix sort in GB_builder
 logstat ('test279'    ,t, j0  , f1  ) ; % blob get/set
 logstat ('test278'    ,t, j0  , f1  ) ; % descriptor get/set
 logstat ('test277'    ,t, j0  , f1  ) ; % context get/set
@@ -34,6 +34,8 @@ foreach ( PSRC ${PRE1} )
         list ( APPEND PREPRO "JIT_DOT3 (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_dot4_" )
         list ( APPEND PREPRO "JIT_DOT4 (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__AxB_outer_" )
+        list ( APPEND PREPRO "JIT_OUTR (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_saxbit" )
         list ( APPEND PREPRO "JIT_SAXB (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__AxB_saxpy3" )
@@ -68,12 +70,16 @@ foreach ( PSRC ${PRE1} )
         list ( APPEND PREPRO "JIT_EWFA (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__ewise_fulln" )
         list ( APPEND PREPRO "JIT_EWFN (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__kroner" )
+        list ( APPEND PREPRO "JIT_KRON (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__reduce" )
         list ( APPEND PREPRO "JIT_RED  (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__rowscale" )
         list ( APPEND PREPRO "JIT_ROWS (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__select_bitmap" )
         list ( APPEND PREPRO "JIT_SELB (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__select_masked" )
+        list ( APPEND PREPRO "JIT_SELM (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__select_phase1" )
         list ( APPEND PREPRO "JIT_SEL1 (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__select_phase2" )